@@ -41,6 +41,17 @@ hcclResult_t HCCL_API_CALL hcclCommInitRank_impl(hcclComm_t* comm, int nranks, h
     
 }
 
+hcclResult_t HCCL_API_CALL hcclCommInitRanks_impl(hcclComm_t*         comms,
+                                                  int                 ncomms,
+                                                  const int*          nranks,
+                                                  const hcclUniqueId* commIds,
+                                                  const int*          ranks)
+{
+    
+        return (HclGen2::hcclCommInitRanks_impl(comms, ncomms, nranks, commIds, ranks));
+    
+}
+
 hcclResult_t HCCL_API_CALL hcclCommInitAll_impl(hcclComm_t* comm, int ndev, const int* devlist)
 {
     
@@ -132,6 +143,20 @@ hcclResult_t HCCL_API_CALL hcclCommUserRank_impl(hcclComm_t comm, int* rank)
     
 }
 
+hcclResult_t HCCL_API_CALL hcclCommSetPriority_impl(hcclComm_t comm, hcclPriority_t priority)
+{
+    
+        return (HclGen2::hcclCommSetPriority_impl(comm, priority));
+    
+}
+
+hcclResult_t HCCL_API_CALL hcclCommGetStats_impl(hcclComm_t comm, hcclCommStats_t* stats)
+{
+    
+        return (HclGen2::hcclCommGetStats_impl(comm, stats));
+    
+}
+
 int HCCL_API_CALL hcclLookupDMABuff_impl(uint64_t addr, uint64_t size, int* fd)
 {
     
@@ -99,4 +99,8 @@ public:
     w_fi_send(struct fid_ep* ep, const void* buf, size_t len, void* desc, fi_addr_t dest_addr, void* context) = 0;
     virtual ssize_t
     w_fi_recv(struct fid_ep* ep, void* buf, size_t len, void* desc, fi_addr_t src_addr, void* context) = 0;
+
+    // required from wrapper version 1.3, see OfiPlugin::isMsgPostSupported
+    virtual ssize_t w_fi_tsendmsg(struct fid_ep* ep, const struct fi_msg_tagged* msg, uint64_t flags) = 0;
+    virtual ssize_t w_fi_trecvmsg(struct fid_ep* ep, const struct fi_msg_tagged* msg, uint64_t flags) = 0;
 };
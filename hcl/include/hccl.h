@@ -64,6 +64,13 @@ hcclResult_t hcclGetUniqueId(hcclUniqueId* uniqueId);
  * called by different threads/processes or use hcclGroupStart/hcclGroupEnd. */
 hcclResult_t hcclCommInitRank(hcclComm_t* comm, int nranks, hcclUniqueId commId, int rank);
 
+/* Creates ncomms communicators in one call (multi thread/process version).
+ * Entry i creates the communicator of commIds[i], with nranks[i] ranks, as rank ranks[i] into comms[i].
+ * The communicators are initialized in parallel, so the ranks don't have to list them in the same order.
+ * If any of them fails, the ones that were created are destroyed. */
+hcclResult_t
+hcclCommInitRanks(hcclComm_t* comms, int ncomms, const int* nranks, const hcclUniqueId* commIds, const int* ranks);
+
 /* Creates a clique of communicators (single process version).
  * This is a convenience function to create a single-process communicator clique.
  * Returns an array of ndev newly initialized communicators in comm.
@@ -107,6 +114,16 @@ hcclResult_t hcclCommSynDevice(hcclComm_t comm, int* device);
 /* Returns the user-ordered "rank" associated with the communicator. */
 hcclResult_t hcclCommUserRank(hcclComm_t comm, int* rank);
 
+/* Sets the priority class of the communicator's future operations.
+ * High priority work is served first by the host scheduler (HCL_PRIORITY_CLASSES), so small latency-critical
+ * collectives don't wait behind bulk transfers of other streams. */
+hcclResult_t hcclCommSetPriority(hcclComm_t comm, hcclPriority_t priority);
+
+/* Returns the cumulative counters of the communicator. Counting is off by default, set HCL_COMM_STATS=1 to enable it,
+ * otherwise hcclInvalidUsage is returned and stats is left untouched. Counters are updated without synchronization,
+ * so a read while operations are submitted may be off by the ops in progress. */
+hcclResult_t hcclCommGetStats(hcclComm_t comm, hcclCommStats_t* stats);
+
 /* Returns FD for HBM memory region if it was registered for gaudi-direct. */
 int hcclLookupDMABuff(uint64_t addr, uint64_t size, int* fd);
 
@@ -101,4 +101,11 @@ struct hccl_functions_pointers
     hcclResult_t (*pfn_hcclGetVersionString)(char* pVersion, const unsigned len);
     hcclResult_t (*pfn_hcclCommFinalize)(hcclComm_t comm);
     hcclResult_t (*pfn_hcclDeviceInit)(void* device, void* context);
+    hcclResult_t (*pfn_hcclCommSetPriority)(hcclComm_t comm, hcclPriority_t priority);
+    hcclResult_t (*pfn_hcclCommGetStats)(hcclComm_t comm, hcclCommStats_t* stats);
+    hcclResult_t (*pfn_hcclCommInitRanks)(hcclComm_t*         comms,
+                                          int                 ncomms,
+                                          const int*          nranks,
+                                          const hcclUniqueId* commIds,
+                                          const int*          ranks);
 };
@@ -91,6 +91,57 @@ typedef enum
     hcclNumTypes
 } hcclDataType_t;
 
+/* Priority class of a communicator's work */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef enum
+{
+    hcclPriorityDefault = 0,
+    hcclPriorityHigh    = 1,
+    hcclNumPriorities
+} hcclPriority_t;
+
+/* Operations counted by hcclCommGetStats */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef enum
+{
+    hcclStatsAllReduce = 0,
+    hcclStatsReduce,
+    hcclStatsReduceScatter,
+    hcclStatsAllGather,
+    hcclStatsBroadcast,
+    hcclStatsAlltoAll,
+    hcclStatsSend,
+    hcclStatsRecv,
+    hcclStatsNumOps
+} hcclStatsOp_t;
+
+#define HCCL_STATS_MAX_QP_SETS 16
+
+/* Cumulative counters of an operation type */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct
+{
+    uint64_t calls;
+    uint64_t bytes;         /* count times datatype size, as passed to the calls */
+    uint64_t submitTimeNs;  /* host time spent in the calls, queueing time only for calls inside a group */
+} hcclOpStats_t;
+
+/* Cumulative counters of a communicator, since its creation */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct
+{
+    hcclOpStats_t ops[hcclStatsNumOps];
+    uint64_t      scaleoutSendBytes[HCCL_STATS_MAX_QP_SETS]; /* host NIC scaleout bytes, per QP set */
+    uint64_t      scaleoutRecvBytes[HCCL_STATS_MAX_QP_SETS];
+    uint64_t      scaleoutPending;   /* host NIC transfers posted by the host scheduler and not completed yet */
+    uint64_t      creditStalls;      /* ops the device had to hold until credits of older ops were released */
+    uint64_t      creditStallOps;    /* older ops waited for, summed over all stalls */
+    uint64_t      graphCacheHits;    /* signal graphs reused from the cache */
+    uint64_t      graphCacheMisses;  /* signal graphs built */
+    uint64_t      scaleoutDirectOps; /* collectives sent with Gaudi-direct, with HCL_HNIC_HYBRID_PATH only */
+    uint64_t      scaleoutBounceOps; /* collectives staged through host buffers, with HCL_HNIC_HYBRID_PATH only */
+} hcclCommStats_t;
+
 #ifdef __cplusplus
 }  // end extern "C"
 #endif
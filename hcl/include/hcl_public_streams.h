@@ -221,6 +221,7 @@ private:
     static std::string handle_host_sched_cmd_wait_for_completion(const void* address);
     static std::string handle_host_sched_cmd_fence_wait(const void* address);
     static std::string handle_host_sched_cmd_signal_so(const void* address);
+    static std::string handle_host_sched_cmd_set_priority(const void* address);
 
     bool logDfaMain(DfaStatus& dfaStatus, void (*logFunc)(int, const char*), DfaLoggersV3& dfaLoggers);
 
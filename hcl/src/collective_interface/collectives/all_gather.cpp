@@ -0,0 +1,51 @@
+#include "collective_interface/collectives/all_gather.h"
+
+#include "collective_interface/prims/hccl_prim.h"
+#include "collective_interface/hccl_graph.h"
+#include "collective_interface/prims/simple_prims.h"
+#include "collective_interface/prims/scaleup_prims.h"
+
+void ag_addPairwisePrims(HcclGraph&           graph,
+                         HclCollectiveParams& params,
+                         const uint64_t       countPerRank,
+                         const uint64_t       scaleupSrcAddr,
+                         const uint64_t       scaleoutSrcAddr)
+{
+    const uint16_t myBox            = params.m_dynamicComm.getMyScaleupGroup();
+    const uint32_t commSize         = params.m_dynamicComm.getCommSize();
+    const uint32_t scaleupGroupSize = params.m_dynamicComm.getScaleupGroupSize();
+    const uint32_t boxesCount       = commSize / scaleupGroupSize;
+    const uint64_t rankAddrOffset   = countPerRank * dataTypeSizeInBytes(params.m_dataType);
+
+    graph.createPrim<HcclPrimAllGather>(scaleupSrcAddr,
+                                        params.m_recvBufferAddr + myBox * scaleupGroupSize * rankAddrOffset,
+                                        countPerRank);
+
+    for (uint32_t i = 1; i < boxesCount; i++)
+    {
+        // boxes are visited in the scaleout box ring order, see HclDynamicCommunicator::getBoxRing, and the peer in
+        // a box is the rank with my scaleup index there
+        uint16_t sendBox  = params.m_dynamicComm.getBoxAtRingDistance(myBox, i, boxesCount);
+        uint16_t recvBox  = params.m_dynamicComm.getBoxAtRingDistance(myBox, -(int)i, boxesCount);
+        HCL_Rank sendRank = params.m_dynamicComm.getScaleupGroupToRankMap()[sendBox];
+        HCL_Rank recvRank = params.m_dynamicComm.getScaleupGroupToRankMap()[recvBox];
+
+        uint64_t recvAddr    = params.m_recvBufferAddr + recvRank * rankAddrOffset;
+        uint64_t boxOffset   = recvBox * scaleupGroupSize * rankAddrOffset;
+        uint64_t agInOutAddr = params.m_recvBufferAddr + boxOffset;
+
+        auto recv = graph.createPrim<HcclPrimRecv>(RecvPrimArgs {recvRank, recvAddr, {}, countPerRank});
+        auto ag   = graph.createPrim<HcclPrimAllGather>(agInOutAddr, agInOutAddr, countPerRank);
+        graph.addWait(recv, ag);
+
+        graph.createPrim<HcclPrimSend>(SendPrimArgs {sendRank, scaleoutSrcAddr, {}, countPerRank});
+    }
+}
+
+hcclResult_t ag_runPairwise(IHcclGraphEngine* engine, HclCollectiveParams& params)
+{
+    // m_count is the send count of each rank
+    HcclGraph graph(engine, &params);
+    ag_addPairwisePrims(graph, params, params.m_count, params.m_sendBufferAddr, params.m_sendBufferAddr);
+    return graph.submit();
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "hccl_types.h"
+#include "hcl_collective_params.h"
+
+class IHcclGraphEngine;
+class HcclGraph;
+
+/**
+ * @brief Adds the prims of a pairwise all-gather to graph: a scaleup all-gather of this box, then per remote box a
+ * scaleout exchange followed by a scaleup all-gather of the received chunk.
+ *
+ * @param graph graph to add prims to.
+ * @param params collective params, m_recvBufferAddr holds countPerRank elements per comm rank.
+ * @param countPerRank number of elements contributed by each rank.
+ * @param scaleupSrcAddr input address of this box's scaleup all-gather.
+ * @param scaleoutSrcAddr address of this rank's chunk sent to the other boxes.
+ */
+void ag_addPairwisePrims(HcclGraph&           graph,
+                         HclCollectiveParams& params,
+                         uint64_t             countPerRank,
+                         uint64_t             scaleupSrcAddr,
+                         uint64_t             scaleoutSrcAddr);
+
+hcclResult_t ag_runPairwise(IHcclGraphEngine* engine, HclCollectiveParams& params);
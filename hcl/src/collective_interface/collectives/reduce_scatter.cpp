@@ -0,0 +1,88 @@
+#include "collective_interface/collectives/reduce_scatter.h"
+
+#include "collective_interface/prims/hccl_prim.h"
+#include "collective_interface/hccl_graph.h"
+#include "collective_interface/prims/simple_prims.h"
+#include "collective_interface/prims/scaleup_prims.h"
+
+void rs_addPairwisePrims(HcclGraph&           graph,
+                         HclCollectiveParams& params,
+                         const uint64_t       countPerRank,
+                         const uint64_t       dstAddr)
+{
+    const uint16_t myBox            = params.m_dynamicComm.getMyScaleupGroup();
+    const uint32_t commSize         = params.m_dynamicComm.getCommSize();
+    const uint32_t scaleupGroupSize = params.m_dynamicComm.getScaleupGroupSize();
+    const uint32_t boxesCount       = commSize / scaleupGroupSize;
+    const uint64_t rankAddrOffset   = countPerRank * dataTypeSizeInBytes(params.m_dataType);
+
+    BufferToken scaleoutBuff = graph.generateBufferToken(STATIC_BUFFER);
+
+    if (boxesCount > 1)
+    {
+        bool castUp = isDataTypeTwoBytes(params.m_dataType);
+        graph.createPrim<HcclPrimReduceScatter>(
+            ReduceScatterPrimArgs {{params.m_sendBufferAddr + myBox * scaleupGroupSize * rankAddrOffset,
+                                    0,
+                                    scaleoutBuff,
+                                    countPerRank * scaleupGroupSize},
+                                   castUp});
+    }
+    else
+    {
+        graph.createPrim<HcclPrimReduceScatter>(ReduceScatterPrimArgs {
+            {params.m_sendBufferAddr + myBox * scaleupGroupSize * rankAddrOffset,
+             dstAddr,
+             {},
+             countPerRank * scaleupGroupSize},
+            false});
+    }
+
+    // Every box gets its own TEMP_BUFFER token, which the engine resolves to the scaleup pool buffer of the exec set
+    // the box lands in. The reduce-scatter of box i+1 therefore doesn't wait for box i's data to leave, and the
+    // scaleout transfers overlap the accumulation of the previous boxes into scaleoutBuff.
+    for (uint32_t i = 1; i < boxesCount; i++)
+    {
+        // boxes are visited in the scaleout box ring order, see HclDynamicCommunicator::getBoxRing, and the peer in
+        // a box is the rank with my scaleup index there
+        uint16_t sendBox  = params.m_dynamicComm.getBoxAtRingDistance(myBox, i, boxesCount);
+        uint16_t recvBox  = params.m_dynamicComm.getBoxAtRingDistance(myBox, -(int)i, boxesCount);
+        HCL_Rank sendRank = params.m_dynamicComm.getScaleupGroupToRankMap()[sendBox];
+        HCL_Rank recvRank = params.m_dynamicComm.getScaleupGroupToRankMap()[recvBox];
+
+        uint64_t boxOffset   = sendBox * scaleupGroupSize * rankAddrOffset;
+        uint64_t rsInputAddr = params.m_sendBufferAddr + boxOffset;
+
+        BufferToken scaleupBuff = graph.generateBufferToken(TEMP_BUFFER);
+
+        auto rs = graph.createPrim<HcclPrimReduceScatter>(
+            ReduceScatterPrimArgs {{rsInputAddr, 0, scaleupBuff, countPerRank * scaleupGroupSize}});
+
+        const bool doReduction = true;
+
+        auto send = graph.createPrim<HcclPrimSend>(SendPrimArgs {sendRank, 0, scaleupBuff, countPerRank, doReduction});
+
+        graph.addWait(rs, send);
+
+        bool cast = isDataTypeTwoBytes(params.m_dataType);
+        auto recv =
+            graph.createPrim<HcclPrimRecv>(RecvPrimArgs {recvRank, 0, scaleoutBuff, countPerRank, doReduction, cast});
+
+        if (i == boxesCount - 1)
+        {
+            auto reduction = graph.createPrim<HcclPrimReduction>(
+                ReductionPrimArgs {0, scaleoutBuff, dstAddr, countPerRank, cast});
+            graph.addWait(recv, reduction);
+        }
+    }
+}
+
+hcclResult_t rs_runPairwise(IHcclGraphEngine* engine, HclCollectiveParams& params)
+{
+    // m_count is the send count, see hccl_communicator::reduceScatter
+    const uint64_t countPerRank = params.m_count / params.m_dynamicComm.getCommSize();
+
+    HcclGraph graph(engine, &params);
+    rs_addPairwisePrims(graph, params, countPerRank, params.m_recvBufferAddr);
+    return graph.submit();
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "hccl_types.h"
+#include "hcl_collective_params.h"
+
+class IHcclGraphEngine;
+class HcclGraph;
+
+/**
+ * @brief Adds the prims of a pairwise reduce-scatter to graph: a scaleup reduce-scatter per box, whose result is sent
+ * to the box owning it while the partial results received from the other boxes are accumulated.
+ *
+ * @param graph graph to add prims to.
+ * @param params collective params, m_sendBufferAddr holds countPerRank elements per comm rank.
+ * @param countPerRank number of elements in the output of each rank.
+ * @param dstAddr address of the reduced output of this rank.
+ */
+void rs_addPairwisePrims(HcclGraph& graph, HclCollectiveParams& params, uint64_t countPerRank, uint64_t dstAddr);
+
+hcclResult_t rs_runPairwise(IHcclGraphEngine* engine, HclCollectiveParams& params);
@@ -2,6 +2,54 @@
 #include "collective_interface/prims/hccl_prim.h"
 #include "collective_interface/hccl_graph.h"
 
+#include <algorithm>  // for max, remove
+#include <array>      // for array
+#include <map>        // for map
+
+#include "collective_interface/prims/scaleup_prims.h"
+#include "collective_interface/prims/simple_prims.h"
+#include "hcl_global_conf.h"        // for GCFG_HCCL_PRIM_GRAPH_OPTIMIZE
+#include "infra/hcl_debug_stats.h"  // for g_dbgStats
+
+namespace
+{
+// buffer tokens are tracked as one byte ranges above the device address space
+constexpr uint64_t TOKEN_RANGE_BASE = 1ull << 60;
+
+std::pair<uint64_t, uint64_t> tokenRange(const BufferToken& token)
+{
+    const uint64_t start = TOKEN_RANGE_BASE + ((uint64_t)token.bufferType << 48) + token.bufferIdx;
+    return {start, start + 1};
+}
+
+void addRange(std::vector<std::pair<uint64_t, uint64_t>>& ranges,
+              const uint64_t                              addr,
+              const BufferToken&                          token,
+              const uint64_t                              bytes)
+{
+    if (token.bufferType != INVALID_BUFFER)
+    {
+        ranges.push_back(tokenRange(token));
+    }
+    else if (bytes > 0)
+    {
+        ranges.emplace_back(addr, addr + bytes);
+    }
+}
+
+bool overlaps(const std::vector<std::pair<uint64_t, uint64_t>>& a, const std::vector<std::pair<uint64_t, uint64_t>>& b)
+{
+    for (const auto& [aStart, aEnd] : a)
+    {
+        for (const auto& [bStart, bEnd] : b)
+        {
+            if (aStart < bEnd && bStart < aEnd) return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
 HcclGraph::HcclGraph(IHcclGraphEngine* engine, HclCollectiveParams* params) : m_graphEngine(engine), m_params(params) {}
 
 void HcclGraph::addWait(hcclPrim_t signaler, hcclPrim_t waiter)
@@ -74,7 +122,14 @@ void HcclGraph::setupExecSets()
 
 hcclResult_t HcclGraph::submit()
 {
-    setupExecSets();
+    if (GCFG_HCCL_PRIM_GRAPH_OPTIMIZE.value())
+    {
+        optimize();
+    }
+    else
+    {
+        setupExecSets();
+    }
     uint64_t startVal = m_graphEngine->initGraph(this);
     for (size_t j = 0; j < m_completionSets.size(); j++)
     {
@@ -91,6 +146,412 @@ hcclResult_t HcclGraph::submit()
     return hcclSuccess;
 }
 
+HcclGraph::PrimAccess HcclGraph::primAccess(const hcclPrim_t& prim)
+{
+    const uint64_t dataTypeSize = dataTypeSizeInBytes(m_params->m_dataType);
+    PrimAccess     access;
+
+    switch (prim->type())
+    {
+        case SCALEUP_PRIM_TYPE:
+        {
+            HcclScaleupPrim* scaleupPrim = static_cast<HcclScaleupPrim*>(prim.get());
+            const uint64_t   bytes       = scaleupPrim->inputCount() * dataTypeSize;
+            const uint32_t   groupSize   = m_params->m_dynamicComm.getScaleupGroupSize();
+
+            if (HcclPrimAllGather* agPrim = dynamic_cast<HcclPrimAllGather*>(scaleupPrim))
+            {
+                const HCL_Rank rank    = m_params->m_dynamicComm.getRankInScaleupGroup();
+                const uint64_t ownAddr = agPrim->recvAddr() + rank * bytes;
+                if (agPrim->inPlace() || agPrim->sendAddr() == agPrim->recvAddr() || agPrim->sendAddr() == ownAddr)
+                {
+                    // the own chunk is only read, the chunks of the other members are written
+                    addRange(access.reads, ownAddr, {}, bytes);
+                    addRange(access.writes, agPrim->recvAddr(), {}, rank * bytes);
+                    addRange(access.writes, ownAddr + bytes, {}, (groupSize - rank - 1) * bytes);
+                }
+                else
+                {
+                    addRange(access.reads, agPrim->sendAddr(), {}, bytes);
+                    addRange(access.writes, agPrim->recvAddr(), {}, groupSize * bytes);
+                }
+            }
+            else if (HcclPrimReduceScatter* rsPrim = dynamic_cast<HcclPrimReduceScatter*>(scaleupPrim))
+            {
+                addRange(access.reads, rsPrim->sendAddr(), {}, bytes);
+                addRange(access.writes,
+                         rsPrim->recvAddr(),
+                         rsPrim->getBuffer(),
+                         rsPrim->getCountPerRank() * dataTypeSize);
+            }
+            else
+            {
+                HcclPrimBroadcast* bcastPrim = static_cast<HcclPrimBroadcast*>(scaleupPrim);
+                if (bcastPrim->isRoot())
+                {
+                    addRange(access.reads, bcastPrim->sendAddr(), {}, bytes);
+                }
+                if (!bcastPrim->isRoot() || bcastPrim->sendAddr() != bcastPrim->recvAddr())
+                {
+                    addRange(access.writes, bcastPrim->recvAddr(), {}, bytes);
+                }
+            }
+
+            if (scaleupPrim->getBuffer().bufferType == TEMP_BUFFER)
+            {
+                access.tempBuffer = scaleupPrim->getBuffer().bufferIdx;
+            }
+            break;
+        }
+        case SCALEOUT_SEND_PRIM_TYPE:
+        {
+            HcclPrimSend* sendPrim = static_cast<HcclPrimSend*>(prim.get());
+            addRange(access.reads, sendPrim->m_sendAddr, sendPrim->getBuffer(), sendPrim->sendCount() * dataTypeSize);
+            if (sendPrim->getBuffer().bufferType == TEMP_BUFFER)
+            {
+                access.tempBuffer = sendPrim->getBuffer().bufferIdx;
+            }
+            break;
+        }
+        case SCALEOUT_RECV_PRIM_TYPE:
+        {
+            HcclPrimRecv*  recvPrim = static_cast<HcclPrimRecv*>(prim.get());
+            const uint64_t bytes    = recvPrim->recvCount() * dataTypeSize;
+            if (recvPrim->doReduction())
+            {
+                addRange(access.reads, recvPrim->m_recvAddr, recvPrim->getBuffer(), bytes);
+            }
+            addRange(access.writes, recvPrim->m_recvAddr, recvPrim->getBuffer(), bytes);
+            if (recvPrim->getBuffer().bufferType == TEMP_BUFFER)
+            {
+                access.tempBuffer = recvPrim->getBuffer().bufferIdx;
+            }
+            break;
+        }
+        case REDUCTION_PRIM_TYPE:
+        {
+            HcclPrimReduction* reductionPrim = static_cast<HcclPrimReduction*>(prim.get());
+            const uint64_t     bytes         = reductionPrim->cnt() * dataTypeSize;
+            addRange(access.reads, reductionPrim->srcAddr(), reductionPrim->getSrcBuffer(), bytes);
+            addRange(access.writes, reductionPrim->dstAddr(), {}, bytes);
+            if (reductionPrim->getSrcBuffer().bufferType == TEMP_BUFFER)
+            {
+                access.tempBuffer = reductionPrim->getSrcBuffer().bufferIdx;
+            }
+            break;
+        }
+    }
+
+    return access;
+}
+
+std::vector<int> HcclGraph::primPositions()
+{
+    std::vector<int> positions(m_primCtr, -1);
+    for (size_t pos = 0; pos < m_prims.size(); pos++)
+    {
+        positions[m_prims[pos]->primIdx()] = pos;
+    }
+    return positions;
+}
+
+std::vector<std::vector<bool>> HcclGraph::primAncestors(const std::vector<int>& positions)
+{
+    // m_prims is in creation order and signalers are always created before their waiters
+    std::vector<std::vector<bool>> ancestors(m_prims.size(), std::vector<bool>(m_prims.size(), false));
+    for (size_t pos = 0; pos < m_prims.size(); pos++)
+    {
+        for (hcclSyncInfo* sync : m_prims[pos]->signalers())
+        {
+            const int signalerPos       = positions[sync->m_signaler->primIdx()];
+            ancestors[pos][signalerPos] = true;
+            for (int k = 0; k < signalerPos; k++)
+            {
+                if (ancestors[signalerPos][k]) ancestors[pos][k] = true;
+            }
+        }
+    }
+    return ancestors;
+}
+
+size_t HcclGraph::countWaits()
+{
+    size_t waits = 0;
+    for (const hcclPrim_t& prim : m_prims)
+    {
+        waits += prim->signalers().size();
+    }
+    return waits;
+}
+
+void HcclGraph::resetExecSets()
+{
+    for (const hcclPrim_t& prim : m_prims)
+    {
+        prim->setExecSet(-1);
+    }
+    m_completionSets.clear();
+}
+
+unsigned HcclGraph::eliminateWaits()
+{
+    const std::vector<int>               positions = primPositions();
+    const std::vector<std::vector<bool>> ancestors = primAncestors(positions);
+
+    unsigned dropped = 0;
+    for (const hcclPrim_t& prim : m_prims)
+    {
+        std::vector<hcclSyncInfo*>& signalers = prim->signalers();
+        for (size_t j = 0; j < signalers.size();)
+        {
+            const int signalerPos = positions[signalers[j]->m_signaler->primIdx()];
+
+            // a wait is implied if its signaler completes before another signaler of the same prim, or if it repeats
+            // an earlier wait
+            bool implied = false;
+            for (size_t k = 0; k < signalers.size() && !implied; k++)
+            {
+                const int otherPos = positions[signalers[k]->m_signaler->primIdx()];
+                implied            = k != j && (ancestors[otherPos][signalerPos] || (k < j && otherPos == signalerPos));
+            }
+
+            if (!implied)
+            {
+                j++;
+                continue;
+            }
+
+            hcclSyncInfo*               sync    = signalers[j];
+            std::vector<hcclSyncInfo*>& waiters = sync->m_signaler->waiters();
+            waiters.erase(std::remove(waiters.begin(), waiters.end(), sync), waiters.end());
+            signalers.erase(signalers.begin() + j);
+            LOG_HCL_DEBUG(HCL, "dropped wait of prim {} on prim {}", prim->primIdx(), sync->m_signaler->primIdx());
+            dropped++;
+        }
+    }
+    return dropped;
+}
+
+bool HcclGraph::scheduleExecSets()
+{
+    if (m_prims.empty()) return false;
+
+    constexpr int NUM_PRIM_TYPES = REDUCTION_PRIM_TYPE + 1;
+    constexpr int FREE_SLOT      = -1;
+    const size_t  numPrims       = m_prims.size();
+    const auto    positions      = primPositions();
+    const auto    ancestors      = primAncestors(positions);
+
+    std::vector<PrimAccess> accesses;
+    for (const hcclPrim_t& prim : m_prims)
+    {
+        accesses.push_back(primAccess(prim));
+    }
+
+    std::vector<int>                             execOf(numPrims, -1);
+    std::vector<std::array<int, NUM_PRIM_TYPES>> slots;       // per exec set, position of the prim of each type
+    std::vector<uint64_t>                        tempOfExec;  // TEMP_BUFFER index held by each exec set
+    std::map<uint64_t, int>                      execOfTemp;
+    std::array<int, NUM_PRIM_TYPES>              lastOfType;
+    lastOfType.fill(-1);
+
+    for (size_t pos = 0; pos < numPrims; pos++)
+    {
+        const hcclPrim_t& prim   = m_prims[pos];
+        const int         type   = prim->type();
+        const PrimAccess& access = accesses[pos];
+
+        // prims of the same type keep their order, peers match scaleup and scaleout prims by order
+        int lowerBound = lastOfType[type] + 1;
+        for (hcclSyncInfo* sync : prim->signalers())
+        {
+            lowerBound = std::max(lowerBound, execOf[positions[sync->m_signaler->primIdx()]]);
+        }
+        // prims that touch the same data keep their order, in the same exec set only if ordered by a wait
+        for (size_t prev = 0; prev < pos; prev++)
+        {
+            const PrimAccess& prevAccess = accesses[prev];
+            if (overlaps(prevAccess.writes, access.reads) || overlaps(prevAccess.writes, access.writes) ||
+                overlaps(prevAccess.reads, access.writes))
+            {
+                lowerBound = std::max(lowerBound, execOf[prev] + (ancestors[pos][prev] ? 0 : 1));
+            }
+        }
+
+        unsigned waiterTypes = 0;
+        for (hcclSyncInfo* sync : prim->waiters())
+        {
+            if (sync->m_waiter->type() != type) waiterTypes |= 1 << sync->m_waiter->type();
+        }
+
+        auto fits = [&](const size_t exec, const bool withWaiters) {
+            if (exec == slots.size()) return true;
+            const auto& execSlots = slots[exec];
+            if (execSlots[type] != FREE_SLOT) return false;
+            for (int waiterType = 0; withWaiters && waiterType < NUM_PRIM_TYPES; waiterType++)
+            {
+                if ((waiterTypes & (1 << waiterType)) && execSlots[waiterType] != FREE_SLOT) return false;
+            }
+            // an exec set holds a single scaleup pool buffer
+            if (access.tempBuffer != UINT64_MAX && tempOfExec[exec] != UINT64_MAX &&
+                tempOfExec[exec] != access.tempBuffer)
+            {
+                return false;
+            }
+            // the reduction shares the recv slice, so it only joins a recv it waits on
+            if (type == REDUCTION_PRIM_TYPE && execSlots[SCALEOUT_RECV_PRIM_TYPE] != FREE_SLOT &&
+                !ancestors[pos][execSlots[SCALEOUT_RECV_PRIM_TYPE]])
+            {
+                return false;
+            }
+            if (type == SCALEOUT_RECV_PRIM_TYPE && execSlots[REDUCTION_PRIM_TYPE] != FREE_SLOT) return false;
+            return true;
+        };
+
+        int exec = lowerBound;
+        if (access.tempBuffer != UINT64_MAX && execOfTemp.count(access.tempBuffer) > 0)
+        {
+            // all users of a TEMP_BUFFER share the exec set that owns it
+            exec = execOfTemp[access.tempBuffer];
+            if (exec < lowerBound || !fits(exec, false))
+            {
+                LOG_HCL_DEBUG(HCL, "can't place prim {} with its TEMP_BUFFER in exec set {}", prim->primIdx(), exec);
+                return false;
+            }
+        }
+        else
+        {
+            while (!fits(exec, true))
+            {
+                exec++;
+            }
+        }
+
+        if ((size_t)exec == slots.size())
+        {
+            slots.emplace_back();
+            slots.back().fill(FREE_SLOT);
+            tempOfExec.push_back(UINT64_MAX);
+        }
+        slots[exec][type] = pos;
+        execOf[pos]       = exec;
+        lastOfType[type]  = exec;
+        if (access.tempBuffer != UINT64_MAX)
+        {
+            tempOfExec[exec]              = access.tempBuffer;
+            execOfTemp[access.tempBuffer] = exec;
+        }
+    }
+
+    m_completionSets.resize(slots.size());
+    for (size_t pos = 0; pos < numPrims; pos++)
+    {
+        m_completionSets[execOf[pos]].prims.push_back(m_prims[pos]);
+        m_prims[pos]->setExecSet(execOf[pos]);
+        LOG_HCL_DEBUG(HCL,
+                      "set prim {} of type {} to exec set {}",
+                      m_prims[pos]->primIdx(),
+                      m_prims[pos]->type(),
+                      m_prims[pos]->execSet());
+    }
+    return true;
+}
+
+void HcclGraph::verifyExecSets()
+{
+    const auto              positions = primPositions();
+    const auto              ancestors = primAncestors(positions);
+    std::vector<PrimAccess> accesses;
+    for (const hcclPrim_t& prim : m_prims)
+    {
+        accesses.push_back(primAccess(prim));
+    }
+
+    std::map<uint64_t, int> execOfTemp;
+    for (size_t pos = 0; pos < m_prims.size(); pos++)
+    {
+        const hcclPrim_t& prim = m_prims[pos];
+        const int         exec = prim->execSet();
+        VERIFY(exec >= 0 && (size_t)exec < m_completionSets.size(), "prim {} has no exec set", prim->primIdx());
+
+        for (hcclSyncInfo* sync : prim->signalers())
+        {
+            VERIFY(sync->m_signaler->execSet() <= exec,
+                   "prim {} in exec set {} waits on prim {} of the later exec set {}",
+                   prim->primIdx(),
+                   exec,
+                   sync->m_signaler->primIdx(),
+                   sync->m_signaler->execSet());
+        }
+
+        // the optimized graph drops waits implied by the others, so the ancestors are the ones of the user's graph
+        for (size_t prev = 0; prev < pos; prev++)
+        {
+            const PrimAccess& prevAccess = accesses[prev];
+            const int         prevExec   = m_prims[prev]->execSet();
+            if (overlaps(prevAccess.writes, accesses[pos].reads) || overlaps(prevAccess.writes, accesses[pos].writes) ||
+                overlaps(prevAccess.reads, accesses[pos].writes))
+            {
+                VERIFY(prevExec < exec || (prevExec == exec && ancestors[pos][prev]),
+                       "prim {} in exec set {} is not ordered after prim {} in exec set {} which uses the same data",
+                       prim->primIdx(),
+                       exec,
+                       m_prims[prev]->primIdx(),
+                       prevExec);
+            }
+        }
+
+        const uint64_t tempBuffer = accesses[pos].tempBuffer;
+        if (tempBuffer != UINT64_MAX)
+        {
+            const int tempExec = execOfTemp.emplace(tempBuffer, exec).first->second;
+            VERIFY(tempExec == exec,
+                   "TEMP_BUFFER {} is used in exec sets {} and {}, prim {}",
+                   tempBuffer,
+                   tempExec,
+                   exec,
+                   prim->primIdx());
+        }
+    }
+}
+
+void HcclGraph::optimize()
+{
+    const size_t waitsBefore = countWaits();
+    setupExecSets();
+    const size_t execSetsBefore = m_completionSets.size();
+    resetExecSets();
+
+    const unsigned dropped = eliminateWaits();
+    if (scheduleExecSets())
+    {
+        verifyExecSets();
+    }
+    else
+    {
+        resetExecSets();
+        setupExecSets();
+    }
+
+    const size_t waitsAfter    = countWaits();
+    const size_t execSetsAfter = m_completionSets.size();
+    LOG_HCL_DEBUG(HCL,
+                  "graph optimized, waits {} -> {} (dropped {}), exec sets {} -> {}",
+                  waitsBefore,
+                  waitsAfter,
+                  dropped,
+                  execSetsBefore,
+                  execSetsAfter);
+
+    if (GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW)
+    {
+        g_dbgStats.addCounter("primGraphWaitsBefore", waitsBefore);
+        g_dbgStats.addCounter("primGraphWaitsAfter", waitsAfter);
+        g_dbgStats.addCounter("primGraphExecSetsBefore", execSetsBefore);
+        g_dbgStats.addCounter("primGraphExecSetsAfter", execSetsAfter);
+    }
+}
+
 int HcclGraph::getWaits(bool incRequests)
 {
     int oldVal = m_requestedWaits;
@@ -129,7 +129,32 @@ public:
 protected:
     void setupExecSets();
 
+    /**
+     * @brief Graph optimization pass, runs instead of setupExecSets when HCCL_PRIM_GRAPH_OPTIMIZE is set
+     *
+     * Drops waits implied by other waits and packs the prims into exec sets by their data dependencies instead of by
+     * creation order. Dependencies are derived from buffer token and address usage, so two prims that touch the same
+     * data keep their order. Falls back to setupExecSets if the packing can't satisfy the TEMP_BUFFER rules.
+     */
+    void optimize();
+
 private:
+    struct PrimAccess
+    {
+        std::vector<std::pair<uint64_t, uint64_t>> reads;   // [start, end)
+        std::vector<std::pair<uint64_t, uint64_t>> writes;  // [start, end)
+        uint64_t                                   tempBuffer = UINT64_MAX;  // TEMP_BUFFER index used by the prim
+    };
+
+    PrimAccess                     primAccess(const hcclPrim_t& prim);
+    std::vector<int>               primPositions();
+    std::vector<std::vector<bool>> primAncestors(const std::vector<int>& positions);
+    size_t                         countWaits();
+    void                           resetExecSets();
+    unsigned                       eliminateWaits();
+    bool                           scheduleExecSets();
+    void                           verifyExecSets();  // the packed exec sets keep every wait and data dependency
+
     IHcclGraphEngine*    m_graphEngine = nullptr;
     HclCollectiveParams* m_params      = nullptr;
     HcclGraphContext     m_graphContext;
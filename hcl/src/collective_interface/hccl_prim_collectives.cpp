@@ -2,8 +2,12 @@
 #include "collective_interface/hccl_graph.h"
 #include "hccl_prim_collectives.h"
 #include "collective_interface/collectives/all_reduce.h"
+#include "collective_interface/collectives/reduce_scatter.h"
+#include "collective_interface/collectives/all_gather.h"
 
-static primCollectiveImpl_t methodsMap = {{eHCLAllReduce, ar_runPairwise}};
+static primCollectiveImpl_t methodsMap = {{eHCLAllReduce, ar_runPairwise},
+                                          {eHCLReduceScatter, rs_runPairwise},
+                                          {eHCLAllGather, ag_runPairwise}};
 
 namespace HcclPrimitives
 {
@@ -21,6 +21,7 @@
 #include "collective_logger.h"
 #include "interfaces/hcl_unique_sorted_vector.h"
 #include "futex.h"
+#include "infra/hcl_comm_profiler.h"  // for CommPhaseTimes
 
 class IHcclCoordinatorClient
 {
@@ -62,6 +63,8 @@ public:
                                       bool&                    allReached,
                                       remote_counters_ranks_t& remoteRanksInfo) = 0;
 
+    virtual bool sendCommProfile(const CommPhaseTimes& times) = 0;
+
     class IMigrationCallback* migration_cb_ = nullptr;
 };
 
@@ -134,6 +134,7 @@ bool hlcp_client_t::exchangeRankInfo(int nranks, const RankInfoHeader& myRankInf
 
     RET_ON_FALSE(send_to_srv(cmd));
 
+    CommPhaseTimer barrierTimer(COMM_PHASE_INIT_RANK_DATA_BARRIER);
     wait_condition(cmd_comm_data_.completed_,
                    gcfg_.op_timeout,
                    fmt::format(FMT_COMPILE("comm: {}  receive comm data"), comm_id_));
@@ -165,6 +166,7 @@ bool hlcp_client_t::xchg_qps_conf(int                   nranks,
 
     RET_ON_FALSE(send_to_srv(cmd));
 
+    CommPhaseTimer barrierTimer(COMM_PHASE_INIT_QPS_DATA_BARRIER);
     wait_condition(cmd_qps_conf_.completed_,
                    gcfg_.op_timeout,
                    fmt::format(FMT_COMPILE("comm: {} recv QPs configuration"), comm_id_));
@@ -345,6 +347,15 @@ hcclResult_t hlcp_client_t::sendCollectiveLog(const HCL_CollectiveOp op,
     return hcclSuccess;
 }
 
+bool hlcp_client_t::sendCommProfile(const CommPhaseTimes& times)
+{
+    hlcp_comm_profile_param_t param;
+    param.rank  = rank_;
+    param.times = times;
+
+    return send_to_srv(hlcp_cmd_comm_profile_t(param));
+}
+
 bool hlcp_client_t::sendNicStateChange(const NicState& nicState)
 {
     CLNT_LOG("nic: {} {}", nicState.nic, nicState.state ? "up" : "down");
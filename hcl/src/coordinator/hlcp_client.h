@@ -75,6 +75,8 @@ public:  // IHcclCoordinatorClient
                                       bool&                    allReached,
                                       remote_counters_ranks_t& remoteRanksInfo) override;
 
+    virtual bool sendCommProfile(const CommPhaseTimes& times) override;
+
 public:                                                                               // coordinator_t
     virtual void on_command(hlcp_command_t& cmd, hlcp_t& connection) override;        // specific command
     virtual void on_message(const hlcp_message_t& msg, hlcp_t& connection) override;  // no payload
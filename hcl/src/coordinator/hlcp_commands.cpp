@@ -13,6 +13,7 @@ const char* cmd2str(cmdid_t id)
         {HLCP_NIC_STATE, "HLCP_NIC_STATE"},
         {HLCP_LOG_MSG, "HLCP_LOG_MSG"},
         {HLCP_COUNTERS_DATA, "HLCP_COUNTERS_DATA"},
+        {HLCP_COMM_PROFILE, "HLCP_COMM_PROFILE"},
     };
 
     return hlcp_cmd_names[id];
@@ -3,6 +3,7 @@
 #include "hcl_types.h"
 #include "hccl_internal_defs.h"
 #include "qp_migration.h"
+#include "infra/hcl_comm_profiler.h"
 
 const char* cmd2str(cmdid_t id);
 
@@ -190,6 +191,15 @@ struct hlcp_counters_param_t
 constexpr cmdid_t HLCP_COUNTERS_DATA = HLCP_BASE_CMD_ID + 80;  // client -> server; client -> client
 using hlcp_cmd_counters_t            = _hlcp_command_t<HLCP_COUNTERS_DATA, hlcp_counters_param_t>;
 
+// comm init phase times of a rank (HCL_COMM_PROFILE)
+struct hlcp_comm_profile_param_t
+{
+    HCL_Rank       rank = HCL_INVALID_RANK;
+    CommPhaseTimes times;
+};
+constexpr cmdid_t HLCP_COMM_PROFILE = HLCP_BASE_CMD_ID + 90;  // client -> server
+using hlcp_cmd_comm_profile_t       = _hlcp_command_t<HLCP_COMM_PROFILE, hlcp_comm_profile_param_t>;
+
 //
 // To add a new command:
 //
@@ -67,6 +67,8 @@ uint32_t hlcp_server_t::comm_init(uint32_t comm_size)
 
     ranks_connections_.resize(comm_size);
     ranks_counters_.resize(comm_size);
+    ranks_profiles_.assign(comm_size, CommPhaseTimes());
+    cnt_profiled_ranks_ = 0;
 
     for (auto& refVec : ranks_connections_)
     {
@@ -202,6 +204,7 @@ void hlcp_server_t::comm_reset()
     ranks_headers_.clear();
     ranks_connections_.clear();
     ranks_counters_.clear();
+    ranks_profiles_.clear();
     std::fill(failed_ports_.begin(), failed_ports_.end(), 0);
 }
 
@@ -352,7 +355,6 @@ bool hlcp_server_t::check_counters()
 void hlcp_server_t::on_hlcp_counters(hlcp_cmd_counters_t& cmd)
 {
     const uint32_t remote_size = cmd.payload_size() - sizeof(FtSyncCountersInfoHeader);
-    VERIFY(remote_size == sizeof(FtSyncCountersRemoteInfo) * comm_size_);
 
     SRV_LOG("cmd: payload()={:p}, payload_size()={}, remote_size={}", cmd.payload(), cmd.payload_size(), remote_size);
 
@@ -374,6 +376,18 @@ void hlcp_server_t::on_hlcp_counters(hlcp_cmd_counters_t& cmd)
     const HCL_Rank send_rank = buffer.localInfo.hcclRank;
 
     VERIFY(send_rank < comm_size_, "rank_id({}) is out of range({})", send_rank, comm_size_);
+    if (buffer.localInfo.deltaCounters)
+    {
+        VERIFY(remote_size % sizeof(FtSyncCountersDeltaEntry) == 0 &&
+                   remote_size <= sizeof(FtSyncCountersDeltaEntry) * comm_size_,
+               "rank {} invalid counters delta size {}",
+               send_rank,
+               remote_size);
+    }
+    else
+    {
+        VERIFY(remote_size == sizeof(FtSyncCountersRemoteInfo) * comm_size_);
+    }
 
     const bool all_ranks_reported =
         ((++cnt_synched_ranks_) == comm_size_);  // If we got all ranks reporting their FT status
@@ -387,21 +401,42 @@ void hlcp_server_t::on_hlcp_counters(hlcp_cmd_counters_t& cmd)
             buffer.localInfo.myCountersVersion,
             all_ranks_reported);
 
-    // Cache in remote devices info
-    for (uint32_t rank = 0; rank < comm_size_; rank++)
+    // Cache in remote devices info. A delta carries only the peers whose counters changed, the rest stay cached from
+    // the previous exchange of this rank
+    if (buffer.localInfo.deltaCounters)
+    {
+        const FtSyncCountersDeltaEntry* entries =
+            reinterpret_cast<const FtSyncCountersDeltaEntry*>(&buffer.remoteInfo[0]);
+        const uint32_t num_entries = remote_size / sizeof(FtSyncCountersDeltaEntry);
+        SRV_LOG("rank: {} counters delta of {} peers", send_rank, num_entries);
+
+        for (uint32_t rank = 0; rank < comm_size_; rank++)
+        {
+            ranks_counters_[rank][send_rank].header = buffer.localInfo;
+        }
+        for (uint32_t i = 0; i < num_entries; i++)
+        {
+            VERIFY(entries[i].rank < comm_size_, "rank {} delta peer {} is out of range", send_rank, entries[i].rank);
+            ranks_counters_[entries[i].rank][send_rank].remoteInfo = entries[i].remoteInfo;
+        }
+    }
+    else
     {
-        ranks_counters_[rank][send_rank].header     = buffer.localInfo;
-        ranks_counters_[rank][send_rank].remoteInfo = buffer.remoteInfo[rank];
-        if (unlikely(LOG_LEVEL_AT_LEAST_TRACE(HCL)))
+        for (uint32_t rank = 0; rank < comm_size_; rank++)
         {
-            if (buffer.remoteInfo[rank].counters.send > 0 || buffer.remoteInfo[rank].counters.recv > 0)
+            ranks_counters_[rank][send_rank].header     = buffer.localInfo;
+            ranks_counters_[rank][send_rank].remoteInfo = buffer.remoteInfo[rank];
+            if (unlikely(LOG_LEVEL_AT_LEAST_TRACE(HCL)))
             {
-                SRV_LOG("Received S/R buffer of rank {}, send[{}]=(0x{:x}), recv=[{}]=(0x{:x})",
-                        rank,
-                        send_rank,
-                        buffer.remoteInfo[rank].counters.send,
-                        send_rank,
-                        buffer.remoteInfo[rank].counters.recv);
+                if (buffer.remoteInfo[rank].counters.send > 0 || buffer.remoteInfo[rank].counters.recv > 0)
+                {
+                    SRV_LOG("Received S/R buffer of rank {}, send[{}]=(0x{:x}), recv=[{}]=(0x{:x})",
+                            rank,
+                            send_rank,
+                            buffer.remoteInfo[rank].counters.send,
+                            send_rank,
+                            buffer.remoteInfo[rank].counters.recv);
+                }
             }
         }
     }
@@ -442,6 +477,25 @@ void hlcp_server_t::on_hlcp_log_msg(hlcp_cmd_log_msg_t& cmd)
     collective_logger_.processLogMessage(msg);
 }
 
+void hlcp_server_t::on_hlcp_comm_profile(hlcp_cmd_comm_profile_t& cmd)
+{
+    const HCL_Rank rank = cmd.param_.rank;
+
+    VERIFY(rank < comm_size_, "rank_id({}) is out of range({})", rank, comm_size_);
+
+    ranks_profiles_[rank] = cmd.param_.times;
+
+    const uint64_t done = ++cnt_profiled_ranks_;
+    SRV_LOG("rank:{} profile ({} of {})", rank, done, comm_size_);
+
+    // The last rank builds the report, every rank reports once per comm init
+    if (done == comm_size_)
+    {
+        cnt_profiled_ranks_ = 0;
+        CommProfiler::emitReport(comm_id_, CommProfiler::report(comm_id_, ranks_profiles_));
+    }
+}
+
 #define set_bit(value, nbit, on) ((on) ? ((value) |= (1ULL << (nbit))) : ((value) &= ~(1ULL << (nbit))))
 
 // this function returns zero only in 2 cases:
@@ -477,6 +531,7 @@ void hlcp_server_t::on_command(hlcp_command_t& cmd, hlcp_t& connection)
         HLCP_CMD_HANDLER(HLCP_LOG_MSG, hlcp_cmd_log_msg_t, on_hlcp_log_msg);
         HLCP_CMD_HANDLER(HLCP_SYNC, hlcp_cmd_sync_t, on_hlcp_sync);
         HLCP_CMD_HANDLER(HLCP_COUNTERS_DATA, hlcp_cmd_counters_t, on_hlcp_counters);
+        HLCP_CMD_HANDLER(HLCP_COMM_PROFILE, hlcp_cmd_comm_profile_t, on_hlcp_comm_profile);
     }
 }
 
@@ -496,6 +551,7 @@ void hlcp_server_t::on_message(const hlcp_message_t& msg, hlcp_t& connection)
         HLCP_MSG_HANDLER(HLCP_SYNC, hlcp_cmd_sync_t);
         HLCP_MSG_HANDLER(HLCP_LOG_MSG, hlcp_cmd_log_msg_t);
         HLCP_MSG_HANDLER(HLCP_NIC_STATE, hlcp_cmd_nic_state_t);
+        HLCP_MSG_HANDLER(HLCP_COMM_PROFILE, hlcp_cmd_comm_profile_t);
 
         HLCP_MSG_PAYLOAD_HANDLER(HLCP_QPS_CONF, hlcp_cmd_qps_conf_t);
         HLCP_MSG_PAYLOAD_HANDLER(HLCP_COUNTERS_DATA, hlcp_cmd_counters_t);
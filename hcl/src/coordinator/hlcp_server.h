@@ -69,6 +69,8 @@ private:
     ranks_headers_t                 ranks_headers_;
     remote_devices_array_t          ranks_connections_;
     remote_devices_counters_cache_t ranks_counters_;
+    std::vector<CommPhaseTimes>     ranks_profiles_;
+    counter_t                       cnt_profiled_ranks_ = 0;
 
     CollectiveLogger collective_logger_;
 
@@ -82,6 +84,7 @@ private:
     void on_hlcp_log_msg(hlcp_cmd_log_msg_t& cmd);
     void on_hlcp_nic_state(hlcp_cmd_nic_state_t& cmd);
     void on_hlcp_counters(hlcp_cmd_counters_t& cmd);
+    void on_hlcp_comm_profile(hlcp_cmd_comm_profile_t& cmd);
 
     bool check_counters();
     void validate_comm_data();
@@ -105,6 +105,15 @@ hcclResult_t HCCL_API_CALL hcclCommInitRank_Original(hcclComm_t* comm, int nrank
     return hcclCommInitRank_Wrapper(comm, nranks, commId, rank);
 }
 
+hcclResult_t HCCL_API_CALL hcclCommInitRanks_Original(hcclComm_t*         comms,
+                                                      int                 ncomms,
+                                                      const int*          nranks,
+                                                      const hcclUniqueId* commIds,
+                                                      const int*          ranks)
+{
+    return hcclCommInitRanks_Wrapper(comms, ncomms, nranks, commIds, ranks);
+}
+
 hcclResult_t HCCL_API_CALL hcclCommInitAll_Original(hcclComm_t* comm, int ndev, const int* devlist)
 {
     return hcclCommInitAll_Wrapper(comm, ndev, devlist);
@@ -162,6 +171,16 @@ hcclResult_t HCCL_API_CALL hcclCommUserRank_Original(hcclComm_t comm, int* rank)
     return hcclCommUserRank_Wrapper(comm, rank);
 }
 
+hcclResult_t HCCL_API_CALL hcclCommSetPriority_Original(hcclComm_t comm, hcclPriority_t priority)
+{
+    return hcclCommSetPriority_Wrapper(comm, priority);
+}
+
+hcclResult_t HCCL_API_CALL hcclCommGetStats_Original(hcclComm_t comm, hcclCommStats_t* stats)
+{
+    return hcclCommGetStats_Wrapper(comm, stats);
+}
+
 int HCCL_API_CALL hcclLookupDMABuff_Original(uint64_t addr, uint64_t size, int* fd)
 {
     return hcclLookupDMABuff_Wrapper(addr, size, fd);
@@ -455,7 +474,10 @@ static struct hccl_functions_pointers default_functions_pointers_table = {
     .pfn_hcclDfaUpdateState             = hcclDfaUpdateState_Original,
     .pfn_hcclGetVersionString           = hcclGetVersionString_Original,
     .pfn_hcclCommFinalize               = hcclCommFinalize_Original,
-    .pfn_hcclDeviceInit                 = hcclDeviceInit_Original};
+    .pfn_hcclDeviceInit                 = hcclDeviceInit_Original,
+    .pfn_hcclCommSetPriority            = hcclCommSetPriority_Original,
+    .pfn_hcclCommGetStats               = hcclCommGetStats_Original,
+    .pfn_hcclCommInitRanks              = hcclCommInitRanks_Original};
 // functions_pointers_table will maintain the current functions pointers table
 // Initialized to the original functions
 static struct hccl_functions_pointers* functions_pointers_table = &default_functions_pointers_table;
@@ -541,6 +563,16 @@ hcclResult_t HCCL_API_CALL hcclCommInitRank_impl(hcclComm_t* comm, int nranks, h
     return (*functions_pointers_table->pfn_hcclCommInitRank)(comm, nranks, commId, rank);
 }
 
+hcclResult_t HCCL_API_CALL hcclCommInitRanks_impl(hcclComm_t*         comms,
+                                                  int                 ncomms,
+                                                  const int*          nranks,
+                                                  const hcclUniqueId* commIds,
+                                                  const int*          ranks)
+{
+    HCCL_StartShim();
+    return (*functions_pointers_table->pfn_hcclCommInitRanks)(comms, ncomms, nranks, commIds, ranks);
+}
+
 hcclResult_t HCCL_API_CALL hcclCommInitAll_impl(hcclComm_t* comm, int ndev, const int* devlist)
 {
     HCL_API_LOG_ENTRY("(&comm={:p}, ndev={}, &devlist={})", (void*)comm, ndev, (void*)devlist);
@@ -625,6 +657,18 @@ hcclResult_t HCCL_API_CALL hcclCommUserRank_impl(hcclComm_t comm, int* rank)
     return (*functions_pointers_table->pfn_hcclCommUserRank)(comm, rank);
 }
 
+hcclResult_t HCCL_API_CALL hcclCommSetPriority_impl(hcclComm_t comm, hcclPriority_t priority)
+{
+    HCL_API_LOG_ENTRY("(&comm={:p}, priority={})", (void*)comm, (int)priority);
+    return (*functions_pointers_table->pfn_hcclCommSetPriority)(comm, priority);
+}
+
+hcclResult_t HCCL_API_CALL hcclCommGetStats_impl(hcclComm_t comm, hcclCommStats_t* stats)
+{
+    HCL_API_LOG_ENTRY("(&comm={:p}, stats={:p})", (void*)comm, (void*)stats);
+    return (*functions_pointers_table->pfn_hcclCommGetStats)(comm, stats);
+}
+
 int HCCL_API_CALL hcclLookupDMABuff_impl(uint64_t addr, uint64_t size, int* fd)
 {
     HCL_API_LOG_ENTRY("(&addr={:p}, &size={:p})", (void*)addr, (void*)size);
@@ -16,6 +16,7 @@
 #include "hccl_communicator.h"                      // for hccl_communicator
 #include "hccl_internal_defs.h"                     // for hcclOpParams, eHCCL...
 #include "hccl_types.h"                             // for hcclResult_t, hcclS...
+#include "hccl_helpers.h"                           // for to_data_movement_type
 #include "platform/gen2_arch_common/hccl_device.h"  // for HclApi
 #include "hcl_api_types.h"                          // for eHCLNoFlag, HCL_Rank
 #include "hcl_global_conf.h"                        // for GCFG_BOX_TYPE_ID
@@ -33,6 +34,8 @@ hcclResult_t hccl_communicator::allreduce(const void*    sendbuff,
                                           const uint32_t flags,
                                           uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsAllReduce, count * dataTypeSizeInBytes(dataType));
+
     HclCollectiveParams params(eHCLAllReduce,
                                stream_handle,
                                reinterpret_cast<uint64_t>(sendbuff),
@@ -57,6 +60,8 @@ hcclResult_t hccl_communicator::reduce(const void*    sendbuff,
                                        const uint32_t flags,
                                        uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsReduce, count * dataTypeSizeInBytes(dataType));
+
     HclCollectiveParams params(eHCLReduce,
                                stream_handle,
                                reinterpret_cast<uint64_t>(sendbuff),
@@ -81,6 +86,10 @@ hcclResult_t hccl_communicator::reduce_scatter(const void*    sendBuff,
                                                const uint32_t flags,
                                                uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(),
+                                  hcclStatsReduceScatter,
+                                  recvCount * dataTypeSizeInBytes(dataType));
+
     size_t communicatorSize = m_commSize;
 
     // HCCL receives `recvCount`, which is the number of elements produced in the output buffer - just like NCCL does.
@@ -110,6 +119,9 @@ hcclResult_t hccl_communicator::alltoall(const void*    sendbuff,
                                          const uint32_t flags,
                                          uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsAlltoAll, count * dataTypeSizeInBytes(dataType));
+    dataType = to_data_movement_type(dataType, count);
+
     HclCollectiveParams params(eHCLAll2All,
                                stream_handle,
                                reinterpret_cast<uint64_t>(sendbuff),
@@ -134,6 +146,9 @@ hcclResult_t hccl_communicator::broadcast(const void*    sendbuff,
                                           const uint32_t flags,
                                           uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsBroadcast, count * dataTypeSizeInBytes(dataType));
+    dataType = to_data_movement_type(dataType, count);
+
     HclCollectiveParams params(eHCLBroadcast,
                                stream_handle,
                                (uint64_t)sendbuff,
@@ -157,6 +172,9 @@ hcclResult_t hccl_communicator::allgather(const void*    sendBuff,
                                           const uint32_t flags,
                                           uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsAllGather, sendCount * dataTypeSizeInBytes(dataType));
+    dataType = to_data_movement_type(dataType, sendCount);
+
     HclCollectiveParams params(eHCLAllGather,
                                streamHandle,
                                reinterpret_cast<uint64_t>(sendBuff),
@@ -55,7 +55,15 @@
         }                                                                                                              \
     }
 
-std::unordered_map<HCL_Comm, spHcclCoordinatorClient> g_hcclCordClient;
+// communicators are initialized in parallel, so the map is only accessed through getHcclCordClient()
+static std::unordered_map<HCL_Comm, spHcclCoordinatorClient> s_hcclCordClient;
+static std::mutex                                            s_hcclCordClientMutex;
+
+spHcclCoordinatorClient getHcclCordClient(const HCL_Comm comm)
+{
+    std::lock_guard<std::mutex> lk(s_hcclCordClientMutex);
+    return s_hcclCordClient[comm];
+}
 
 hcclResult_t hccl_communicator::exchangeRankData(RankInfoHeader&              header,
                                                  std::vector<RankInfoHeader>& hcclRankInfoHeaders)
@@ -137,11 +145,13 @@ hcclResult_t hccl_communicator::exchangeQpsData(bool isLoopbackModeOrNullSubmiss
 
     prepareQPsInfo(rankInfoBuffer);
 
+    CommPhaseTimer qpsDataTimer(COMM_PHASE_INIT_QPS_DATA);
     if (!m_coordClient->exchangeQpsInfo(m_commSize, rankInfoBuffer, rankInfoBufferSize, hcclRemoteDevices))
     {
         LOG_HCL_ERR(HCL, "Comm {}, failed to exchange QPs info with remote ranks", (const HCL_Comm)(*m_comm));
         return hcclInternalError;
     }
+    qpsDataTimer.stop();
 
     // update current rank info in the "remote device", just for completeness
     m_comm->m_remoteDevices[m_comm->m_rankInfo.header.hcclRank]->device = m_comm->m_rankInfo.device;
@@ -150,6 +160,8 @@ hcclResult_t hccl_communicator::exchangeQpsData(bool isLoopbackModeOrNullSubmiss
 
     updateRemoteDevicesConnections(hcclRemoteDevices);
 
+    CommPhaseTimer connectTimer(COMM_PHASE_INIT_CONNECT_QPS);
+    locker_t       setupLocker(hccl_ctx.comm_setup_lock());
     return hccl_device()->connectCommQps(*m_comm);
 }
 
@@ -272,7 +284,10 @@ hcclResult_t hccl_communicator::finalizeInitialization(bool isLoopbackModeOrNull
 
     if (!isLoopbackModeOrNullSubmission)
     {
-        g_hcclCordClient[*m_comm] = m_coordClient;
+        {
+            std::lock_guard<std::mutex> lk(s_hcclCordClientMutex);
+            s_hcclCordClient[*m_comm] = m_coordClient;
+        }
 
         // Sync ranks on bootstrap end to make sure all data was processed by all ranks data.
         LOG_HCL_DEBUG(HCL, "Comm {} Sync using bootstrap - finalize comm init rank", (const HCL_Comm)(*m_comm));
@@ -318,14 +333,18 @@ hcclResult_t hccl_communicator::update_comm()
     const CommIds commIds = getCommIds();
     LOG_HCL_TRACE(HCL, COMM_ID_FMT "Started", commIds.commId, commIds.commIdPort);
 
-    hccl_device()->deleteCommConnections(*m_comm);
-    hccl_device()->invalidateCache(*m_comm);
-    hccl_device().invalidateGraphCacheForComm(*m_comm);
+    {
+        locker_t setupLocker(hccl_ctx.comm_setup_lock());
 
-    const uint64_t accumulatedGoodMask = ~m_failedPorts;
-    m_comm->getCommConnectivity().updateScaleOutPortsMask(hccl_device()->getServerConnectivity(),
-                                                          nics_mask_t(accumulatedGoodMask));
-    RET_ON_FAIL(hccl_device()->IHclDevice::openQpToRemoteRanks(*m_comm));
+        hccl_device()->deleteCommConnections(*m_comm);
+        hccl_device()->invalidateCache(*m_comm);
+        hccl_device().invalidateGraphCacheForComm(*m_comm);
+
+        const uint64_t accumulatedGoodMask = ~m_failedPorts;
+        m_comm->getCommConnectivity().updateScaleOutPortsMask(hccl_device()->getServerConnectivity(),
+                                                              nics_mask_t(accumulatedGoodMask));
+        RET_ON_FAIL(hccl_device()->IHclDevice::openQpToRemoteRanks(*m_comm));
+    }
 
     RET_ON_FAIL(exchangeQpsData(false));
     LOG_HCL_TRACE(HCL, COMM_ID_FMT "Before rendezvous", commIds.commId, commIds.commIdPort);
@@ -350,18 +369,29 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
 
     hccl_device()->getDeviceConfig().fillDeviceInfo(header);
 
+    // Other communicators may be initialized in parallel. The device setup steps are serialized by the comm setup
+    // lock, which is not held while waiting for the remote ranks (bootstrap, handshakes and final barrier).
+    locker_t setupLocker(hccl_ctx.comm_setup_lock());
+
+    CommPhaseTimer deviceCommTimer(COMM_PHASE_INIT_DEVICE_COMM);
     const HCL_Comm hclCommId = hccl_device()->allocateNewComm();
     g_ibv.on_comm_init(hclCommId);
 
     const size_t qpCommSize = isLoopbackMode() ? GCFG_LOOPBACK_COMMUNICATOR_SIZE.value() : m_commSize;
 
     hccl_device()->setQpManagersForComm(hclCommId, qpCommSize);
+    deviceCommTimer.stop();
+    setupLocker.unlock();
 
+    CommPhaseTimer bootstrapTimer(COMM_PHASE_INIT_BOOTSTRAP);
     m_coordClient = std::make_shared<hlcp_client_t>(hclCommId, m_commSize, m_rank, internal_unique_id, (*this));
+    bootstrapTimer.stop();
 
     // First Handshake
+    CommPhaseTimer rankDataTimer(COMM_PHASE_INIT_RANK_DATA);
     rc = exchangeRankData(header, hcclRankInfoHeaders);
     if (rc != hcclSuccess) return rc;
+    rankDataTimer.stop();
 
     LOG_HCL_INFO(HCL_COORD, "Comm {} Rank Communicator handshake1 done", hclCommId);
 
@@ -377,6 +407,8 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
     }
 
     // Initialize HclConfig
+    setupLocker.lock();
+    CommPhaseTimer commSetupTimer(COMM_PHASE_INIT_COMM_SETUP);
     HclConfig config;
     if (!config.init(rank, commSize))
     {
@@ -416,19 +448,25 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
         LOG_HCL_ERR(HCL, "Comm {}, device onNewCommStart failed", hclCommId);
         return rc;
     }
+    commSetupTimer.stop();
 
+    CommPhaseTimer connectivityTimer(COMM_PHASE_INIT_CONNECTIVITY);
     if (!isLoopbackModeOrNullSubmission)
     {
         RET_ON_FAIL(updateScaleoutPortMask(hcclRankInfoHeaders));
     }
 
     initializeRanks(hcclRankInfoHeaders, commSize, isLoopbackModeOrNullSubmission);
+    connectivityTimer.stop();
 
     std::vector<RemoteDeviceConnectionInfo> hcclRemoteDevices(m_commSize);
 
     LOG_HCL_INFO(HCL_COORD, "Comm {} Rank initializeConnections start", hclCommId);
+    CommPhaseTimer connectionsTimer(COMM_PHASE_INIT_CONNECTIONS);
     rc = initializeConnections(isLoopbackModeOrNullSubmission);
     if (rc != hcclSuccess) return rc;
+    connectionsTimer.stop();
+    setupLocker.unlock();
 
     // Second Handshake
     LOG_HCL_INFO(HCL_COORD, "Comm {} Rank Communicator handshake2 start", hclCommId);
@@ -436,10 +474,19 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
     if (rc != hcclSuccess) return rc;
     LOG_HCL_INFO(HCL_COORD, "Comm {} Rank Communicator handshake2 done", hclCommId);
 
+    if (!isLoopbackModeOrNullSubmission)
+    {
+        RET_ON_FAIL(m_comm->validateBoxRing());
+    }
+
+    CommPhaseTimer finalBarrierTimer(COMM_PHASE_INIT_FINAL_BARRIER);
     rc = finalizeInitialization(isLoopbackModeOrNullSubmission);
     if (rc != hcclSuccess) return rc;
+    finalBarrierTimer.stop();
     LOG_HCL_INFO(HCL_COORD, "Comm {} Rank Communicator init done", hclCommId);
 
+    setupLocker.lock();
+    CommPhaseTimer deviceTimer(COMM_PHASE_INIT_DEVICE);
     hccl_device()->faultToleranceCommInit(hclCommId);
 
     // initial internal data structures for new communicator
@@ -448,6 +495,21 @@ hcclResult_t hccl_communicator::initialize(const internal_unique_id_t* internal_
     return rc;
 }
 
+void hccl_communicator::reportInitProfile()
+{
+    CommProfiler* profiler = getProfiler();
+    if (profiler == nullptr) return;
+
+    profiler->log(COMM_PHASE_INIT, *m_comm, m_rank);
+
+    // The coordinator aggregates the report of all ranks, it is not started in loopback / null submission
+    const bool isLoopbackModeOrNullSubmission = (isLoopbackMode() || GCFG_HCL_NULL_SUBMIT.value());
+    if (!isLoopbackModeOrNullSubmission && !m_coordClient->sendCommProfile(profiler->times()))
+    {
+        LOG_HCL_WARN(HCL, "Comm {} failed to send init profile to coordinator", (const HCL_Comm)(*m_comm));
+    }
+}
+
 void hccl_communicator::updateRemoteDevicesHeader(const std::vector<RankInfoHeader>& hcclRankInfo)
 {
     for (unsigned rank = 0; rank < m_commSize; rank++)
@@ -631,6 +693,26 @@ hcclResult_t hccl_communicator::comm_user_rank(int* rank)
     return hcclSuccess;
 }
 
+hcclResult_t hccl_communicator::comm_set_priority(hcclPriority_t priority)
+{
+    RETURN_ON_INVALID_ARG(priority < hcclPriorityDefault || priority >= hcclNumPriorities, priority, "Unknown class.");
+    m_comm->setPriority(priority);
+    LOG_HCL_DEBUG(HCL, "Comm {} priority set to {}", (const HCL_Comm)(*m_comm), (int)priority);
+    return hcclSuccess;
+}
+
+hcclResult_t hccl_communicator::comm_get_stats(hcclCommStats_t* stats)
+{
+    RETURN_ON_NULL_ARG(stats);
+    if (!m_comm->getStats().enabled())
+    {
+        LOG_HCL_ERR(HCL, "Comm {} statistics are disabled, set HCL_COMM_STATS=1", (const HCL_Comm)(*m_comm));
+        return hcclInvalidUsage;
+    }
+    m_comm->getStats().get(*stats);
+    return hcclSuccess;
+}
+
 int hccl_communicator::user_rank() const
 {
     return m_rank;
@@ -705,6 +787,14 @@ void hccl_communicator::initRanksExchangeBuffers(RanksExchangeBuffers& ranksExch
 
     ranksExchangeBuffers.getRemoteSyncCountersInfoBuffer().localInfo          = FtSyncCountersInfoHeader();
     ranksExchangeBuffers.getRemoteSyncCountersInfoBuffer().localInfo.hcclRank = m_rank;
+
+    if (GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value())
+    {
+        const uint32_t deltaBufferSize =
+            sizeof(FtSyncCountersInfoHeader) + sizeof(FtSyncCountersDeltaEntry) * m_commSize;
+        ranksExchangeBuffers.rankSyncCountersDeltaBuffer = std::make_unique<uint8_t[]>(deltaBufferSize);
+        std::fill_n(ranksExchangeBuffers.rankSyncCountersDeltaBuffer.get(), deltaBufferSize, 0);
+    }
 }
 
 void hccl_communicator::updateMigrationAndCountersDataAndExchangeBuffers(RanksExchangeBuffers& ranksExchangeInfo,
@@ -770,11 +860,9 @@ bool hccl_communicator::updateReachedTargetAndExchangeBuffers(const bool
     // Exchange data with the other ranks in this comm
     bool                     allRanksDone = false;
     remote_counters_ranks_t& remoteRanksInfo(ranksExchangeInfo.remoteSyncCounters);  // receive buffers
-    if (!m_coordClient->exchangeCountersData(m_commSize,
-                                             remoteSyncCountersInfoBuffer,
-                                             ranksExchangeInfo.mySyncCountersBufferSize,
-                                             allRanksDone,
-                                             remoteRanksInfo))
+    uint32_t                 sendBufferSize = 0;
+    const FtRanksInfoBuffer& sendBuffer     = faultToleranceSyncCountersToSend(ranksExchangeInfo, sendBufferSize);
+    if (!m_coordClient->exchangeCountersData(m_commSize, sendBuffer, sendBufferSize, allRanksDone, remoteRanksInfo))
     {
         HLFT_COMM_ERR("exchangeCountersData - ranks exchange data failed", commIds);
         // Handle error case - VERIFY abort possibly, since xchg_counters_data will abort with error before ?
@@ -800,6 +888,53 @@ bool hccl_communicator::updateReachedTargetAndExchangeBuffers(const bool
     return allRanksDone;
 }
 
+// The first counters exchange of a failover carries the s/r counters to all ranks. With fast failover, the following
+// ones carry only the peers whose counters changed since, the coordinator keeps the rest from the previous exchange.
+const FtRanksInfoBuffer& hccl_communicator::faultToleranceSyncCountersToSend(RanksExchangeBuffers& ranksExchangeInfo,
+                                                                             uint32_t&             bufferSize) const
+{
+    const CommIds      commIds    = getCommIds();
+    FtRanksInfoBuffer& fullBuffer = ranksExchangeInfo.getRemoteSyncCountersInfoBuffer();
+    bufferSize                    = ranksExchangeInfo.mySyncCountersBufferSize;
+
+    if (!GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value())
+    {
+        return fullBuffer;
+    }
+
+    std::vector<FtSyncCountersRemoteInfo>& lastSent = ranksExchangeInfo.lastSentSyncCounters;
+    if (lastSent.empty())
+    {
+        lastSent.assign(&fullBuffer.remoteInfo[0], &fullBuffer.remoteInfo[m_commSize]);
+        return fullBuffer;
+    }
+
+    FtRanksInfoBuffer& deltaBuffer      = ranksExchangeInfo.getSyncCountersDeltaBuffer();
+    deltaBuffer.localInfo               = fullBuffer.localInfo;
+    deltaBuffer.localInfo.deltaCounters = true;
+
+    FtSyncCountersDeltaEntry* entries    = reinterpret_cast<FtSyncCountersDeltaEntry*>(&deltaBuffer.remoteInfo[0]);
+    uint32_t                  numEntries = 0;
+    for (HCL_Rank rank = 0; rank < m_commSize; rank++)
+    {
+        const FtSyncCountersRemoteInfo& counters = fullBuffer.remoteInfo[rank];
+        if (counters.counters.send != lastSent[rank].counters.send ||
+            counters.counters.recv != lastSent[rank].counters.recv)
+        {
+            entries[numEntries++] = {rank, counters};
+            lastSent[rank]        = counters;
+        }
+    }
+    bufferSize = sizeof(FtSyncCountersInfoHeader) + sizeof(FtSyncCountersDeltaEntry) * numEntries;
+
+    HLFT_COMM_DBG("Counters delta of {} peers, bufferSize={} instead of {}",
+                  commIds,
+                  numEntries,
+                  bufferSize,
+                  ranksExchangeInfo.mySyncCountersBufferSize);
+    return deltaBuffer;
+}
+
 void hccl_communicator::faultTolerancePrepareMySendRecvCounters(RanksExchangeBuffers& ranksExchangeInfo) const
 {
     const CommIds commIds = getCommIds();
@@ -1066,7 +1201,14 @@ void hccl_communicator::mcNicStateShutdown(const uint32_t logicalPort)
     stopApis();
 
     // 2. Perform short sleep here to let main user thread update the counters before its blocked.
-    std::this_thread::sleep_for(std::chrono::milliseconds(GCFG_HCL_FAULT_TOLERANCE_DELAY_BEFORE_START.value()));
+    //    With fast failover, the migration QPs are created during this delay.
+    const bool fastFailover = GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value();
+    const auto startTime    = std::chrono::steady_clock::now() +
+                           std::chrono::milliseconds(GCFG_HCL_FAULT_TOLERANCE_DELAY_BEFORE_START.value());
+    if (!fastFailover)
+    {
+        std::this_thread::sleep_until(startTime);
+    }
 
     // 3. create_migration_qps();
     m_comm->m_dfaData.updateFailoverStep(FaultToleranceState::FTcreateMigrationQPs);
@@ -1074,6 +1216,11 @@ void hccl_communicator::mcNicStateShutdown(const uint32_t logicalPort)
     hccl_device()->createMigrationQps(commIds.commId, logicalPort);
     HLFT_COMM_HDR_INF("createMigrationQps done", commIds);
 
+    if (fastFailover)
+    {
+        std::this_thread::sleep_until(startTime);
+    }
+
     // 4. Exchange migration data and counters
     RanksExchangeBuffers ranksExchangeBuffers;
     initRanksExchangeBuffers(ranksExchangeBuffers);  // Init buffers for exchange
@@ -1127,8 +1274,11 @@ void hccl_communicator::mcNicStateShutdown(const uint32_t logicalPort)
         faultTolerancePrepareMySendRecvCounters(ranksExchangeBuffers);
         resumeUntil(maxRankApiCountersData);
 
-        HLFT_COMM_HDR_INF("sleep before next loop check", commIds);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));  // sleep to allow user threads to complete APIs
+        if (!GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value())  // otherwise the poll waits for the APIs
+        {
+            HLFT_COMM_HDR_INF("sleep before next loop check", commIds);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));  // sleep to allow user threads to complete
+        }
     }
 
     m_comm->m_dfaData.updateFailoverStep(FaultToleranceState::FTreachedTarget);
@@ -1147,7 +1297,10 @@ void hccl_communicator::mcNicStateShutdown(const uint32_t logicalPort)
     VERIFY_DFA(hcclSuccess == update_comm());
 
     // 13. Resume All API's
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));  // dummy sleep for testing
+    if (!GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));  // dummy sleep for testing
+    }
     resumeApis();
 
     // 14. Failover done
@@ -1213,8 +1366,11 @@ void hccl_communicator::mcNicStateUp(const uint32_t /*logicalPort*/)
         faultTolerancePrepareMySendRecvCounters(ranksExchangeBuffers);
         resumeUntil(maxRankApiCountersData);
 
-        HLFT_COMM_HDR_INF("Sleep before next loop check", commIds);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));  // sleep to allow user threads to complete APIs
+        if (!GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value())  // otherwise the poll waits for the APIs
+        {
+            HLFT_COMM_HDR_INF("Sleep before next loop check", commIds);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1000));  // sleep to allow user threads to complete
+        }
     }
 
     // 7. Synchronize long SO
@@ -1227,7 +1383,10 @@ void hccl_communicator::mcNicStateUp(const uint32_t /*logicalPort*/)
     HLFT_COMM_HDR_INF("Going to update_comm", commIds);
     VERIFY_DFA(hcclSuccess == update_comm());
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));  // dummy sleep for testing
+    if (!GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));  // dummy sleep for testing
+    }
 
     // 9. Resume All API's
     resumeApis();
@@ -1283,21 +1442,37 @@ bool hccl_communicator::faultTolerancePollUntilApiReach(const RankApiCounters&
 {
     const CommIds commIds = getCommIds();
 
-    FaultToleranceTargetCounters myCommCounters       = m_comm->getFaultToleranceTargetCounters();  // read first time
-    bool                         reachedEqualCounters = false;
+    const bool                   fastFailover    = GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER.value();
+    uint64_t                     countersVersion = 0;
+    FaultToleranceTargetCounters myCommCounters =
+        m_comm->getFaultToleranceTargetCounters(&countersVersion);  // read first time
+    bool reachedEqualCounters = false;
+    bool firstCheck           = true;
     while (true)
     {
-        HLFT_COMM_HDR_INF("Sleep before next check of API counters, remoteDevices.size={}, remoteRanksInfo.size={}",
-                          commIds,
-                          remoteDevices.size(),
-                          remoteRanksInfo.size());
-        std::this_thread::sleep_for(std::chrono::milliseconds(
-            GCFG_HCL_FAULT_TOLERANCE_COMM_POLL_INTERVAL.value()));  // sleep to allow user threads to complete APIs
-
-        HLFT_COMM_TRC("After sleep", commIds);
+        if (!fastFailover)
+        {
+            HLFT_COMM_HDR_INF("Sleep before next check of API counters, remoteDevices.size={}, remoteRanksInfo.size={}",
+                              commIds,
+                              remoteDevices.size(),
+                              remoteRanksInfo.size());
+            std::this_thread::sleep_for(std::chrono::milliseconds(
+                GCFG_HCL_FAULT_TOLERANCE_COMM_POLL_INTERVAL.value()));  // sleep to allow user threads to complete APIs
+
+            HLFT_COMM_TRC("After sleep", commIds);
+        }
+        else if (!firstCheck)
+        {
+            // Woken up by the user thread submitting the APIs, the poll interval is only a fallback
+            countersVersion = m_comm->waitFaultToleranceTargetCountersUpdate(
+                countersVersion,
+                std::chrono::milliseconds(GCFG_HCL_FAULT_TOLERANCE_COMM_POLL_INTERVAL.value()));
+            HLFT_COMM_TRC("After wait, countersVersion={}", commIds, countersVersion);
+        }
+        firstCheck = false;
 
         // Read Long SO stream counters and their matching API counters
-        myCommCounters = m_comm->getFaultToleranceTargetCounters();
+        myCommCounters = m_comm->getFaultToleranceTargetCounters(&countersVersion);
         myCommCounters.rankApiCountersData.logDebug(commIds, __FUNCTION__, "current.rankApiCountersData");
 
         const uint64_t myCollectivesCounter = myCommCounters.rankApiCountersData.collectivesCounter;
@@ -25,6 +25,7 @@
 #include "hcl_dynamic_communicator.h"             // for HclDynamicCommunicator
 #include "coordinator/qp_migration.h"             // for IMigrationCallback
 #include "coordinator_defs.h"
+#include "infra/hcl_comm_profiler.h"              // for CommProfiler
 
 enum TargetCountersCheckResult
 {
@@ -41,6 +42,16 @@ public:
 
     hcclResult_t initialize(const internal_unique_id_t* comm_unique_id);
 
+    /**
+     * @brief Phase profiler of this comm, nullptr unless HCL_COMM_PROFILE is set
+     */
+    CommProfiler* getProfiler() { return CommProfiler::enabled() ? &m_profiler : nullptr; }
+
+    /**
+     * @brief Log the init phases of this rank and send them to the coordinator for the comm report
+     */
+    void reportInitProfile();
+
     hcclResult_t sendCollectiveLogErr();
 
     bool destroy();
@@ -55,6 +66,8 @@ public:
     const char*  get_async_error_message();
 
     hcclResult_t comm_user_rank(int* rank);
+    hcclResult_t comm_set_priority(hcclPriority_t priority);
+    hcclResult_t comm_get_stats(hcclCommStats_t* stats);
 
     // * * * Collectives * * *
 
@@ -159,11 +172,17 @@ private:
         std::unique_ptr<uint8_t[]> rankSyncCountersSendBuffer = nullptr;  // Buffer for ranks sync counters exchange
         remote_devices_t        hcclRemoteDevices;  // Buffers we receive from the other ranks in migration QPs exchange
         remote_counters_ranks_t remoteSyncCounters;  // Buffers we receive from the other ranks for sync counters
+        std::unique_ptr<uint8_t[]> rankSyncCountersDeltaBuffer = nullptr;  // Changed s/r counters only, fast failover
+        std::vector<FtSyncCountersRemoteInfo> lastSentSyncCounters;  // s/r counters of the previous exchange
         RankInfoBuffer&         getRankInfoBuffer() { return (*((RankInfoBuffer*)(rankInfoSendBuffer.get()))); }
         FtRanksInfoBuffer&      getRemoteSyncCountersInfoBuffer()
         {
             return (*((FtRanksInfoBuffer*)(rankSyncCountersSendBuffer.get())));
         }
+        FtRanksInfoBuffer& getSyncCountersDeltaBuffer()
+        {
+            return (*((FtRanksInfoBuffer*)(rankSyncCountersDeltaBuffer.get())));
+        }
     };
 
     hcclResult_t openConnections(bool isLoopbackModeOrNullSubmission);
@@ -185,6 +204,8 @@ private:
     void updateMigrationAndCountersDataAndExchangeBuffers(RanksExchangeBuffers& ranksExchangeInfo, const bool failover);
     bool updateReachedTargetAndExchangeBuffers(const bool            reachedEqualCounters,
                                                RanksExchangeBuffers& ranksExchangeInfo);
+    const FtRanksInfoBuffer& faultToleranceSyncCountersToSend(RanksExchangeBuffers& ranksExchangeInfo,
+                                                              uint32_t&             bufferSize) const;
 
     bool rendezvous(bool migration_finished = false);
 
@@ -225,6 +246,7 @@ private:
     bool                    m_scaleout_available;
 
     HclDynamicCommunicator* m_comm = nullptr;
+    CommProfiler            m_profiler;
 
     std::condition_variable m_faultsStopCommApiCv;        // CV to block user API threads on specific comm
     std::mutex              m_faultsStopCommApiMutex;     // Mutex for above CV
@@ -14,9 +14,15 @@
 
 #include <arpa/inet.h>   // for inet_pton
 #include <netinet/in.h>  // for sockaddr_in, htons
+#include <algorithm>     // for fill
 #include <cstring>       // for memcpy
+#include <exception>     // for exception_ptr, rethrow_exception
+#include <mutex>         // for unique_lock
+#include <shared_mutex>  // for shared_lock
 #include <sys/socket.h>  // for AF_INET, sockaddr
+#include <thread>        // for thread
 #include <utility>       // for move
+#include <vector>        // for vector
 
 #include "hccl_communicator.h"       // for hccl_communicator
 #include "hccl_helpers.h"            // for RETURN_ON_ERROR, RETURN_ON_H...
@@ -94,7 +100,8 @@ hcclResult_t hccl_context::comm_init_rank(hcclComm_t* comm_handle, unsigned int
         return hcclInvalidArgument;
     }
 
-    locker_t locker(comm_init_lock_);  // serialize with updateNicState() from driver
+    // serialize with updateNicState() from driver, other communicators may be initialized in parallel
+    std::shared_lock<std::shared_mutex> locker(comm_init_lock_);
 
     const internal_unique_id_t*        internal_id = get_internal_id(comm_id);
     std::shared_ptr<hccl_communicator> spHcclComm(new hccl_communicator(rank, nranks));
@@ -104,11 +111,16 @@ hcclResult_t hccl_context::comm_init_rank(hcclComm_t* comm_handle, unsigned int
         return hcclInternalError;
     }
 
-    if (spHcclComm->initialize(internal_id) != hcclSuccess)
     {
-        LOG_HCL_ERR(HCL, "Initialization of hccl communicator failed.");
-        return hcclInternalError;
+        CommProfiler::Scope profilerScope(spHcclComm->getProfiler());
+        CommPhaseTimer      initTimer(COMM_PHASE_INIT);
+        if (spHcclComm->initialize(internal_id) != hcclSuccess)
+        {
+            LOG_HCL_ERR(HCL, "Initialization of hccl communicator failed.");
+            return hcclInternalError;
+        }
     }
+    spHcclComm->reportInitProfile();
 
     // for re-init case, use previous key
     *comm_handle = spHcclComm.get();
@@ -116,11 +128,14 @@ hcclResult_t hccl_context::comm_init_rank(hcclComm_t* comm_handle, unsigned int
         *comm_handle);  // Store back ptr to hccl_communicator in the dynamic comm, needed for fault tolerance
 
     // create a map entry as a pair of hcclComm key and hclComm key
-    hccl_communicators_[*comm_handle] = spHcclComm;
-    if (!first_comm_init_)
     {
-        first_comm_init_            = true;
-        first_coordinator_launched_ = true;
+        locker_t commsLocker(comms_lock_);
+        hccl_communicators_[*comm_handle] = spHcclComm;
+        if (!first_comm_init_)
+        {
+            first_comm_init_            = true;
+            first_coordinator_launched_ = true;
+        }
     }
 
     // log process memory
@@ -139,6 +154,80 @@ hcclResult_t hccl_context::comm_init_rank(hcclComm_t* comm_handle, unsigned int
     return hcclSuccess;
 }
 
+// Initializes ncomms communicators, each one on its own thread (unless HCL_COMM_INIT_PARALLEL is off).
+// The coordinator handshakes of a communicator overlap with the device setup of the others, so the ranks don't have to
+// create them in the same order. If any of them fails, the ones that were created are destroyed.
+hcclResult_t hccl_context::comm_init_ranks(hcclComm_t*   comm_handles,
+                                           unsigned      ncomms,
+                                           const int*    nranks,
+                                           hcclUniqueId* comm_ids,
+                                           const int*    ranks)
+{
+    std::vector<hcclResult_t>       results(ncomms, hcclSuccess);
+    std::vector<std::exception_ptr> exceptions(ncomms);
+    std::fill(comm_handles, comm_handles + ncomms, nullptr);  // entries that are not created stay null
+
+    auto initComm = [&](unsigned i) {
+        try
+        {
+            results[i] = comm_init_rank(&comm_handles[i], nranks[i], comm_ids[i], ranks[i]);
+        }
+        catch (...)
+        {
+            results[i]    = hcclInternalError;
+            exceptions[i] = std::current_exception();
+        }
+    };
+
+    if (GCFG_HCL_COMM_INIT_PARALLEL.value() && ncomms > 1)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(ncomms);
+        for (unsigned i = 0; i < ncomms; i++)
+        {
+            threads.emplace_back(initComm, i);
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    else
+    {
+        for (unsigned i = 0; i < ncomms; i++)
+        {
+            initComm(i);
+            if (results[i] != hcclSuccess) break;
+        }
+    }
+
+    hcclResult_t status = hcclSuccess;
+    for (unsigned i = 0; i < ncomms && status == hcclSuccess; i++)
+    {
+        status = results[i];
+    }
+    if (status == hcclSuccess)
+    {
+        LOG_HCL_INFO(HCL_API, "Created {} communicators", ncomms);
+        return hcclSuccess;
+    }
+
+    for (unsigned i = 0; i < ncomms; i++)
+    {
+        if (results[i] == hcclSuccess && comm_handles[i] != nullptr && comm_destroy(comm_handles[i]) == hcclSuccess)
+        {
+            comm_handles[i] = nullptr;
+        }
+    }
+    for (const std::exception_ptr& exception : exceptions)
+    {
+        if (exception) std::rethrow_exception(exception);
+    }
+
+    LOG_HCL_ERR(HCL, "Creation of {} communicators failed ({})", ncomms, status);
+    return status;
+}
+
 hccl_communicator* hccl_context::communicator(hcclComm_t comm_handle)
 {
     auto it = hccl_communicators_.find(comm_handle);
@@ -204,7 +293,7 @@ const internal_unique_id_t* hccl_context::get_internal_id(const hcclUniqueId& un
 
 hcclResult_t hccl_context::comm_destroy(hcclComm_t comm_handle)
 {
-    locker_t locker(comm_init_lock_);  // serialize with comm_init_rank
+    std::unique_lock<std::shared_mutex> locker(comm_init_lock_);  // serialize with comm_init_rank
 
     auto* hcclComm = communicator(comm_handle);
     if (hcclComm == nullptr)
@@ -225,14 +314,30 @@ hcclResult_t hccl_context::comm_destroy(hcclComm_t comm_handle)
             std::make_unique<std::lock_guard<std::mutex>>(hccl_device()->m_deviceController.getStreamLock(i)));
     }
 
+    CommProfiler* const profiler = hcclComm->getProfiler();
+    const HCL_Comm      hclComm  = *hcclComm->getDynamicComm();
+    CommProfiler::Scope profilerScope(profiler);
+    CommPhaseTimer      destroyTimer(COMM_PHASE_DESTROY);
+    CommPhaseTimer      finalizeTimer(COMM_PHASE_DESTROY_FINALIZE);
+
     // first destroy communicator
     hcclComm->finalize(false);
+    finalizeTimer.stop();
 
+    CommPhaseTimer deviceTimer(COMM_PHASE_DESTROY_DEVICE);
     if (!hcclComm->destroy())
     {
         LOG_HCL_ERR(HCL, "Destruction of hccl communicator failed.");
         return hcclInternalError;
     }
+    deviceTimer.stop();
+    destroyTimer.stop();
+
+    // destroy is not synchronized between ranks, so its profile is logged per rank only
+    if (profiler != nullptr)
+    {
+        profiler->log(COMM_PHASE_DESTROY, hclComm, hcclComm->user_rank());
+    }
 
     // clean mapped resources and handles
     // check if this is comm coordinator
@@ -375,10 +480,11 @@ void hccl_context::dfaLogHnicSummary(hl_logger::LoggerSPtr& logger)
     }
     if (info != nullptr)
     {
+        const ScaleoutProvider* const provider = hccl_device()->getScaleOutProvider();
         HLLOG_UNTYPED(logger,
                       HLLOG_LEVEL_INFO,
                       "Gaudi-direct is {}, HNIC domain_name={}, prov_name={}, active_mtu={}",
-                      hccl_device()->getScaleOutProvider()->isGaudiDirect() ? "enabled" : "disabled",
+                      provider->isGaudiDirect() ? "enabled" : (provider->isHybrid() ? "hybrid" : "disabled"),
                       info->domain_attr->name,
                       info->fabric_attr->prov_name,
                       info->nic->link_attr->mtu);
@@ -16,6 +16,7 @@
 #include <cstddef>       // for size_t
 #include <map>           // for map
 #include <memory>        // for shared_ptr, unique_ptr
+#include <shared_mutex>  // for shared_mutex
 #include <string>        // for string
 #include "hccl_types.h"  // for hcclResult_t, hcclU...
 #include "platform/gen2_arch_common/hccl_device.h"
@@ -42,6 +43,8 @@ public:
 
     hcclResult_t get_unique_id(hcclUniqueId* unique_id);
     hcclResult_t comm_init_rank(hcclComm_t* comm, unsigned int nranks, hcclUniqueId& comm_id, int rank);
+    hcclResult_t
+    comm_init_ranks(hcclComm_t* comms, unsigned ncomms, const int* nranks, hcclUniqueId* comm_ids, const int* ranks);
 
     hcclResult_t comm_destroy(hcclComm_t unique_id);
 
@@ -60,7 +63,8 @@ public:
 
     const comms_map_t& comms() const { return hccl_communicators_; };
 
-    lock_t& comm_init_lock() { return comm_init_lock_; }
+    std::shared_mutex& comm_init_lock() { return comm_init_lock_; }
+    lock_t&            comm_setup_lock() { return comm_setup_lock_; }
 
 private:
     bool first_coordinator_launched_ = false;
@@ -77,7 +81,16 @@ private:
     // communicators list mapped by comm handle
     comms_map_t hccl_communicators_;
 
-    lock_t comm_init_lock_;
+    // held shared by comm_init_rank, so communicators are initialized in parallel, and exclusive by whoever needs
+    // all of them initialized (comm_destroy, nic state changes)
+    std::shared_mutex comm_init_lock_;
+
+    // guards hccl_communicators_ and first_comm_init_ between parallel comm_init_rank calls
+    lock_t comms_lock_;
+
+    // serializes the device setup steps of communicators that are initialized in parallel, it is released while a
+    // communicator waits for its remote ranks so the other communicators make progress
+    lock_t comm_setup_lock_;
 
     // The following is an indication if this device was acquired by synapse successfully and it is then sets to true.
     // When the device is destroyed it is set to false
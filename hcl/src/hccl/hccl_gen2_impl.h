@@ -52,6 +52,13 @@ hcclResult_t hcclGetUniqueId_impl(hcclUniqueId* uniqueId);
  * called by different threads/processes or use hcclGroupStart/hcclGroupEnd. */
 hcclResult_t hcclCommInitRank_impl(hcclComm_t* comm, int nranks, hcclUniqueId commId, int rank);
 
+/* Creates ncomms communicators in one call, initializing them in parallel. */
+hcclResult_t hcclCommInitRanks_impl(hcclComm_t*         comms,
+                                    int                 ncomms,
+                                    const int*          nranks,
+                                    const hcclUniqueId* commIds,
+                                    const int*          ranks);
+
 /* Creates a clique of communicators (single process version).
  * This is a convenience function to create a single-process communicator clique.
  * Returns an array of ndev newly initialized communicators in comm.
@@ -93,6 +100,12 @@ hcclResult_t hcclCommSynDevice_impl(hcclComm_t comm, int* device);
 /* Returns the user-ordered "rank" associated with the communicator. */
 hcclResult_t hcclCommUserRank_impl(hcclComm_t comm, int* rank);
 
+/* Sets the priority class of the communicator's future operations. */
+hcclResult_t hcclCommSetPriority_impl(hcclComm_t comm, hcclPriority_t priority);
+
+/* Returns the cumulative counters of the communicator. */
+hcclResult_t hcclCommGetStats_impl(hcclComm_t comm, hcclCommStats_t* stats);
+
 /* Returns FD for HBM memory region if it was registered for gaudi-direct. */
 int hcclLookupDMABuff_impl(uint64_t addr, uint64_t size, int* fd);
 
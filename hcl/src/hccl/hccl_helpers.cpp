@@ -243,26 +243,24 @@ size_t hccl_data_type_elem_size(hcclDataType_t data_type)
     return 0;
 }
 
-hcclDataType_t from_hccl_data_type_for_emulation(hcclDataType_t data_type)
+hcclDataType_t to_data_movement_type(hcclDataType_t data_type, size_t& count)
 {
     switch (data_type)
     {
+        case hcclInt64:
+        case hcclUint64:
+        case hcclFloat64:
+            // moved as pairs of 32-bit elements, same bytes on the wire
+            count *= 2;
+            return hcclUint32;
         case hcclInt8:
         case hcclUint8:
-            return hcclBfloat16;
         case hcclInt32:
         case hcclUint32:
-        case hcclInt64:
-        case hcclUint64:
-            return hcclInt32;
         case hcclFloat16:
-            return hcclBfloat16;
         case hcclFloat32:
-            return hcclFloat32;
-        case hcclFloat64:
-            return hcclInt32;
         case hcclBfloat16:
-            return hcclBfloat16;
+            return data_type;
         case hcclNumTypes:
             break;
     }
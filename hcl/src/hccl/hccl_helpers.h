@@ -43,12 +43,14 @@ void resetLastErrorMessage();
 
 #define RETURN_ON_NULL_ARG(_arg) RETURN_ON_INVALID_ARG(_arg == nullptr, _arg, "Cannot be null.")
 
-// Support for fp16 not enabled
+// Any type of hcclDataType_t can be moved, the types that can be reduced are checked by
+// RETURN_ON_INVALID_REDUCTION_DATA_TYPE
 #define RETURN_ON_INVALID_DATA_TYPE(_arg)                                                                              \
-    RETURN_ON_INVALID_ARG(_arg != hcclFloat32 && _arg != hcclBfloat16 && _arg != hcclFloat16 && _arg != hcclInt32 &&   \
-                              _arg != hcclInt && _arg != hcclUint32,                                                   \
-                          _arg,                                                                                        \
-                          "Invalid or unsupported data type");
+    RETURN_ON_INVALID_ARG((unsigned)_arg >= hcclNumTypes, _arg, "Invalid or unsupported data type");
+
+// The reduction engines have no 64-bit types
+#define RETURN_ON_INVALID_REDUCTION_DATA_TYPE(_arg)                                                                    \
+    RETURN_ON_INVALID_ARG(hccl_data_type_elem_size(_arg) == 8, _arg, "64-bit types can't be reduced");
 
 #define RETURN_ON_INVALID_ADDR(addr)                                                                                   \
     {                                                                                                                  \
@@ -84,7 +86,7 @@ std::string  to_string(hcclDataType_t data_type);
 std::string  to_string(const synStatus status);
 
 size_t         hccl_data_type_elem_size(hcclDataType_t data_type);
-hcclDataType_t from_hccl_data_type_for_emulation(hcclDataType_t data_type);
+hcclDataType_t to_data_movement_type(hcclDataType_t data_type, size_t& count);
 
 std::ostream& operator<<(std::ostream& os, const hcclRedOp_t& reduceOp);
 HLLOG_DEFINE_OSTREAM_FORMATTER(hcclRedOp_t);
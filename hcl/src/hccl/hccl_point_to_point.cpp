@@ -35,6 +35,9 @@ hcclResult_t hccl_communicator::hccl_receive(void*          recvbuff,
                                              void*          streamHandle,
                                              uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsRecv, count * dataTypeSizeInBytes(dataType));
+    dataType = to_data_movement_type(dataType, count);
+
     SendRecvApiEntry entry {ApiType::Recv,
                             apiId,
                             streamHandle,
@@ -56,6 +59,9 @@ hcclResult_t hccl_communicator::hccl_send(const void*    sendbuff,
                                           void*          streamHandle,
                                           uint8_t        apiId)
 {
+    CommStats::OpScope statsScope(m_comm->getStats(), hcclStatsSend, count * dataTypeSizeInBytes(dataType));
+    dataType = to_data_movement_type(dataType, count);
+
     SendRecvApiEntry entry {ApiType::Send,
                             apiId,
                             streamHandle,
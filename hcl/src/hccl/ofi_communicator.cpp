@@ -142,7 +142,8 @@ hcclResult_t ofi_communicator::sendAsync(void*                  sendbuff,
                                          hcclHandle*            handle,
                                          unsigned               hostConnIdx,
                                          OfiCompCallbackParams& compParams,
-                                         uint16_t               qpSetIndex)
+                                         uint16_t               qpSetIndex,
+                                         ofi_post_batch_t*      batch)
 {
     HCL_FUNC_INSTRUMENTATION(DEBUG_STATS_ALL);
 
@@ -152,13 +153,16 @@ hcclResult_t ofi_communicator::sendAsync(void*                  sendbuff,
         return hcclLibfabricError;
     }
 
-    int status = ofiCommOp(CommOp::SEND,
-                           &m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].sendComm,
-                           sendbuff,
-                           size,
-                           &handle->ofi.req,
-                           m_ofi_,
-                           compParams);
+    ofiComm_t* const ofiComm = &m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].sendComm;
+    int              status  = 0;
+    if (batch != nullptr)
+    {
+        status = m_ofi_->queue(ofiComm, sendbuff, size, OFI_SEND, &handle->ofi.req, compParams, *batch);
+    }
+    else
+    {
+        status = ofiCommOp(CommOp::SEND, ofiComm, sendbuff, size, &handle->ofi.req, m_ofi_, compParams);
+    }
     if (status)
     {
         LOG_HCL_ERR(HCL, "send from {} to {} failed", my_rank_, peer);
@@ -177,7 +181,8 @@ hcclResult_t ofi_communicator::recvAsync(void*                  recvbuff,
                                          hcclHandle*            handle,
                                          unsigned               hostConnIdx,
                                          OfiCompCallbackParams& compParams,
-                                         uint16_t               qpSetIndex)
+                                         uint16_t               qpSetIndex,
+                                         ofi_post_batch_t*      batch)
 {
     HCL_FUNC_INSTRUMENTATION(DEBUG_STATS_ALL);
 
@@ -187,13 +192,16 @@ hcclResult_t ofi_communicator::recvAsync(void*                  recvbuff,
         return hcclLibfabricError;
     }
 
-    int status = ofiCommOp(CommOp::RECV,
-                           &m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].recvComm,
-                           recvbuff,
-                           size,
-                           &handle->ofi.req,
-                           m_ofi_,
-                           compParams);
+    ofiComm_t* const ofiComm = &m_peerRankToConnectionInfo[peer][qpSetIndex][hostConnIdx].recvComm;
+    int              status  = 0;
+    if (batch != nullptr)
+    {
+        status = m_ofi_->queue(ofiComm, recvbuff, size, OFI_RECV, &handle->ofi.req, compParams, *batch);
+    }
+    else
+    {
+        status = ofiCommOp(CommOp::RECV, ofiComm, recvbuff, size, &handle->ofi.req, m_ofi_, compParams);
+    }
     if (status)
     {
         LOG_HCL_ERR(HCL, "receive from {} to {} failed", peer, my_rank_);
@@ -31,20 +31,25 @@ public:
                                 uint16_t                  qpSetCount);
     bool updateConnections(const HCL_Rank outerRank, const HostNicConnectInfo& hnicsInfoBuf);
 
+    /**
+     * @brief Post a send/recv, or only queue it to batch if given. Queued requests are posted by ofi_t::flush.
+     */
     hcclResult_t sendAsync(void*                  sendbuff,
                            size_t                 size,
                            int                    peer,
                            hcclHandle*            handle,
                            unsigned               hostConnIdx,
                            OfiCompCallbackParams& compParams,
-                           uint16_t               qpSetIndex);
+                           uint16_t               qpSetIndex,
+                           ofi_post_batch_t*      batch = nullptr);
     hcclResult_t recvAsync(void*                  recvbuff,
                            size_t                 size,
                            int                    peer,
                            hcclHandle*            handle,
                            unsigned               hostConnIdx,
                            OfiCompCallbackParams& compParams,
-                           uint16_t               qpSetIndex);
+                           uint16_t               qpSetIndex,
+                           ofi_post_batch_t*      batch = nullptr);
     bool         waitForCompletionNb(void* handle, int& done);
 
     bool destroy();
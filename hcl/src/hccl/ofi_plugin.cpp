@@ -1,10 +1,12 @@
 #include "ofi_plugin.h"
 
 #include "libfabric/hl_ofi.h"            // for ofi_t
+#include "libfabric/hl_ofi_loopback.h"   // for ofi_loopback_plugin_t
 #include <dlfcn.h>                       // for dlclose, dlopen, dlsym, RTLD...
 #include <optional>                      // for std::optional
 #include "hcl_log_manager.h"             // for LOG_ERR, LOG_DEBUG, LOG_INFO
 #include "hcl_utils.h"                   // for VERIFY
+#include "hcl_global_conf.h"             // for GCFG_HCL_OFI_LOOPBACK
 #include "hccl_ofi_wrapper_interface.h"  // for ofi_plugin_interface
 #include "so.h"                          // for SharedObject
 
@@ -27,6 +29,14 @@ bool OfiPlugin::initializeOFIPluginIfNeeded()
         return true;
     }
 
+    if (GCFG_HCL_OFI_LOOPBACK.value())
+    {
+        LOG_INFO(HCL, "Initializing loopback ofi_plugin.");
+        ofi_plugin         = std::make_unique<ofi_loopback_plugin_t>();
+        m_msgPostSupported = true;
+        return true;
+    }
+
     LOG_INFO(HCL, "Initializing ofi_plugin.");
     try
     {
@@ -48,6 +58,7 @@ bool OfiPlugin::initializeOFIPluginIfNeeded()
     {
         LOG_INFO_F(HCL, "OFI wrapper version is: {}", version);
     }
+    m_msgPostSupported = version >= m_wrapper_msg_post_version;
 
     p_create   = handle_->symbol<ofi_plugin_interface_handle (*)()>("create_ofi_plugin_handle");
     ofi_plugin = (*p_create)();
@@ -61,3 +72,4 @@ bool OfiPlugin::initializeOFIPluginIfNeeded()
 
 ofi_plugin_interface_handle (*OfiPlugin::p_create)() = NULL;
 double (*OfiPlugin::p_get_version)()                 = NULL;
+bool OfiPlugin::m_msgPostSupported                   = false;
@@ -16,6 +16,7 @@ public:
 
     static bool          initializeOFIPluginIfNeeded();
     static inline double get_wrapper_required_version() { return m_wrapper_required_version; }
+    static inline bool   isMsgPostSupported() { return m_msgPostSupported; }
 
     static ofi_plugin_interface_handle (*p_create)();
     static double (*p_get_version)();
@@ -24,4 +25,6 @@ public:
 
 private:
     static constexpr double m_wrapper_required_version = 1.2;
+    static constexpr double m_wrapper_msg_post_version = 1.3;  // w_fi_tsendmsg / w_fi_trecvmsg
+    static bool             m_msgPostSupported;
 };
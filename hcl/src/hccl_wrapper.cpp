@@ -1,6 +1,8 @@
 #include "hccl_wrapper.h"
 #include "hccl.h"
 
+#include <vector>  // for vector
+
 #include "hccl_api_inc.h"       // for HCCL_TRY
 #include "hccl_helpers.h"       // for to_string, to_hccl_...
 #include "hccl_context.h"       // for hccl_context, g_hcc...
@@ -62,6 +64,45 @@ hcclResult_t hcclCommInitRank_Wrapper(hcclComm_t* comm, int nranks, hcclUniqueId
     HCCL_API_EXIT(res)
 }
 
+hcclResult_t hcclCommInitRanks_Wrapper(hcclComm_t*         comms,
+                                       int                 ncomms,
+                                       const int*          nranks,
+                                       const hcclUniqueId* commIds,
+                                       const int*          ranks)
+{
+    HCCL_CHECK_STOP_API();
+
+    HCCL_TRY
+    RETURN_ON_NULL_ARG(comms);
+    RETURN_ON_NULL_ARG(nranks);
+    RETURN_ON_NULL_ARG(commIds);
+    RETURN_ON_NULL_ARG(ranks);
+    RETURN_ON_INVALID_ARG(ncomms < 1, ncomms, "Must be positive.");
+
+    std::vector<hcclUniqueId> uniqueIds(commIds, commIds + ncomms);
+    if (use_global_comm_id())
+    {
+        hccl_ctx.generateGlobalUniqueId(uniqueIds[0]);
+    }
+
+    for (int i = 0; i < ncomms; i++)
+    {
+        HCL_API_LOG_ENTRY("(comm {}/{}: nranks={}, commId={}, rank={})",
+                          i,
+                          ncomms,
+                          nranks[i],
+                          hccl_ctx.unique_id_to_string(uniqueIds[i]),
+                          ranks[i]);
+    }
+    hcclResult_t res = hccl_ctx.comm_init_ranks(comms, ncomms, nranks, uniqueIds.data(), ranks);
+    if (res != hcclSuccess)
+    {
+        LOG_ERR(HCL_API, "hcclCommInitRanks_Wrapper failed({})", res);
+    }
+
+    HCCL_API_EXIT(res)
+}
+
 hcclResult_t hcclCommInitAll_Wrapper([[maybe_unused]] hcclComm_t* comm,
                                      [[maybe_unused]] int         ndev,
                                      [[maybe_unused]] const int*  devlist)
@@ -214,6 +255,24 @@ hcclResult_t hcclCommUserRank_Wrapper(hcclComm_t comm, int* rank)
     HCCL_API_EXIT(status)
 }
 
+hcclResult_t hcclCommSetPriority_Wrapper(hcclComm_t comm, hcclPriority_t priority)
+{
+    HCCL_TRY
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
+    hcclResult_t status = hccl_comm->comm_set_priority(priority);
+    HCCL_API_EXIT(status)
+}
+
+hcclResult_t hcclCommGetStats_Wrapper(hcclComm_t comm, hcclCommStats_t* stats)
+{
+    HCCL_TRY
+    auto* hccl_comm = hccl_ctx.communicator(comm);
+    RETURN_ON_INVALID_HCCL_COMM(hccl_comm);
+    hcclResult_t status = hccl_comm->comm_get_stats(stats);
+    HCCL_API_EXIT(status)
+}
+
 int hcclLookupDMABuff_Wrapper([[maybe_unused]] uint64_t addr, [[maybe_unused]] uint64_t size, int* fd)
 {
     HCCL_TRY
@@ -239,6 +298,7 @@ hcclResult_t hcclReduceScatter_Wrapper(const void*    sendbuff,
     RETURN_ON_INVALID_ADDR(sendbuff);
     RETURN_ON_INVALID_ADDR(recvbuff);
     RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_REDUCTION_DATA_TYPE(datatype);
     RETURN_ON_INVALID_REDUCTION_OP(reduceOp);
     RETURN_ON_INVALID_STREAM(stream_handle);
 
@@ -271,6 +331,7 @@ hcclResult_t hcclReduce_Wrapper(const void*    sendbuff,
         RETURN_ON_INVALID_ADDR(recvbuff);
     }
     RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_REDUCTION_DATA_TYPE(datatype);
     RETURN_ON_INVALID_REDUCTION_OP(reduceOp);
     RETURN_ON_INVALID_RANK(root, hccl_comm->getCommSize());
     RETURN_ON_INVALID_STREAM(stream_handle);
@@ -299,6 +360,7 @@ hcclResult_t hcclAllReduce_Wrapper(const void*    sendbuff,
     RETURN_ON_INVALID_ADDR(sendbuff);
     RETURN_ON_INVALID_ADDR(recvbuff);
     RETURN_ON_INVALID_DATA_TYPE(datatype);
+    RETURN_ON_INVALID_REDUCTION_DATA_TYPE(datatype);
     RETURN_ON_INVALID_REDUCTION_OP(reduceOp);
     RETURN_ON_INVALID_STREAM(stream_handle);
 
@@ -10,6 +10,12 @@ hcclResult_t hcclGetUniqueId_Wrapper(hcclUniqueId* uniqueId);
 
 hcclResult_t hcclCommInitRank_Wrapper(hcclComm_t* comm, int nranks, hcclUniqueId& commId, int rank);
 
+hcclResult_t hcclCommInitRanks_Wrapper(hcclComm_t*         comms,
+                                       int                 ncomms,
+                                       const int*          nranks,
+                                       const hcclUniqueId* commIds,
+                                       const int*          ranks);
+
 hcclResult_t hcclCommInitAll_Wrapper(hcclComm_t* comm, int ndev, const int* devlist);
 
 hcclResult_t hcclCommFinalize_Wrapper(hcclComm_t comm);
@@ -32,6 +38,10 @@ hcclResult_t hcclCommSynDevice_Wrapper(hcclComm_t comm, int* device);
 
 hcclResult_t hcclCommUserRank_Wrapper(hcclComm_t comm, int* rank);
 
+hcclResult_t hcclCommSetPriority_Wrapper(hcclComm_t comm, hcclPriority_t priority);
+
+hcclResult_t hcclCommGetStats_Wrapper(hcclComm_t comm, hcclCommStats_t* stats);
+
 int hcclLookupDMABuff_Wrapper(uint64_t addr, uint64_t size, int* fd);
 
 hcclResult_t hcclReduceScatter_Wrapper(const void*    sendbuff,
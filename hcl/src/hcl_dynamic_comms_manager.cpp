@@ -31,20 +31,28 @@ HclDynamicCommsManager::~HclDynamicCommsManager()
 
 HCL_Comm HclDynamicCommsManager::createNextComm(hcl::HalPtr hal, Gen2ArchServerDef& serverDef)
 {
-    locker_t locker(m_lock);
-
-    HCL_Comm comm = m_nextCommId++;
-    if (unlikely(comm >= m_communicators.size()))
+    HCL_Comm comm;
     {
-        // push_back may cause a resize of the underlying continuous array, hence a new-delete sequence followed by a
-        // none-free memcpy.
-        LOG_HCL_DEBUG(HCL, "Resizing m_communicators for new comm({})", comm);
-        m_communicators.resize(m_communicators.size() + DEFAULT_COMMUNICATORS_SIZE, nullptr);
+        locker_t locker(m_lock);
+
+        comm = m_nextCommId++;
+        if (unlikely(comm >= m_communicators.size()))
+        {
+            // push_back may cause a resize of the underlying continuous array, hence a new-delete sequence followed
+            // by a none-free memcpy.
+            LOG_HCL_DEBUG(HCL, "Resizing m_communicators for new comm({})", comm);
+            m_communicators.resize(m_communicators.size() + DEFAULT_COMMUNICATORS_SIZE, nullptr);
+        }
     }
 
-    // By default we should hope that the above sequence can be avoided - if the array is resized by default to a
+    // The comm id is reserved, so the communicator is constructed without holding the lock, which the other
+    // communicators take on every getComm()
+    HclDynamicCommunicator* communicator = new HclDynamicCommunicator(comm, serverDef, hal);
+
+    // By default we should hope that the above resize can be avoided - if the array is resized by default to a
     // big enough size, this will result in a simple assignment.
-    m_communicators[comm] = new HclDynamicCommunicator(comm, serverDef, hal);
+    locker_t locker(m_lock);
+    m_communicators[comm] = communicator;
     m_size++;
     return comm;
 }
@@ -9,6 +9,10 @@
 #include <memory>     // for __shared_ptr_access
 #include <string>     // for string, basic_st...
 #include <set>        // for set
+#include <cstring>    // for strnlen
+#include <functional> // for hash
+#include <map>        // for map
+#include <numeric>    // for iota
 
 #include "hcl_api_types.h"                        // for HCL_Rank
 #include "hccl_types.h"                           // for hcclInternalError
@@ -29,8 +33,6 @@
 
 class IHclDevice;
 
-static constexpr unsigned MAX_SEND_RECV_PEER_COUNTER = 16;
-
 void RankApiCounters::logDebug(const CommIds&          commIds,
                                const std::string_view& prefix,
                                const std::string_view& varName) const
@@ -172,8 +174,8 @@ bool HclDynamicCommunicator::init(const uint32_t hcclCommSize, const HCL_Rank ra
         m_remoteDevices[i] = std::make_unique<HclRemoteDevice>();
     }
 
-    m_sendCounter.clear();
-    m_recvCounter.clear();
+    m_sendCounter.assign(hcclCommSize, 0);
+    m_recvCounter.assign(hcclCommSize, 0);
 
     m_apiCounters.resize(hcclCommSize);
     m_apiPreGroupEndCounters.resize(hcclCommSize);
@@ -432,26 +434,25 @@ const uint64_t HclDynamicCommunicator::getCollectiveCtr() const
     return m_collectiveCtr;
 }
 
+// peer is not validated yet when the API counters are updated, so out of range peers count as 0
 const uint64_t HclDynamicCommunicator::incSendCtr(const HCL_Rank peer)
 {
-    return (m_sendCounter.size() < MAX_SEND_RECV_PEER_COUNTER || m_sendCounter.count(peer) > 0) ? ++m_sendCounter[peer]
-                                                                                                : 0;
+    return likely(peer < m_sendCounter.size()) ? ++m_sendCounter[peer] : 0;
 }
 
 const uint64_t HclDynamicCommunicator::getSendCtr(const HCL_Rank peer) const
 {
-    return m_sendCounter.count(peer) > 0 ? m_sendCounter.at(peer) : 0;
+    return likely(peer < m_sendCounter.size()) ? m_sendCounter[peer] : 0;
 }
 
 const uint64_t HclDynamicCommunicator::incRecvCtr(const HCL_Rank peer)
 {
-    return (m_recvCounter.size() < MAX_SEND_RECV_PEER_COUNTER || m_recvCounter.count(peer) > 0) ? ++m_recvCounter[peer]
-                                                                                                : 0;
+    return likely(peer < m_recvCounter.size()) ? ++m_recvCounter[peer] : 0;
 }
 
 const uint64_t HclDynamicCommunicator::getRecvCtr(const HCL_Rank peer) const
 {
-    return m_recvCounter.count(peer) > 0 ? m_recvCounter.at(peer) : 0;
+    return likely(peer < m_recvCounter.size()) ? m_recvCounter[peer] : 0;
 }
 
 uint32_t HclDynamicCommunicator::getCommSize() const
@@ -641,6 +642,132 @@ hcclResult_t HclDynamicCommunicator::setCommScaleupGroupSize()
     return hcclSuccess;
 }
 
+/**
+ * @brief Order boxes so that boxes attached to the same switch are adjacent.
+ *
+ * Switches keep the order in which they first appear and boxes keep their relative order within a switch, so a layout
+ * that is already grouped maps to the identity. Boxes with an unknown switch are grouped together.
+ */
+static std::vector<unsigned> groupBoxesBySwitch(const std::vector<std::string>& boxSwitchIds)
+{
+    std::map<std::string, unsigned> switchOrder;
+    for (const std::string& switchId : boxSwitchIds)
+    {
+        switchOrder.emplace(switchId, switchOrder.size());
+    }
+
+    std::vector<unsigned> ring(boxSwitchIds.size());
+    std::iota(ring.begin(), ring.end(), 0);
+    std::stable_sort(ring.begin(), ring.end(), [&](const unsigned box1, const unsigned box2) {
+        return switchOrder.at(boxSwitchIds[box1]) < switchOrder.at(boxSwitchIds[box2]);
+    });
+    return ring;
+}
+
+hcclResult_t HclDynamicCommunicator::setBoxRing()
+{
+    const unsigned numOfBoxes = div((uint32_t)m_commSize, (uint32_t)m_scaleupGroupSize);
+
+    m_boxRing.resize(numOfBoxes);
+    std::iota(m_boxRing.begin(), m_boxRing.end(), 0);
+
+    // a ring of two boxes has a single order
+    if (GCFG_HCL_TOPOLOGY_REORDER.value() && numOfBoxes > 2)
+    {
+        // the switch of a box is the one reported by its first rank in the first handshake, so all ranks see the same
+        std::vector<std::string> boxSwitchIds(numOfBoxes);
+        for (unsigned box = 0; box < numOfBoxes; box++)
+        {
+            const RankInfoHeader& header = getRemoteConnectionHeader(box * m_scaleupGroupSize);
+            boxSwitchIds[box]            = std::string(header.switchId, strnlen(header.switchId, SWITCH_ID_LENGTH));
+        }
+
+        m_boxRing = groupBoxesBySwitch(boxSwitchIds);
+        LOG_HCL_INFO(HCL, "Comm ({}) box switches [{}]", m_commId, fmt::join(boxSwitchIds, ", "));
+    }
+
+    // Only the order of the boxes changes, the ranks inside a box and the per-box chunk of every buffer stay as they
+    // are. A box must appear once, and walking d boxes forward and back must return to the same box, otherwise the
+    // sender and the receiver of a scaleout step pair with different peers.
+    m_boxRingPosition.assign(numOfBoxes, numOfBoxes);
+    for (unsigned position = 0; position < numOfBoxes; position++)
+    {
+        const unsigned box = m_boxRing[position];
+        if (box >= numOfBoxes || m_boxRingPosition[box] != numOfBoxes)
+        {
+            LOG_HCL_ERR(HCL, "Comm ({}) box {} is invalid or repeated in the scaleout box order", m_commId, box);
+            return hcclInternalError;
+        }
+        m_boxRingPosition[box] = position;
+    }
+    for (unsigned box = 0; box < numOfBoxes; box++)
+    {
+        for (int distance = 1; distance < (int)numOfBoxes; distance++)
+        {
+            const unsigned peerBox = getBoxAtRingDistance(box, distance, numOfBoxes);
+            if (getBoxAtRingDistance(peerBox, -distance, numOfBoxes) != box ||
+                getBoxRingDistance(box, peerBox, numOfBoxes) != (unsigned)distance)
+            {
+                LOG_HCL_ERR(HCL,
+                            "Comm ({}) scaleout box order pairs box {} with box {} at distance {} one way only",
+                            m_commId,
+                            box,
+                            peerBox,
+                            distance);
+                return hcclInternalError;
+            }
+        }
+    }
+
+    // sent to the other ranks in the second handshake, see validateBoxRing
+    m_rankInfo.header.boxRingHash = std::hash<std::string> {}(fmt::format("{}", fmt::join(m_boxRing, ",")));
+
+    LOG_HCL_INFO(HCL, "Comm ({}) scaleout box order [{}]", m_commId, fmt::join(m_boxRing, ", "));
+    return hcclSuccess;
+}
+
+hcclResult_t HclDynamicCommunicator::validateBoxRing() const
+{
+    // A rank that walks a different ring posts to peers that don't expect it, and the collective hangs
+    for (HCL_Rank rank = 0; rank < (HCL_Rank)m_commSize; rank++)
+    {
+        const uint64_t remoteHash = m_remoteDevices[rank]->header.boxRingHash;
+        if (rank != getMyRank() && remoteHash != m_rankInfo.header.boxRingHash)
+        {
+            LOG_HCL_ERR(HCL,
+                        "Comm ({}) rank {} scaleout box order differs from rank {} ({:x} != {:x}), "
+                        "HCL_TOPOLOGY_REORDER must be the same on all ranks",
+                        m_commId,
+                        rank,
+                        getMyRank(),
+                        remoteHash,
+                        m_rankInfo.header.boxRingHash);
+            return hcclInvalidUsage;
+        }
+    }
+    return hcclSuccess;
+}
+
+unsigned HclDynamicCommunicator::getBoxAtRingDistance(const unsigned box,
+                                                      const int      distance,
+                                                      const unsigned numOfBoxes) const
+{
+    const bool     useRing  = numOfBoxes == m_boxRing.size();
+    const unsigned position = useRing ? m_boxRingPosition[box] : box;
+    const unsigned target   = (position + numOfBoxes + distance % (int)numOfBoxes) % numOfBoxes;
+    return useRing ? m_boxRing[target] : target;
+}
+
+unsigned HclDynamicCommunicator::getBoxRingDistance(const unsigned fromBox,
+                                                    const unsigned toBox,
+                                                    const unsigned numOfBoxes) const
+{
+    const bool     useRing      = numOfBoxes == m_boxRing.size();
+    const unsigned fromPosition = useRing ? m_boxRingPosition[fromBox] : fromBox;
+    const unsigned toPosition   = useRing ? m_boxRingPosition[toBox] : toBox;
+    return (toPosition + numOfBoxes - fromPosition) % numOfBoxes;
+}
+
 hcclResult_t HclDynamicCommunicator::prepareAndValidateComm(bool isLoopbackModeOrNullSubmission)
 {
     LOG_HCL_DEBUG(HCL, "m_commId={}, isLoopbackModeOrNullSubmission={}", m_commId, isLoopbackModeOrNullSubmission);
@@ -672,6 +799,13 @@ hcclResult_t HclDynamicCommunicator::prepareAndValidateComm(bool isLoopbackModeO
         return res;
     }
 
+    res = setBoxRing();
+    if (res != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "Wasn't able to set scaleout box order for comm ({})", m_commId);
+        return res;
+    }
+
     return res;
 }
 
@@ -831,7 +965,9 @@ void HclDynamicCommunicator::updateFaultToleranceCollectivesCounters(const HCL_S
         std::unique_lock<std::mutex> lock(m_faultToleranceTargetCountersMutex);
         m_faultToleranceTargetCounters.rankApiCountersData.collectivesCounter++;
         m_faultToleranceTargetCounters.streamLongSo[streamId] = streamLongSo;
+        m_faultToleranceTargetCountersVersion++;
     }
+    m_faultToleranceTargetCountersCv.notify_all();
 
     if (unlikely(LOG_LEVEL_AT_LEAST_DEBUG(HCL)))
     {
@@ -850,6 +986,16 @@ void HclDynamicCommunicator::updateFaultToleranceCollectivesCounters(const HCL_S
     }
 }
 
+uint64_t HclDynamicCommunicator::waitFaultToleranceTargetCountersUpdate(const uint64_t                  version,
+                                                                        const std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_faultToleranceTargetCountersMutex);
+    m_faultToleranceTargetCountersCv.wait_for(lock, timeout, [&] {
+        return m_faultToleranceTargetCountersVersion != version;
+    });
+    return m_faultToleranceTargetCountersVersion;
+}
+
 void HclDynamicCommunicator::updateFaultToleranceSendRecvCounters(const HCL_StreamId streamId,
                                                                   const uint64_t     streamLongSo)
 {
@@ -862,7 +1008,9 @@ void HclDynamicCommunicator::updateFaultToleranceSendRecvCounters(const HCL_Stre
         VERIFY(streamId < m_faultToleranceTargetCounters.streamLongSo.size());
         m_faultToleranceTargetCounters.rankApiCountersData.ranksSendRecv = m_apiCounters.ranksSendRecv;
         m_faultToleranceTargetCounters.streamLongSo[streamId]            = streamLongSo;
+        m_faultToleranceTargetCountersVersion++;
     }
+    m_faultToleranceTargetCountersCv.notify_all();
 
     // debug print loop on non-zero counters
     if (unlikely(LOG_LEVEL_AT_LEAST_TRACE(HCL)))
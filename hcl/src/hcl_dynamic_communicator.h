@@ -1,7 +1,9 @@
 #pragma once
 
-#include <array>    // for array
-#include <cstdint>  // for uint16_t
+#include <array>               // for array
+#include <chrono>              // for milliseconds
+#include <condition_variable>  // for condition_variable
+#include <cstdint>             // for uint16_t
 #include <vector>   // for vector
 #include <memory>   // for allocator, unique_ptr
 #include <map>
@@ -13,6 +15,7 @@
 #include "interfaces/hcl_unique_sorted_vector.h"  // for UniqueSortedVector
 #include "interfaces/hcl_remote_device.h"         // for HclRemoteDevice
 #include "hccl/ofi_communicator.h"                // for ofi_communicator_handle
+#include "infra/hcl_comm_stats.h"                 // for CommStats
 #include "interfaces/hcl_hal.h"                   // for HalPtr
 #include "hccl_internal_defs.h"                   // for internal_unique_id_t
 #include "hccl_types.h"                           // for hcclComm_t
@@ -238,6 +241,28 @@ public:
     const std::vector<uint32_t>& getRankToScaleupGroupMap();
     const std::vector<HCL_Rank>& getScaleupGroupToRankMap();
 
+    /**
+     * @brief Scaleout order of the boxes, position -> box. Identity unless HCL_TOPOLOGY_REORDER is set, in which case
+     * boxes attached to the same switch are adjacent. Box numbers and the data layout are not affected.
+     */
+    const std::vector<unsigned>& getBoxRing() const { return m_boxRing; }
+    unsigned                     getBoxRingPosition(const unsigned box) const { return m_boxRingPosition[box]; }
+
+    /**
+     * @brief Walk the scaleout box ring: the box at the given distance from box, and the distance from one box to
+     * another. Box iterations that don't cover all the boxes of the comm walk the plain box order.
+     */
+    unsigned getBoxAtRingDistance(const unsigned box, const int distance, const unsigned numOfBoxes) const;
+    unsigned getBoxRingDistance(const unsigned fromBox, const unsigned toBox, const unsigned numOfBoxes) const;
+    unsigned getNextRingBox(const unsigned box, const unsigned numOfBoxes) const
+    {
+        return getBoxAtRingDistance(box, 1, numOfBoxes);
+    }
+    unsigned getPrevRingBox(const unsigned box, const unsigned numOfBoxes) const
+    {
+        return getBoxAtRingDistance(box, -1, numOfBoxes);
+    }
+
     HCL_Rank                  getMyRank() const;
     HCL_Rank                  getScaleUpLastRank();
     HCL_Rank                  getScaleOutLastRank();
@@ -278,6 +303,7 @@ public:
     uint64_t getSliceSize() const;
 
     hcclResult_t      prepareAndValidateComm(bool isLoopbackModeOrNullSubmission = false);
+    hcclResult_t      validateBoxRing() const;  // after the QPs exchange, all ranks must agree on the box ring
     void              AddNewRemoteDevice(HCL_Rank newRank);
     const std::string getCommUniqueId() const;
 
@@ -285,6 +311,11 @@ public:
 
     void getAsyncError(hcclResult_t* asyncError, std::string& errMessage);
 
+    hcclPriority_t getPriority() const { return m_priority; }
+    void           setPriority(const hcclPriority_t priority) { m_priority = priority; }
+
+    CommStats& getStats() { return m_stats; }
+
     HclRemoteDeviceArray m_remoteDevices;
     RankInfo             m_rankInfo           = {};
     uint32_t             m_commSize           = -1;
@@ -312,12 +343,24 @@ public:
     const CommConnectivity& getCommConnectivity() const { return m_commConnectivity; }
     CommConnectivity&       getCommConnectivity() { return m_commConnectivity; }
 
-    const FaultToleranceTargetCounters getFaultToleranceTargetCounters()
+    // version (optional) is the update count of the returned counters, see waitFaultToleranceTargetCountersUpdate()
+    const FaultToleranceTargetCounters getFaultToleranceTargetCounters(uint64_t* version = nullptr)
     {
         std::unique_lock<std::mutex> lock(m_faultToleranceTargetCountersMutex);
+        if (version != nullptr)
+        {
+            *version = m_faultToleranceTargetCountersVersion;
+        }
         return m_faultToleranceTargetCounters;
     }
 
+    /**
+     * @brief Block until the fault tolerance target counters are updated past version, or the timeout expires.
+     *
+     * @return The current update count.
+     */
+    uint64_t waitFaultToleranceTargetCountersUpdate(const uint64_t version, const std::chrono::milliseconds timeout);
+
     void updateFaultToleranceCollectivesCounters(
         const HCL_StreamId streamId,
         const uint64_t     streamLongSo);  // Set long SO and increment collectives API Counter
@@ -347,6 +390,10 @@ private:
      * @return hcclSuccess if configured slice size is valid
      */
     hcclResult_t setSliceSize();
+    hcclResult_t setBoxRing();
+
+    hcclPriority_t m_priority = hcclPriorityDefault;  // applied to operations submitted after it is set
+    CommStats      m_stats;
 
     UniqueSortedVector    m_innerRanksExclusiveCache;     // exclude rank itself
     UniqueSortedVector    m_innerRanksInclusiveCache;     // include rank itself
@@ -356,9 +403,11 @@ private:
     UniqueSortedVector    m_connectedRanks;               // exclude rank itself (inside ScaleupGroup + peers)
     std::vector<uint32_t> m_rankToScaleupGroupMap = {};
     std::vector<HCL_Rank> m_scaleupGroupToRankMap = {};
+    std::vector<unsigned> m_boxRing               = {};  // position -> box
+    std::vector<unsigned> m_boxRingPosition       = {};  // box -> position
 
-    std::map<HCL_Rank, uint64_t> m_sendCounter;
-    std::map<HCL_Rank, uint64_t> m_recvCounter;
+    std::vector<uint64_t> m_sendCounter;  // indexed by peer rank
+    std::vector<uint64_t> m_recvCounter;  // indexed by peer rank
 
     RankApiCounters m_apiCounters =
         {};  // Used by fault tolerance to hold the API counters, s/r are full vectors always
@@ -379,5 +428,7 @@ private:
 
     FaultToleranceTargetCounters m_faultToleranceTargetCounters;
     std::mutex                   m_faultToleranceTargetCountersMutex;
+    std::condition_variable      m_faultToleranceTargetCountersCv;
+    uint64_t                     m_faultToleranceTargetCountersVersion = 0;  // guarded by the mutex above
     hcclComm_t m_commHandle = nullptr;  // Stores back pointer to hccl_communicator, needed for fault tolerance
 };
@@ -38,6 +38,19 @@ GlobalConfUint64 GCFG_HCL_SCALEOUT_BUFFER_FACTOR(
         8,
         MakePrivate);
 
+GlobalConfBool GCFG_HCL_SIMB_POOL_ADAPTIVE(
+        "HCL_SIMB_POOL_ADAPTIVE",
+        "Move intermediate buffers between pools of the same container towards pools that wait for credits. "
+        "Pools are repartitioned only when none of their buffers is in flight",
+        false,
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_SIMB_POOL_ADAPTIVE_INTERVAL(
+        "HCL_SIMB_POOL_ADAPTIVE_INTERVAL",
+        "Minimum number of ops per stream between two repartitions of the intermediate buffer pools",
+        1024,
+        MakePrivate);
+
 GlobalConfSize GCFG_HCL_IMB_SIZE(
         "HCL_IMB_SIZE",
         "Static intermediate buffer size",
@@ -92,6 +105,30 @@ GlobalConfString GCFG_HABANA_PROFILE(
         std::string("0"),
         MakePublic);
 
+GlobalConfBool GCFG_HCL_COMM_PROFILE(
+        "HCL_COMM_PROFILE",
+        "Time the communicator init/destroy phases, the coordinator reports the init phases of all ranks",
+        false,
+        MakePrivate);
+
+GlobalConfString GCFG_HCL_COMM_PROFILE_FILE(
+        "HCL_COMM_PROFILE_FILE",
+        "Communicator init report file name prefix (comm id and .json are appended), empty to log the report",
+        std::string(),
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_COMM_STATS(
+        "HCL_COMM_STATS",
+        "Count the per communicator statistics returned by hcclCommGetStats",
+        false,
+        MakePublic);
+
+GlobalConfBool GCFG_HCL_COMM_INIT_PARALLEL(
+        "HCL_COMM_INIT_PARALLEL",
+        "Initialize the communicators of hcclCommInitRanks concurrently, one thread per communicator",
+        true,
+        MakePublic);
+
 GlobalConfInt64 GCFG_REQUESTER_PRIORITY(
     "REQUESTER_PRIORITY",
     "Priority of requester QP packets",
@@ -268,6 +305,49 @@ GlobalConfSize GCFG_HCL_COMPLEX_BCAST_MIN_SIZE(
         DfltSize(hl_gcfg::SizeParam("256K")),
         MakePrivate);
 
+GlobalConfUint64 GCFG_HCL_SCALEOUT_BCAST_TREE(
+        "HCL_SCALEOUT_BCAST_TREE",
+        "Tree used for multi box broadcast up to HCL_SCALEOUT_BCAST_TREE_MAX_SIZE: "
+        "0 - disabled, 1 - binomial, 2 - pipelined chain",
+        0,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_SCALEOUT_BCAST_TREE_MAX_SIZE(
+        "HCL_SCALEOUT_BCAST_TREE_MAX_SIZE",
+        "Maximal broadcast size to use the scaleout tree, larger broadcasts use scatter + allgather",
+        DfltSize(hl_gcfg::SizeParam("1M")),
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_SCALEOUT_BCAST_CHAIN_CHUNK_SIZE(
+        "HCL_SCALEOUT_BCAST_CHAIN_CHUNK_SIZE",
+        "Chunk size for the pipelined chain broadcast",
+        DfltSize(hl_gcfg::SizeParam("128K")),
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_TOPOLOGY_REORDER(
+        "HCL_TOPOLOGY_REORDER",
+        "Order the scaleout box ring by switch, used by the ring collectives, send/recv and tree broadcast",
+        false,
+        MakePrivate);
+
+GlobalConfString GCFG_HCL_TOPOLOGY_SWITCH_ID(
+        "HCL_TOPOLOGY_SWITCH_ID",
+        "Identifier of the scaleout switch this host is attached to, exchanged at comm init",
+        std::string(),
+        MakePrivate);
+
+GlobalConfString GCFG_HCL_TOPOLOGY_FILE(
+        "HCL_TOPOLOGY_FILE",
+        "Optional json file with the scaleout switch of each host, overrides HCL_TOPOLOGY_SWITCH_ID",
+        std::string(),
+        MakePrivate);
+
+GlobalConfString GCFG_HCL_TOPOLOGY_CACHE_DIR(
+        "HCL_TOPOLOGY_CACHE_DIR",
+        "Directory for caching the host NIC to Gaudi matching across process starts (empty = no cache)",
+        std::string(),
+        MakePublic);
+
 GlobalConfBool GCFG_HCL_USE_SINGLE_PEER_BROADCAST(
         "HCL_USE_SINGLE_PEER_BROADCAST",
         "Use single peer broadcast implementation. Not supported for Gaudi3",
@@ -316,6 +396,51 @@ GlobalConfInt64 GCFG_HOST_SCHEDULER_STREAM_DEPTH_PROC(
         1,
         MakePrivate);
 
+GlobalConfBool GCFG_HOST_SCHEDULER_BATCH_POSTS(
+        "HOST_SCHEDULER_BATCH_POSTS",
+        "Queue the scaleout sends/recvs of a host scheduler round and post them together at its end",
+        false,
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_PRIORITY_CLASSES(
+        "HCL_PRIORITY_CLASSES",
+        "Serve host streams of high priority collectives (hcclCommSetPriority or small ops) before bulk ones",
+        false,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_PRIORITY_SMALL_OP_MAX_SIZE(
+        "HCL_PRIORITY_SMALL_OP_MAX_SIZE",
+        "Collectives of up to this size per rank are high priority regardless of the communicator priority "
+        "(0 = communicator priority only)",
+        DfltSize(hl_gcfg::SizeParam("64KB")),
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_PRIORITY_BULK_MAX_SKIP(
+        "HCL_PRIORITY_BULK_MAX_SKIP",
+        "Maximum number of consecutive host scheduler rounds in which bulk host streams are skipped in favor of high "
+        "priority ones",
+        4,
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_GROUP_FUSION(
+        "HCL_GROUP_FUSION",
+        "Fuse the small AllReduce calls of a group call into one AllReduce over a per stream staging buffer, "
+        "not validated on hardware yet",
+        false,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_GROUP_FUSION_THRESHOLD(
+        "HCL_GROUP_FUSION_THRESHOLD",
+        "AllReduce calls of up to this size are fused when HCL_GROUP_FUSION is set",
+        DfltSize(hl_gcfg::SizeParam("64KB")),
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_GROUP_FUSION_BUFFER_SIZE(
+        "HCL_GROUP_FUSION_BUFFER_SIZE",
+        "Size of the per stream device staging buffer of fused AllReduce calls",
+        DfltSize(hl_gcfg::SizeParam("4MB")),
+        MakePrivate);
+
 GlobalConfSize GCFG_MTU_SIZE(
         "MTU_SIZE",
         "MTU used by Gaudi NICs",
@@ -360,6 +485,13 @@ GlobalConfBool GCFG_HCL_ALLOW_GRAPH_CACHING(
         true,
         MakePrivate);
 
+GlobalConfUint64 GCFG_HCL_GRAPH_CACHE_MAX_ENTRIES(
+        "HCL_GRAPH_CACHE_MAX_ENTRIES",
+        "Maximum number of cached signal graphs per stream, across all comms. Least recently used graphs are evicted "
+        "beyond this bound (0 = unbounded)",
+        0,
+        MakePrivate);
+
 GlobalConfBool GCFG_HCL_NULL_SUBMIT(
     "HCL_NULL_SUBMIT",
     "Null submit for HCL (gaudi2/3)",
@@ -372,6 +504,13 @@ GlobalConfUint64 GCFG_HCCL_PRIM_COLLECTIVE_MASK(
         DfltUint64(DEFAULT_PRIM_COLLECTIVE_MASK) ,
         MakePublic);
 
+GlobalConfBool GCFG_HCCL_PRIM_GRAPH_OPTIMIZE(
+        "HCCL_PRIM_GRAPH_OPTIMIZE",
+        "Run the dependency based optimization pass (wait elimination, exec set packing) on primitive graphs before "
+        "submission",
+        false,
+        MakePrivate);
+
 GlobalConfBool GCFG_HCL_COLLECTIVE_LOG(
         "HCL_COLLECTIVE_LOG",
         "Collect HCL collective logs from all ranks to coordinator",
@@ -501,6 +640,80 @@ GlobalConfUint64 GCFG_HCL_OFI_MAX_RETRY_DURATION(
         10,
         MakePrivate);
 
+GlobalConfBool GCFG_HCL_OFI_ZERO_COPY(
+        "HCL_OFI_ZERO_COPY",
+        "When true, host NIC send/recv register user device buffers on demand instead of staging through host buffers",
+        false,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_OFI_ZERO_COPY_MIN_SIZE(
+        "HCL_OFI_ZERO_COPY_MIN_SIZE",
+        "Minimal message size to use zero-copy, smaller messages are staged through host buffers",
+        DfltSize(hl_gcfg::SizeParam("64K")),
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_OFI_MR_CACHE_MAX_ENTRIES(
+        "HCL_OFI_MR_CACHE_MAX_ENTRIES",
+        "Maximum number of user buffer registrations kept per OFI domain",
+        64,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_OFI_MR_CACHE_MAX_SIZE(
+        "HCL_OFI_MR_CACHE_MAX_SIZE",
+        "Maximum size of user buffer registrations kept per OFI domain, 0 for unlimited",
+        DfltSize(hl_gcfg::SizeParam("16G")),
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_HNIC_HYBRID_PATH(
+        "HCL_HNIC_HYBRID_PATH",
+        "When true, host NIC scaleout keeps the host buffers and each collective chooses by size between them and "
+        "Gaudi-direct access to device memory",
+        false,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_HNIC_HYBRID_DIRECT_MIN_SIZE(
+        "HCL_HNIC_HYBRID_DIRECT_MIN_SIZE",
+        "Minimal collective size to use Gaudi-direct in hybrid mode, 0 to calibrate it from the PCIe topology",
+        DfltSize(hl_gcfg::SizeParam("0")),
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_OFI_LOOPBACK(
+        "HCL_OFI_LOOPBACK",
+        "When true, OFI runs over a shared memory loopback fabric between the processes of one host instead of "
+        "libfabric, for testing and benchmarking",
+        false,
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_OFI_LOOPBACK_LATENCY_NS(
+        "HCL_OFI_LOOPBACK_LATENCY_NS",
+        "Loopback fabric latency in nanoseconds added to every message",
+        0,
+        MakePrivate);
+
+GlobalConfUint64 GCFG_HCL_OFI_LOOPBACK_BW_MBPS(
+        "HCL_OFI_LOOPBACK_BW_MBPS",
+        "Loopback fabric bandwidth in MB/s of every endpoint, 0 for unlimited",
+        0,
+        MakePrivate);
+
+GlobalConfSize GCFG_HCL_OFI_LOOPBACK_INBOX_SIZE(
+        "HCL_OFI_LOOPBACK_INBOX_SIZE",
+        "Size of the shared memory inbox of every loopback fabric endpoint, larger messages are sent in fragments",
+        DfltSize(hl_gcfg::SizeParam("8MB")),
+        MakePrivate);
+
+GlobalConfBool GCFG_HCL_HOST_BUFFERS_NUMA_BIND(
+        "HCL_HOST_BUFFERS_NUMA_BIND",
+        "Bind the host scaleout buffers to the NUMA node of the host NIC",
+        false,
+        MakePublic);
+
+GlobalConfSize GCFG_HCL_HOST_BUFFERS_HUGE_PAGE_SIZE(
+        "HCL_HOST_BUFFERS_HUGE_PAGE_SIZE",
+        "Huge page size (2M or 1G) backing the host scaleout buffers, 0 for regular pages",
+        DfltSize(hl_gcfg::SizeParam("0")),
+        MakePublic);
+
 GlobalConfBool GCFG_HCL_REDUCE_NON_PEER_QPS(
     "HCL_REDUCE_NON_PEER_QPS",
     "Do not use INVALID_QP value when open QPs for non-peers",
@@ -645,6 +858,12 @@ GlobalConfUint64 GCFG_HCL_FAULT_TOLERANCE_FAILBACK_DELAY(
         DfltUint64(300),
         MakePublic);
 
+GlobalConfBool GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER(
+        "HCL_FAULT_TOLERANCE_FAST_FAILOVER",
+        "Event driven API drain, counters delta exchange and migration QPs creation during the start delay",
+        false,
+        MakePrivate);
+
 GlobalConfBool GCFG_HCL_DFA_DUMP_MEMORY(
         "HCL_DFA_DUMP_MEMORY",
         "Dump most recently used memory",
@@ -17,12 +17,18 @@ extern GlobalConfUint64 GCFG_HCL_SCALEUP_SIMB_COUNT;
 extern GlobalConfSize   GCFG_FW_IMB_SIZE;
 extern GlobalConfUint64 GCFG_HCL_MIN_IMB_SIZE_FACTOR;
 extern GlobalConfUint64 GCFG_HCL_SCALEOUT_BUFFER_FACTOR;
+extern GlobalConfBool   GCFG_HCL_SIMB_POOL_ADAPTIVE;
+extern GlobalConfUint64 GCFG_HCL_SIMB_POOL_ADAPTIVE_INTERVAL;
 extern GlobalConfBool   GCFG_HCL_OPT_SLICE_SIZE;
 extern GlobalConfSize   GCFG_HCL_SLICE_SIZE;
 extern GlobalConfSize   GCFG_HCL_GDR_SLICE_SIZE;
 extern GlobalConfUint64 GCFG_HCL_DEBUG_STATS_LEVEL;
 extern GlobalConfString GCFG_HCL_DEBUG_STATS_FILE;
 extern GlobalConfString GCFG_HABANA_PROFILE;
+extern GlobalConfBool   GCFG_HCL_COMM_PROFILE;
+extern GlobalConfString GCFG_HCL_COMM_PROFILE_FILE;
+extern GlobalConfBool   GCFG_HCL_COMM_STATS;
+extern GlobalConfBool   GCFG_HCL_COMM_INIT_PARALLEL;
 extern GlobalConfBool   GCFG_HCL_GET_IMB_SIZE_BC;
 extern GlobalConfInt64  GCFG_BURST_SIZE;
 extern GlobalConfInt64  GCFG_REQUESTER_PRIORITY;
@@ -52,6 +58,13 @@ extern GlobalConfInt64  GCFG_HCCL_TRIALS;
 extern GlobalConfBool   GCFG_HCL_RS_SO_RECV_CONT_REDUCTION;
 
 extern GlobalConfSize GCFG_HCL_COMPLEX_BCAST_MIN_SIZE;
+extern GlobalConfUint64 GCFG_HCL_SCALEOUT_BCAST_TREE;
+extern GlobalConfSize   GCFG_HCL_SCALEOUT_BCAST_TREE_MAX_SIZE;
+extern GlobalConfSize   GCFG_HCL_SCALEOUT_BCAST_CHAIN_CHUNK_SIZE;
+extern GlobalConfBool   GCFG_HCL_TOPOLOGY_REORDER;
+extern GlobalConfString GCFG_HCL_TOPOLOGY_SWITCH_ID;
+extern GlobalConfString GCFG_HCL_TOPOLOGY_FILE;
+extern GlobalConfString GCFG_HCL_TOPOLOGY_CACHE_DIR;
 extern GlobalConfBool GCFG_HCL_USE_SINGLE_PEER_BROADCAST;
 extern GlobalConfBool GCFG_HCL_IS_SINGLE_PEER_BROADCAST_ALLOWED;
 
@@ -60,20 +73,42 @@ extern GlobalConfInt64  GCFG_HOST_SCHEDULER_SLEEP_THRESHOLD;
 extern GlobalConfInt64  GCFG_HOST_SCHEDULER_SLEEP_DURATION;
 extern GlobalConfInt64  GCFG_HOST_SCHEDULER_THREADS;
 extern GlobalConfInt64  GCFG_HOST_SCHEDULER_STREAM_DEPTH_PROC;
+extern GlobalConfBool   GCFG_HOST_SCHEDULER_BATCH_POSTS;
+extern GlobalConfBool   GCFG_HCL_PRIORITY_CLASSES;
+extern GlobalConfSize   GCFG_HCL_PRIORITY_SMALL_OP_MAX_SIZE;
+extern GlobalConfUint64 GCFG_HCL_PRIORITY_BULK_MAX_SKIP;
+extern GlobalConfBool   GCFG_HCL_GROUP_FUSION;
+extern GlobalConfSize   GCFG_HCL_GROUP_FUSION_THRESHOLD;
+extern GlobalConfSize   GCFG_HCL_GROUP_FUSION_BUFFER_SIZE;
 extern GlobalConfInt64  GCFG_OFI_CQ_BURST_PROC;
 extern GlobalConfUint64 GCFG_HCL_OFI_MAX_RETRY_DURATION;
+extern GlobalConfBool   GCFG_HCL_OFI_ZERO_COPY;
+extern GlobalConfSize   GCFG_HCL_OFI_ZERO_COPY_MIN_SIZE;
+extern GlobalConfUint64 GCFG_HCL_OFI_MR_CACHE_MAX_ENTRIES;
+extern GlobalConfSize   GCFG_HCL_OFI_MR_CACHE_MAX_SIZE;
+extern GlobalConfBool   GCFG_HCL_HNIC_HYBRID_PATH;
+extern GlobalConfSize   GCFG_HCL_HNIC_HYBRID_DIRECT_MIN_SIZE;
+extern GlobalConfBool   GCFG_HCL_OFI_LOOPBACK;
+extern GlobalConfUint64 GCFG_HCL_OFI_LOOPBACK_LATENCY_NS;
+extern GlobalConfUint64 GCFG_HCL_OFI_LOOPBACK_BW_MBPS;
+extern GlobalConfSize   GCFG_HCL_OFI_LOOPBACK_INBOX_SIZE;
+extern GlobalConfBool   GCFG_HCL_HOST_BUFFERS_NUMA_BIND;
+extern GlobalConfSize   GCFG_HCL_HOST_BUFFERS_HUGE_PAGE_SIZE;
 
 extern GlobalConfSize GCFG_MTU_SIZE;
 extern GlobalConfSize GCFG_HCL_SRAM_SIZE_RESERVED_FOR_HCL;
 extern GlobalConfBool GCFG_HCL_FAIL_ON_CHECK_SIGNALS;
 extern GlobalConfBool GCFG_HCL_ALLOW_GRAPH_CACHING;
 
+extern GlobalConfUint64 GCFG_HCL_GRAPH_CACHE_MAX_ENTRIES;
+
 extern GlobalConfString GCFG_HCL_RDMA_DEFAULT_PATH;
 extern GlobalConfBool   GCFG_HCL_IBV_GID_SYSFS;
 extern GlobalConfBool   GCFG_HCL_USE_NIC_COMPRESSION;
 
 extern GlobalConfBool   GCFG_HCL_NULL_SUBMIT;
 extern GlobalConfUint64 GCFG_HCCL_PRIM_COLLECTIVE_MASK;
+extern GlobalConfBool   GCFG_HCCL_PRIM_GRAPH_OPTIMIZE;
 
 extern GlobalConfBool   GCFG_HCL_COLLECTIVE_LOG;
 extern GlobalConfInt64  GCFG_OP_DRIFT_THRESHOLD_MS;
@@ -123,6 +158,7 @@ extern GlobalConfUint64 GCFG_HCL_FAULT_TOLERANCE_COMM_POLL_INTERVAL;
 extern GlobalConfBool   GCFG_HCL_FAULT_TOLERANCE_ENABLE;
 extern GlobalConfUint64 GCFG_HCL_FAULT_TOLERANCE_LOGICAL_PORTS_SHUTDOWN_MASK;
 extern GlobalConfUint64 GCFG_HCL_FAULT_TOLERANCE_FAILBACK_DELAY;
+extern GlobalConfBool   GCFG_HCL_FAULT_TOLERANCE_FAST_FAILOVER;
 
 // DFA related definitions
 extern GlobalConfBool GCFG_HCL_DFA_DUMP_MEMORY;
@@ -101,6 +101,7 @@ struct HostNicConnectInfo
  * @brief minimal Rank data required for coordinator 1'st handshake
  */
 #define HOSTNAME_MAX_LENGTH 256
+#define SWITCH_ID_LENGTH    64
 struct __attribute__((packed)) RankInfoHeader
 {
     HCL_Rank hcclRank = 0;
@@ -113,6 +114,8 @@ struct __attribute__((packed)) RankInfoHeader
     uint64_t         apiCounter                    = 0;      // for migration
     bool             L3                            = false;  //  gnic configuration. false - L2(MAC), true - L3(IP)
     uint64_t         failedScaleOutPortsMask       = 0;
+    char             switchId[SWITCH_ID_LENGTH]    = "";     // scaleout switch of the host, used for box reordering
+    uint64_t         boxRingHash                   = 0;      // scaleout box order, compared in the second handshake
 };
 
 struct __attribute__((packed)) FtSyncCountersInfoHeader
@@ -124,7 +127,9 @@ struct __attribute__((packed)) FtSyncCountersInfoHeader
     bool myCountersReached =
         false;  // Client -> Server only: Sends true in FT when this rank API counters reached their target in FT stage
                 // FTwaitMaxCounters. Sends false when coordinator sends a new max counters value
-    uint8_t __padding__[3] = {};
+    bool deltaCounters = false;  // Client -> Server only: followed by FtSyncCountersDeltaEntry of the peers whose
+                                 // counters changed since the previous exchange, instead of all ranks counters
+    uint8_t __padding__[2] = {};
 };
 
 /**
@@ -150,6 +155,12 @@ struct FtSyncCountersRemoteInfo
     } counters;
 };
 
+struct FtSyncCountersDeltaEntry
+{
+    HCL_Rank                 rank;
+    FtSyncCountersRemoteInfo remoteInfo;
+};
+
 /**
  * @brief holds device common fields for local and remote rank
  *        (RankInfo and RemoteDeviceConnectionInfo)
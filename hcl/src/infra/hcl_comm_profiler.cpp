@@ -0,0 +1,159 @@
+#include "infra/hcl_comm_profiler.h"
+
+#include <algorithm>          // for nth_element, min_element, max_element
+#include <fstream>            // for ofstream
+#include <nlohmann/json.hpp>  // for json
+#include "hcl_global_conf.h"  // for GCFG_HCL_COMM_PROFILE*
+#include "hcl_utils.h"        // for LOG_HCL_*
+#include "hcl_log_manager.h"  // for LOG_*
+
+using json = nlohmann::json;
+
+namespace
+{
+struct PhaseInfo
+{
+    const char*      name;
+    CommProfilePhase parent;
+};
+
+const std::array<PhaseInfo, COMM_PHASE_MAX> s_phases = {{
+    {"init", COMM_PHASE_MAX},
+    {"device_comm", COMM_PHASE_INIT},
+    {"bootstrap", COMM_PHASE_INIT},
+    {"rank_data_exchange", COMM_PHASE_INIT},
+    {"barrier", COMM_PHASE_INIT_RANK_DATA},
+    {"comm_setup", COMM_PHASE_INIT},
+    {"connectivity", COMM_PHASE_INIT},
+    {"connections", COMM_PHASE_INIT},
+    {"scaleup_qps", COMM_PHASE_INIT_CONNECTIONS},
+    {"scaleout_connections", COMM_PHASE_INIT_CONNECTIONS},
+    {"qps_data_exchange", COMM_PHASE_INIT},
+    {"barrier", COMM_PHASE_INIT_QPS_DATA},
+    {"connect_qps", COMM_PHASE_INIT},
+    {"final_barrier", COMM_PHASE_INIT},
+    {"device_init", COMM_PHASE_INIT},
+    {"destroy", COMM_PHASE_MAX},
+    {"finalize", COMM_PHASE_DESTROY},
+    {"device_destroy", COMM_PHASE_DESTROY},
+}};
+
+thread_local CommProfiler* s_currentProfiler = nullptr;
+
+json localPhase(const CommPhaseTimes& times, CommProfilePhase phase)
+{
+    json node = {{"name", s_phases[phase].name}, {"us", times.us[phase]}};
+    for (unsigned child = 0; child < COMM_PHASE_MAX; child++)
+    {
+        if (s_phases[child].parent == phase)
+        {
+            node["phases"].push_back(localPhase(times, (CommProfilePhase)child));
+        }
+    }
+    return node;
+}
+
+json aggregatedPhase(const std::vector<CommPhaseTimes>& ranks, CommProfilePhase phase)
+{
+    std::vector<uint64_t> values(ranks.size());
+    for (size_t rank = 0; rank < ranks.size(); rank++)
+    {
+        values[rank] = ranks[rank].us[phase];
+    }
+    const auto     maxIt   = std::max_element(values.begin(), values.end());
+    const size_t   slowest = maxIt - values.begin();
+    const uint64_t max     = *maxIt;
+    const uint64_t min     = *std::min_element(values.begin(), values.end());
+    std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+
+    json node = {{"name", s_phases[phase].name},
+                 {"min_us", min},
+                 {"median_us", values[values.size() / 2]},
+                 {"max_us", max},
+                 {"slowest_rank", slowest}};
+    for (unsigned child = 0; child < COMM_PHASE_MAX; child++)
+    {
+        if (s_phases[child].parent == phase)
+        {
+            node["phases"].push_back(aggregatedPhase(ranks, (CommProfilePhase)child));
+        }
+    }
+    return node;
+}
+}  // namespace
+
+CommProfiler::Scope::Scope(CommProfiler* profiler) : m_prev(s_currentProfiler)
+{
+    s_currentProfiler = profiler;
+}
+
+CommProfiler::Scope::~Scope()
+{
+    s_currentProfiler = m_prev;
+}
+
+bool CommProfiler::enabled()
+{
+    return GCFG_HCL_COMM_PROFILE.value();
+}
+
+CommProfiler* CommProfiler::current()
+{
+    return s_currentProfiler;
+}
+
+void CommProfiler::log(CommProfilePhase root, HCL_Comm comm, HCL_Rank rank) const
+{
+    const json local = {{"comm", comm}, {"rank", rank}, {"phases", {localPhase(m_times, root)}}};
+    LOG_HCL_INFO(HCL, "Comm {} rank {} {} profile: {}", comm, rank, s_phases[root].name, local.dump());
+}
+
+std::string CommProfiler::report(HCL_Comm comm, const std::vector<CommPhaseTimes>& ranks)
+{
+    VERIFY(!ranks.empty(), "Comm {} profile report without ranks", comm);
+
+    const json init   = aggregatedPhase(ranks, COMM_PHASE_INIT);
+    const json report = {{"comm", comm},
+                         {"ranks", ranks.size()},
+                         {"slowest_rank", init["slowest_rank"]},
+                         {"phases", {init}}};
+    return report.dump(2);
+}
+
+void CommProfiler::emitReport(HCL_Comm comm, const std::string& report)
+{
+    const std::string& prefix = GCFG_HCL_COMM_PROFILE_FILE.value();
+    if (prefix.empty())
+    {
+        LOG_HCL_INFO(HCL, "Comm {} init profile: {}", comm, report);
+        return;
+    }
+
+    const std::string fileName = prefix + std::to_string(comm) + ".json";
+    std::ofstream     file(fileName);
+    if (!file.good())
+    {
+        LOG_HCL_ERR(HCL, "Comm {} failed to open init profile file {}", comm, fileName);
+        return;
+    }
+    file << report << std::endl;
+    LOG_HCL_INFO(HCL, "Comm {} init profile written to {}", comm, fileName);
+}
+
+CommPhaseTimer::CommPhaseTimer(CommProfilePhase phase, CommProfiler* profiler) : m_profiler(profiler), m_phase(phase)
+{
+    if (m_profiler != nullptr)
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+void CommPhaseTimer::stop()
+{
+    if (m_profiler != nullptr)
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_profiler->add(m_phase, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        m_profiler = nullptr;
+    }
+}
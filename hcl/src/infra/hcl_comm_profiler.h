@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>    // for array
+#include <chrono>   // for steady_clock
+#include <cstdint>  // for uint*_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "hcl_api_types.h"  // for HCL_Comm
+#include "hcl_inc.h"        // for HCL_Rank
+
+/**
+ * @brief Timed phases of communicator init and destroy, nested as listed. Barrier phases are the time a rank waits at
+ * the coordinator for the other ranks.
+ */
+enum CommProfilePhase : uint8_t
+{
+    COMM_PHASE_INIT = 0,
+    COMM_PHASE_INIT_DEVICE_COMM,   // comm allocation, ibverbs and QP managers
+    COMM_PHASE_INIT_BOOTSTRAP,     // coordinator client start
+    COMM_PHASE_INIT_RANK_DATA,     // first handshake
+    COMM_PHASE_INIT_RANK_DATA_BARRIER,
+    COMM_PHASE_INIT_COMM_SETUP,    // config, dynamic comm and device comm start
+    COMM_PHASE_INIT_CONNECTIVITY,  // scaleout ports mask and remote devices
+    COMM_PHASE_INIT_CONNECTIONS,   // comm validation and QPs / host NIC connections
+    COMM_PHASE_INIT_SCALEUP_QPS,
+    COMM_PHASE_INIT_SCALEOUT_CONNECTIONS,
+    COMM_PHASE_INIT_QPS_DATA,      // second handshake
+    COMM_PHASE_INIT_QPS_DATA_BARRIER,
+    COMM_PHASE_INIT_CONNECT_QPS,
+    COMM_PHASE_INIT_FINAL_BARRIER,
+    COMM_PHASE_INIT_DEVICE,        // fault tolerance and collective routines
+    COMM_PHASE_DESTROY,
+    COMM_PHASE_DESTROY_FINALIZE,   // wait for the comm's stream work
+    COMM_PHASE_DESTROY_DEVICE,
+    COMM_PHASE_MAX
+};
+
+/**
+ * @brief Accumulated time of each phase of a single rank, in microseconds. Sent as-is to the coordinator.
+ */
+struct CommPhaseTimes
+{
+    std::array<uint64_t, COMM_PHASE_MAX> us = {};
+};
+
+/**
+ * @brief Per rank phase timer of a communicator, enabled by HCL_COMM_PROFILE.
+ *
+ * Phases are timed by CommPhaseTimer against the profiler made current for the thread by CommProfiler::Scope, so
+ * code shared with the runtime (coordinator client, device QP setup) is only timed on the init/destroy path.
+ */
+class CommProfiler
+{
+public:
+    class Scope
+    {
+    public:
+        explicit Scope(CommProfiler* profiler);
+        ~Scope();
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        CommProfiler* const m_prev;
+    };
+
+    static bool          enabled();
+    static CommProfiler* current();
+
+    void                  add(CommProfilePhase phase, uint64_t us) { m_times.us[phase] += us; }
+    const CommPhaseTimes& times() const { return m_times; }
+
+    /**
+     * @brief Log the subtree of root phase of this rank as JSON.
+     */
+    void log(CommProfilePhase root, HCL_Comm comm, HCL_Rank rank) const;
+
+    /**
+     * @brief JSON report of the init phases of all ranks: per phase min, median, max and the slowest rank, nested as
+     * the phases. ranks[i] holds the times of rank i.
+     */
+    static std::string report(HCL_Comm comm, const std::vector<CommPhaseTimes>& ranks);
+
+    /**
+     * @brief Write report to HCL_COMM_PROFILE_FILE<comm>.json, or log it if no file is configured.
+     */
+    static void emitReport(HCL_Comm comm, const std::string& report);
+
+private:
+    CommPhaseTimes m_times;
+};
+
+/**
+ * @brief Adds the time from construction to stop() or destruction to a phase. No-op without a current profiler.
+ */
+class CommPhaseTimer
+{
+public:
+    explicit CommPhaseTimer(CommProfilePhase phase, CommProfiler* profiler = CommProfiler::current());
+    ~CommPhaseTimer() { stop(); }
+
+    CommPhaseTimer(const CommPhaseTimer&)            = delete;
+    CommPhaseTimer& operator=(const CommPhaseTimer&) = delete;
+
+    void stop();
+
+private:
+    CommProfiler*                         m_profiler;
+    const CommProfilePhase                m_phase;
+    std::chrono::steady_clock::time_point m_start;
+};
@@ -0,0 +1,125 @@
+#include "infra/hcl_comm_stats.h"
+
+#include "hcl_global_conf.h"  // for GCFG_HCL_COMM_STATS
+#include "hcl_utils.h"        // for VERIFY
+
+namespace
+{
+std::atomic<unsigned> s_nextThreadSlot {0};
+
+unsigned threadSlotIndex()
+{
+    thread_local const unsigned s_threadSlot = s_nextThreadSlot.fetch_add(1, std::memory_order_relaxed);
+    return s_threadSlot;
+}
+}  // namespace
+
+CommStats::OpScope::OpScope(CommStats& stats, hcclStatsOp_t op, uint64_t bytes)
+: m_stats(stats.enabled() ? &stats : nullptr), m_op(op), m_bytes(bytes)
+{
+    if (m_stats != nullptr)
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+CommStats::OpScope::~OpScope()
+{
+    if (m_stats != nullptr)
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_stats->addOp(m_op, m_bytes, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+}
+
+CommStats::CommStats() : m_enabled(GCFG_HCL_COMM_STATS.value()) {}
+
+CommStats::Slot& CommStats::slot()
+{
+    return m_slots[threadSlotIndex() % NUM_SLOTS];
+}
+
+void CommStats::addOp(hcclStatsOp_t op, uint64_t bytes, uint64_t submitTimeNs)
+{
+    if (!m_enabled) return;
+
+    OpCounters& counters = slot().ops[op];
+    add(counters.calls, 1);
+    add(counters.bytes, bytes);
+    add(counters.submitTimeNs, submitTimeNs);
+}
+
+void CommStats::addScaleoutPost(bool isSend, unsigned qpSet, uint64_t bytes)
+{
+    if (!m_enabled) return;
+
+    VERIFY(qpSet < MAX_HNIC_CONNECTION_SETS, "Invalid QP set {}", qpSet);
+    Slot& s = slot();
+    add(isSend ? s.scaleoutSendBytes[qpSet] : s.scaleoutRecvBytes[qpSet], bytes);
+    add(s.scaleoutPosts, 1);
+}
+
+void CommStats::addScaleoutCompletion()
+{
+    if (!m_enabled) return;
+
+    add(slot().scaleoutCompletions, 1);
+}
+
+void CommStats::addCreditStall(uint64_t stallOps)
+{
+    if (!m_enabled) return;
+
+    Slot& s = slot();
+    add(s.creditStalls, 1);
+    add(s.creditStallOps, stallOps);
+}
+
+void CommStats::addGraphCacheLookup(bool hit)
+{
+    if (!m_enabled) return;
+
+    Slot& s = slot();
+    add(hit ? s.graphCacheHits : s.graphCacheMisses, 1);
+}
+
+void CommStats::addScaleoutPath(bool isDirect)
+{
+    if (!m_enabled) return;
+
+    Slot& s = slot();
+    add(isDirect ? s.scaleoutDirectOps : s.scaleoutBounceOps, 1);
+}
+
+void CommStats::get(hcclCommStats_t& stats) const
+{
+    stats = {};
+
+    uint64_t scaleoutPosts       = 0;
+    uint64_t scaleoutCompletions = 0;
+    for (const Slot& s : m_slots)
+    {
+        for (unsigned op = 0; op < hcclStatsNumOps; op++)
+        {
+            stats.ops[op].calls += s.ops[op].calls.load(std::memory_order_relaxed);
+            stats.ops[op].bytes += s.ops[op].bytes.load(std::memory_order_relaxed);
+            stats.ops[op].submitTimeNs += s.ops[op].submitTimeNs.load(std::memory_order_relaxed);
+        }
+        for (unsigned qpSet = 0; qpSet < MAX_HNIC_CONNECTION_SETS; qpSet++)
+        {
+            stats.scaleoutSendBytes[qpSet] += s.scaleoutSendBytes[qpSet].load(std::memory_order_relaxed);
+            stats.scaleoutRecvBytes[qpSet] += s.scaleoutRecvBytes[qpSet].load(std::memory_order_relaxed);
+        }
+        scaleoutPosts += s.scaleoutPosts.load(std::memory_order_relaxed);
+        scaleoutCompletions += s.scaleoutCompletions.load(std::memory_order_relaxed);
+        stats.creditStalls += s.creditStalls.load(std::memory_order_relaxed);
+        stats.creditStallOps += s.creditStallOps.load(std::memory_order_relaxed);
+        stats.graphCacheHits += s.graphCacheHits.load(std::memory_order_relaxed);
+        stats.graphCacheMisses += s.graphCacheMisses.load(std::memory_order_relaxed);
+        stats.scaleoutDirectOps += s.scaleoutDirectOps.load(std::memory_order_relaxed);
+        stats.scaleoutBounceOps += s.scaleoutBounceOps.load(std::memory_order_relaxed);
+    }
+
+    // completions are counted by another thread than the posts, so a read between the two may see more of them
+    stats.scaleoutPending = scaleoutPosts > scaleoutCompletions ? scaleoutPosts - scaleoutCompletions : 0;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>    // for array
+#include <atomic>   // for atomic
+#include <chrono>   // for steady_clock
+#include <cstdint>  // for uint*_t
+
+#include "hccl_types.h"  // for hcclCommStats_t, hcclStatsOp_t
+#include "hcl_consts.h"  // for MAX_HNIC_CONNECTION_SETS
+
+static_assert(MAX_HNIC_CONNECTION_SETS == HCCL_STATS_MAX_QP_SETS, "hcclCommStats_t must cover all the QP sets");
+
+/**
+ * @brief Cumulative counters of a communicator, read by hcclCommGetStats. Enabled by HCL_COMM_STATS.
+ *
+ * The counters are updated by the API threads and the host scheduler threads. Each thread adds to its own cache line
+ * aligned slot with relaxed atomics, so updates never share a line between threads (unless there are more threads
+ * than slots) and cost a plain add; a read sums all the slots.
+ */
+class CommStats
+{
+public:
+    /**
+     * @brief Counts a call of an op on destruction, with the host time spent since construction.
+     */
+    class OpScope
+    {
+    public:
+        OpScope(CommStats& stats, hcclStatsOp_t op, uint64_t bytes);
+        ~OpScope();
+
+        OpScope(const OpScope&)            = delete;
+        OpScope& operator=(const OpScope&) = delete;
+
+    private:
+        CommStats* const                      m_stats;
+        const hcclStatsOp_t                   m_op;
+        const uint64_t                        m_bytes;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    CommStats();
+
+    bool enabled() const { return m_enabled; }
+
+    void addOp(hcclStatsOp_t op, uint64_t bytes, uint64_t submitTimeNs);
+    void addScaleoutPost(bool isSend, unsigned qpSet, uint64_t bytes);
+    void addScaleoutCompletion();
+    void addCreditStall(uint64_t stallOps);
+    void addGraphCacheLookup(bool hit);
+    void addScaleoutPath(bool isDirect);
+
+    void get(hcclCommStats_t& stats) const;
+
+private:
+    static constexpr unsigned NUM_SLOTS = 16;
+
+    struct OpCounters
+    {
+        std::atomic<uint64_t> calls {0};
+        std::atomic<uint64_t> bytes {0};
+        std::atomic<uint64_t> submitTimeNs {0};
+    };
+
+    struct alignas(64) Slot
+    {
+        std::array<OpCounters, hcclStatsNumOps>                     ops;
+        std::array<std::atomic<uint64_t>, MAX_HNIC_CONNECTION_SETS> scaleoutSendBytes {};
+        std::array<std::atomic<uint64_t>, MAX_HNIC_CONNECTION_SETS> scaleoutRecvBytes {};
+        std::atomic<uint64_t>                                       scaleoutPosts {0};
+        std::atomic<uint64_t>                                       scaleoutCompletions {0};
+        std::atomic<uint64_t>                                       creditStalls {0};
+        std::atomic<uint64_t>                                       creditStallOps {0};
+        std::atomic<uint64_t>                                       graphCacheHits {0};
+        std::atomic<uint64_t>                                       graphCacheMisses {0};
+        std::atomic<uint64_t>                                       scaleoutDirectOps {0};
+        std::atomic<uint64_t>                                       scaleoutBounceOps {0};
+    };
+
+    // exact when threads share a slot, uncontended otherwise
+    static void add(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    Slot& slot();
+
+    const bool                  m_enabled;
+    std::array<Slot, NUM_SLOTS> m_slots;
+};
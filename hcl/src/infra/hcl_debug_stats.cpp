@@ -183,12 +183,34 @@ void HclDebugStats::printPerformanceStatistic(bool normalExit)
         }
     }
 
+    {
+        std::unique_lock<std::mutex> lock(m_countersMutex);
+        if (!m_counters.empty())
+        {
+            *out << std::endl << "counter, value" << std::endl;
+            for (auto& [name, value] : m_counters)
+            {
+                *out << name << " , " << value << std::endl;
+                if (!normalExit)
+                {
+                    LOG_ERR(HCL, "{} , {}", name, value);
+                }
+            }
+        }
+    }
+
     if (outFfile.good() && outFfile.is_open())
     {
         outFfile.close();
     }
 }
 
+void HclDebugStats::addCounter(const std::string& name, uint64_t value)
+{
+    std::unique_lock<std::mutex> lock(m_countersMutex);
+    m_counters[name] += value;
+}
+
 // print collected info in case of error
 // if HclDebugStats destructor executed - program successfully complete, so print performance statistic only if enabled
 void HclDebugStats::printStats(bool normalExit)
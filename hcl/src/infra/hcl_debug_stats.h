@@ -153,6 +153,9 @@ public:
                       size_t             argsSize        = 0);
     void setThreadName(const char* threadName);
 
+    // Named counters accumulated by components (e.g. caches) and reported along the function statistic
+    void addCounter(const std::string& name, uint64_t value);
+
 private:
     void addLocalFuncStorage(HclThreadDebugStats* thInfo);
     void removeLocalFuncStorage(HclThreadDebugStats* thInfo);
@@ -164,11 +167,13 @@ private:
     std::map<std::thread::id, func_time_map*> m_workingFunc;
     std::map<std::thread::id, std::string>    m_threadNames;
     std::list<func_time_map>                  m_completedThreadsStatsVec;
+    std::map<std::string, uint64_t>           m_counters;
 
     static thread_local HclThreadDebugStats m_threadInfo;
 
     bool       m_printDone = false;
     std::mutex m_printMutex;
+    std::mutex m_countersMutex;
 
     std::string m_statisticFileName = "hcl_stats_";  // some uniq id and .csv will be added
 };
@@ -133,24 +133,47 @@ inline bool either_log_levels_at_least(const hcl::LogManager::LogType logType, i
     return hl_logger::anyLogLevelAtLeast(logType, level);
 }
 
-#define LOG_LEVEL_AT_LEAST_TRACE(log_type)    HLLOG_LEVEL_AT_LEAST_TRACE(log_type)
-#define LOG_LEVEL_AT_LEAST_DEBUG(log_type)    HLLOG_LEVEL_AT_LEAST_DEBUG(log_type)
-#define LOG_LEVEL_AT_LEAST_INFO(log_type)     HLLOG_LEVEL_AT_LEAST_INFO(log_type)
-#define LOG_LEVEL_AT_LEAST_WARN(log_type)     HLLOG_LEVEL_AT_LEAST_WARN(log_type)
-#define LOG_LEVEL_AT_LEAST_ERR(log_type)      HLLOG_LEVEL_AT_LEAST_ERR(log_type)
-#define LOG_LEVEL_AT_LEAST_CRITICAL(log_type) HLLOG_LEVEL_AT_LEAST_CRITICAL(log_type)
+/**
+ * Log statements below HCL_MIN_LOG_LEVEL (HLLOG_LEVEL_*) are compiled out, e.g. build with -DHCL_MIN_LOG_LEVEL=2 to
+ * keep only info and above. Compiled out statements are still parsed, so their arguments are type checked and don't
+ * become unused variables, but nothing is evaluated. Levels that are compiled in are checked at runtime against the
+ * per-logger level cached by hl_logger before any argument is evaluated.
+ */
+#ifndef HCL_MIN_LOG_LEVEL
+#define HCL_MIN_LOG_LEVEL HLLOG_LEVEL_TRACE
+#endif
+#define LOG_LEVEL_COMPILED(level) ((level) >= HCL_MIN_LOG_LEVEL)
+
+#define LOG_LEVEL_AT_LEAST_TRACE(log_type)                                                                             \
+    (LOG_LEVEL_COMPILED(HLLOG_LEVEL_TRACE) && HLLOG_LEVEL_AT_LEAST_TRACE(log_type))
+#define LOG_LEVEL_AT_LEAST_DEBUG(log_type)                                                                             \
+    (LOG_LEVEL_COMPILED(HLLOG_LEVEL_DEBUG) && HLLOG_LEVEL_AT_LEAST_DEBUG(log_type))
+#define LOG_LEVEL_AT_LEAST_INFO(log_type) (LOG_LEVEL_COMPILED(HLLOG_LEVEL_INFO) && HLLOG_LEVEL_AT_LEAST_INFO(log_type))
+#define LOG_LEVEL_AT_LEAST_WARN(log_type) (LOG_LEVEL_COMPILED(HLLOG_LEVEL_WARN) && HLLOG_LEVEL_AT_LEAST_WARN(log_type))
+#define LOG_LEVEL_AT_LEAST_ERR(log_type)  (LOG_LEVEL_COMPILED(HLLOG_LEVEL_ERROR) && HLLOG_LEVEL_AT_LEAST_ERR(log_type))
+#define LOG_LEVEL_AT_LEAST_CRITICAL(log_type)                                                                          \
+    (LOG_LEVEL_COMPILED(HLLOG_LEVEL_CRITICAL) && HLLOG_LEVEL_AT_LEAST_CRITICAL(log_type))
 
 #define SEPARATOR_STR "+------------------------------------------------------------"
 
 #define TITLE_STR(msg, ...)                                                                                            \
     "{}", fmt::format("{:=^120}", fmt::format((strlen(msg) == 0) ? "" : " " msg " ", ##__VA_ARGS__))
 
-#define LOG_TRACE(log_type, msg, ...)    HLLOG_TRACE(log_type, msg, ##__VA_ARGS__);
-#define LOG_DEBUG(log_type, msg, ...)    HLLOG_DEBUG(log_type, msg, ##__VA_ARGS__);
-#define LOG_INFO(log_type, msg, ...)     HLLOG_INFO(log_type, msg, ##__VA_ARGS__);
-#define LOG_WARN(log_type, msg, ...)     HLLOG_WARN(log_type, msg, ##__VA_ARGS__);
-#define LOG_ERR(log_type, msg, ...)      HLLOG_ERR(log_type, msg, ##__VA_ARGS__);
-#define LOG_CRITICAL(log_type, msg, ...) HLLOG_CRITICAL(log_type, msg, ##__VA_ARGS__);
+#define LOG_TYPED(log_type, level, msg, ...)                                                                           \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr (LOG_LEVEL_COMPILED(level))                                                                       \
+        {                                                                                                              \
+            HLLOG_TYPED(log_type, level, msg, ##__VA_ARGS__);                                                          \
+        }                                                                                                              \
+    } while (false);
+
+#define LOG_TRACE(log_type, msg, ...)    LOG_TYPED(log_type, HLLOG_LEVEL_TRACE, msg, ##__VA_ARGS__)
+#define LOG_DEBUG(log_type, msg, ...)    LOG_TYPED(log_type, HLLOG_LEVEL_DEBUG, msg, ##__VA_ARGS__)
+#define LOG_INFO(log_type, msg, ...)     LOG_TYPED(log_type, HLLOG_LEVEL_INFO, msg, ##__VA_ARGS__)
+#define LOG_WARN(log_type, msg, ...)     LOG_TYPED(log_type, HLLOG_LEVEL_WARN, msg, ##__VA_ARGS__)
+#define LOG_ERR(log_type, msg, ...)      LOG_TYPED(log_type, HLLOG_LEVEL_ERROR, msg, ##__VA_ARGS__)
+#define LOG_CRITICAL(log_type, msg, ...) LOG_TYPED(log_type, HLLOG_LEVEL_CRITICAL, msg, ##__VA_ARGS__)
 
 #define LOG_TRACE_T    LOG_TRACE
 #define LOG_DEBUG_T    LOG_DEBUG
@@ -164,7 +187,8 @@ inline bool either_log_levels_at_least(const hcl::LogManager::LogType logType, i
     {                                                                                                                  \
         static_assert(std::is_convertible_v<decltype(period), std::chrono::microseconds>,                              \
                       "period must be of std::chrono::duration type");                                                 \
-        if (HLLOG_UNLIKELY(hl_logger::logLevelAtLeast(HLLOG_ENUM_TYPE_NAME::log_type, logLevel)))                      \
+        if (LOG_LEVEL_COMPILED(logLevel) &&                                                                            \
+            HLLOG_UNLIKELY(hl_logger::logLevelAtLeast(HLLOG_ENUM_TYPE_NAME::log_type, logLevel)))                      \
         {                                                                                                              \
             using time_point                             = std::chrono::time_point<std::chrono::steady_clock>;         \
             static time_point            epochStartPoint = std::chrono::steady_clock::now();                           \
@@ -293,7 +317,8 @@ constexpr bool isValidOp(const char* opName)
     static_assert(isValidOp(#opid), "Invalid operation provided: " #opid " (look at validSyncDbgOps)");                \
     do                                                                                                                 \
     {                                                                                                                  \
-        if (either_log_levels_at_least(hcl::LogManager::LogType::HCL_SYNC_DBG_TOOL, HLLOG_LEVEL_DEBUG))                \
+        if (LOG_LEVEL_COMPILED(HLLOG_LEVEL_DEBUG) &&                                                                   \
+            either_log_levels_at_least(hcl::LogManager::LogType::HCL_SYNC_DBG_TOOL, HLLOG_LEVEL_DEBUG))                \
         {                                                                                                              \
             LOG_DEBUG(HCL_SYNC_DBG_TOOL, "OP: opid" #opid " " description, ##__VA_ARGS__);                             \
         }                                                                                                              \
@@ -1,5 +1,7 @@
 #include "cyclic_buffer_manager.h"
 
+#include <algorithm>                                          // for max
+#include <chrono>                                             // for steady_clock, duration
 #include <cstdint>                                            // for uint64_t
 #include <string>                                             // for string
 #include "completion_group.h"                                 // for Complet...
@@ -42,7 +44,8 @@ CyclicBufferManager::CyclicBufferManager(ScalStreamBase*       scalStream,
   m_schedIdx(schedIdx),
   m_commands(commands),
   m_logOfBufferSize((uint64_t)std::log2(m_bufferSize)),
-  m_pi_mask((1 << m_logOfBufferSize) - 1)
+  m_pi_mask((1 << m_logOfBufferSize) - 1),
+  m_nullSubmitBuffer(std::max<uint64_t>(streamInfo.command_alignment, 256))  // big enough for any packet
 {
     VERIFY((bufferSize & m_pi_mask) == 0, "bufferSize {} must be a power of two", bufferSize);
 
@@ -119,13 +122,11 @@ void CyclicBufferManager::advanceAlignment(size_t size)
 
 void* CyclicBufferManager::getNextPtr(size_t size)
 {
-    constexpr int  dummyBuffSize = 256;  // big enough for any packet
-    static uint8_t dummyBuff[dummyBuffSize];
-
     if (m_disableCcb)
     {
-        assert(dummyBuffSize >= size);
-        return dummyBuff;
+        VERIFY(size <= m_nullSubmitBuffer.size(), "Packet size {} exceeds null submission buffer", size);
+        m_nullSubmitBytes += size;
+        return m_nullSubmitBuffer.data();
     }
 
     if (unlikely(size > m_sizeLeftInAlignment))
@@ -222,6 +223,32 @@ void CyclicBufferManager::submit(bool force)
     }
 }
 
+CyclicBufferManager::~CyclicBufferManager()
+{
+    if (m_nullSubmitBytes == 0) return;
+
+    const double seconds = std::chrono::duration<double>(m_nullSubmitTime).count();
+    LOG_HCL_INFO(HCL_SCAL,
+                 "On microStream {} null submission serialized {} bytes in {:.6f}s ({:g}MB/s)",
+                 m_streamName,
+                 m_nullSubmitBytes,
+                 seconds,
+                 seconds > 0 ? B2MB(m_nullSubmitBytes) / seconds : 0);
+}
+
+void CyclicBufferManager::disableCcb(bool disable)
+{
+    if (disable && !m_disableCcb)
+    {
+        m_nullSubmitStart = std::chrono::steady_clock::now();
+    }
+    else if (!disable && m_disableCcb)
+    {
+        m_nullSubmitTime += std::chrono::steady_clock::now() - m_nullSubmitStart;
+    }
+    m_disableCcb = disable;
+}
+
 bool CyclicBufferManager::isACcbHalfFullForDeviceBenchMark()
 {
     const bool ret                                     = CyclicBufferManager::s_ccbIsFullForDeviceBenchMark;
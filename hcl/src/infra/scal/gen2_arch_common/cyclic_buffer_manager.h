@@ -1,9 +1,11 @@
 #pragma once
 
 #include <array>                     // for array
+#include <chrono>                    // for steady_clock
 #include <cstddef>                   // for size_t
 #include <cstdint>                   // for uint64_t, uint32_t
 #include <string>                    // for string
+#include <vector>                    // for vector
 #include "scal.h"                    // for scal_stream_handle_t, scal_stream_info_t
 #include "hl_logger/hllog_core.hpp"  // for hl_logger::LoggerSPtr
 
@@ -45,7 +47,7 @@ public:
     CyclicBufferManager(const CyclicBufferManager&)            = delete;
     CyclicBufferManager& operator=(CyclicBufferManager&&)      = delete;
     CyclicBufferManager& operator=(const CyclicBufferManager&) = delete;
-    virtual ~CyclicBufferManager()                             = default;
+    virtual ~CyclicBufferManager();
 
     void        setTargetValue(uint64_t targetValue);
     void*       getNextPtr(size_t size);
@@ -55,7 +57,7 @@ public:
     void        updateCcbHalfFullMechanism();
 
     virtual uint64_t getPi() = 0;
-    void             disableCcb(bool disable) { m_disableCcb = disable; }
+    void             disableCcb(bool disable);
     void             dfaLog(hl_logger::LoggerSPtr synDevFailLog);
 
     static constexpr unsigned m_numberOfDivisions = 32;
@@ -96,5 +98,12 @@ protected:
     bool           m_disableCcb = false;  // used for null submission
     const uint64_t m_logOfBufferSize;     // Cyclic buffer size
     const uint64_t m_pi_mask;
+
+    // Null submission serializes every packet into this scratch buffer instead of the ccb. The bytes and the time
+    // null submission was on are accumulated over the whole run and reported once, when the stream is destroyed.
+    std::vector<uint8_t>                  m_nullSubmitBuffer;
+    uint64_t                              m_nullSubmitBytes = 0;
+    std::chrono::steady_clock::duration   m_nullSubmitTime  = std::chrono::steady_clock::duration::zero();
+    std::chrono::steady_clock::time_point m_nullSubmitStart;
 };
 }  // namespace hcl
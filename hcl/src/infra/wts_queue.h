@@ -1,6 +1,9 @@
 #pragma once
 #include "futex.h"
+#include <atomic>
 #include <deque>
+#include <memory>
+#include <thread>
 
 /**   Waitable Thread-Safe queue.
  *
@@ -92,6 +95,173 @@ public:
     }
 };
 
+/**   Waitable lock-free multi-producer single-consumer queue.
+ *
+ * A drop-in replacement of wts_queue_t for queues that are fed by several threads at high rates. Elements are kept
+ * in a bounded ring of CAPACITY slots, each with a sequence number that tells whether it is free for the producer of
+ * a given position or holds data for the consumer of that position. Producers claim a position with a single CAS on
+ * the head and publish the element by advancing the slot sequence, so push() neither locks nor allocates.
+ *
+ * The consumer spins for a while before going to sleep on the futex event, and producers signal the event only when
+ * the consumer is sleeping. When the ring is full, push() waits for the consumer to free a slot.
+ *
+ * Only a single thread may call wait_and_pop().
+ *
+ * @class wts_mpsc_ring_t
+ * @brief A bounded lock-free MPSC queue with the interface of wts_queue_t.
+ */
+template<typename T, size_t CAPACITY = 1024>
+class wts_mpsc_ring_t
+{
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of 2");
+
+private:
+    static constexpr size_t   CACHE_LINE_SIZE = 64;
+    static constexpr uint64_t MASK            = CAPACITY - 1;
+    static constexpr unsigned POP_SPIN_COUNT  = 2048;  // polls of an empty ring before sleeping on the event
+    static constexpr unsigned PUSH_SPIN_COUNT = 64;    // polls of a full ring before yielding
+
+    struct slot_t
+    {
+        std::atomic<uint64_t> seq;
+        T                     val;
+    };
+
+    // producers and the consumer update their indices on separate cache lines
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head_ {0};  // next position to claim
+    alignas(CACHE_LINE_SIZE) uint64_t tail_ = 0;               // next position to pop
+
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> sleeping_ {false};
+    std::atomic<bool>         exit_ {false};
+    event_t                   ready_;  // signaled when data is pushed while the consumer sleeps
+    std::unique_ptr<slot_t[]> slots_;
+
+    bool available() const { return slots_[tail_ & MASK].seq.load(std::memory_order_acquire) == tail_ + 1; }
+
+public:
+    wts_mpsc_ring_t(const wts_mpsc_ring_t&)            = delete;
+    wts_mpsc_ring_t& operator=(const wts_mpsc_ring_t&) = delete;
+    wts_mpsc_ring_t(wts_mpsc_ring_t&&)                 = delete;
+    wts_mpsc_ring_t& operator=(wts_mpsc_ring_t&&)      = delete;
+
+    wts_mpsc_ring_t() : slots_(new slot_t[CAPACITY])
+    {
+        for (uint64_t i = 0; i < CAPACITY; i++)
+        {
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+    virtual ~wts_mpsc_ring_t() = default;
+
+    /**
+     * @brief Pushes a value into the queue.
+     *
+     * Safe to call from any number of threads. Blocks while the ring is full.
+     *
+     * @param val The value to push into the queue.
+     */
+    void push(const T& val)
+    {
+        uint64_t pos   = head_.load(std::memory_order_relaxed);
+        unsigned spins = 0;
+        while (true)
+        {
+            slot_t&       slot = slots_[pos & MASK];
+            const int64_t diff = (int64_t)(slot.seq.load(std::memory_order_acquire) - pos);
+            if (diff == 0)
+            {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.val = val;
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // the ring is full, wait for the consumer to free the slot
+                if (++spins < PUSH_SPIN_COUNT)
+                {
+                    __builtin_ia32_pause();
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+                pos = head_.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+
+        // pairs with the fence in wait_and_pop(), either the consumer sees the data or we see it sleeping
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed))
+        {
+            ready_.signal();
+        }
+    }
+
+    /**
+     * @brief Waits for data to be available and pops it from the queue.
+     *
+     * Spins for a while on an empty queue before blocking on the event.
+     *
+     * @param val Reference to store the popped value.
+     * @return true if a value was successfully popped, false if the queue was released.
+     */
+    bool wait_and_pop(T& val)
+    {
+        unsigned spins = 0;
+        while (!available())
+        {
+            if (exit_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            if (++spins < POP_SPIN_COUNT)
+            {
+                __builtin_ia32_pause();
+                continue;
+            }
+
+            ready_.reset();
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!available() && !exit_.load(std::memory_order_acquire))
+            {
+                ready_.wait();
+            }
+            sleeping_.store(false, std::memory_order_relaxed);
+            spins = 0;
+        }
+
+        if (exit_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        slot_t& slot = slots_[tail_ & MASK];
+        val          = slot.val;
+        slot.seq.store(tail_ + CAPACITY, std::memory_order_release);
+        tail_++;
+
+        return true;
+    }
+
+    /**
+     * @brief Releases the queue and signals the waiting thread. Subsequent calls to wait_and_pop() return false.
+     */
+    void release()
+    {
+        exit_.store(true, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        ready_.signal();
+    }
+};
+
 /**
  * This class extends the `wts_queue_t` class to provide a mechanism for dispatching
  * elements from the queue to a user-defined function in a separate worker thread.
@@ -100,8 +270,8 @@ public:
  * which defines how each item in the queue should be processed.
  *
  */
-template<class T>
-class dispatcher_queue_t : public wts_queue_t<T>
+template<class T, class QUEUE = wts_queue_t<T>>
+class dispatcher_queue_t : public QUEUE
 {
 private:
     std::thread worker_;
@@ -123,7 +293,7 @@ public:
     {
         worker_ = std::thread([=]() {
             T val;
-            while (wts_queue_t<T>::wait_and_pop(val))
+            while (QUEUE::wait_and_pop(val))
             {
                 func(val);
             }
@@ -138,7 +308,14 @@ public:
      */
     virtual ~dispatcher_queue_t()
     {
-        wts_queue_t<T>::release();
+        QUEUE::release();
         worker_.join();
     }
-};
\ No newline at end of file
+};
+
+/**
+ * A dispatcher queue over the lock-free ring, for queues that are fed by several threads at high rates. The mutex
+ * based wts_queue_t stays the default, as it is unbounded and never blocks the producer.
+ */
+template<class T, size_t CAPACITY = 1024>
+using mpsc_dispatcher_queue_t = dispatcher_queue_t<T, wts_mpsc_ring_t<T, CAPACITY>>;
@@ -13,6 +13,7 @@
 #include <algorithm>                     // for unique
 #include <unordered_map>                 // for unordered_map
 #include <regex>                         // for regex, cregex_iterator, cmatch
+#include <set>                           // for set
 #include "hlthunk.h"                     // for hlthunk_get_pci_bus_id_from_fd
 #include "hccl/network_utils.h"          // for get_desired_tcp_if_from_env_var
 #include "hccl_ofi_wrapper_interface.h"  // for ofi_plugin_interface
@@ -32,6 +33,8 @@
 
 bool ofi_t::s_mrLocal     = false;
 bool ofi_t::s_gaudiDirect = false;
+bool ofi_t::s_zeroCopy    = false;
+bool ofi_t::s_userHmem    = false;
 bool ofi_t::s_verbs       = false;
 
 std::unique_ptr<ofi_plugin_interface> ofi_plugin;
@@ -253,7 +256,8 @@ std::optional<ofi_t::CORE_PROVIDER> ofi_t::get_core_provider(const std::string&
 {
     static const std::unordered_map<std::string, ofi_t::CORE_PROVIDER> core_providers {
         {"tcp", ofi_t::CORE_PROVIDER::TCP},
-        {"verbs", ofi_t::CORE_PROVIDER::VERBS}};
+        {"verbs", ofi_t::CORE_PROVIDER::VERBS},
+        {"loopback", ofi_t::CORE_PROVIDER::LOOPBACK}};
     for (const auto& [name, value] : core_providers)
     {
         if (provider_name.find(name) != std::string::npos)
@@ -381,14 +385,14 @@ bool ofi_t::exclude_verbs_provider(const fi_info* const provider, const uint64_t
     return false;
 }
 
-void get_hints(struct fi_info* const hints, const bool gaudi_direct)
+void get_hints(struct fi_info* const hints, const bool hmem)
 {
     hints->caps = FI_MSG | FI_TAGGED;
     // Set MR mode bits to indicate FI_MR_BASIC registration with local memory buffers
     // Will need to change if device memory can be accessed
     hints->domain_attr->mr_mode = FI_MR_LOCAL | FI_MR_VIRT_ADDR | FI_MR_ALLOCATED | FI_MR_PROV_KEY;
 
-    if (gaudi_direct)
+    if (hmem)
     {
         hints->caps |= FI_HMEM;
         hints->domain_attr->mr_mode |= FI_MR_HMEM;
@@ -405,7 +409,7 @@ void get_hints(struct fi_info* const hints, const bool gaudi_direct)
     hints->rx_attr->msg_order = FI_ORDER_SAS;
 }
 
-static int run_fi_getinfo(struct fi_info** providers, bool gaudi_direct)
+static int run_fi_getinfo(struct fi_info** providers, bool hmem)
 {
     struct fi_info* hints = ofi_plugin->w_fi_allocinfo();
     if (hints == NULL)
@@ -414,7 +418,7 @@ static int run_fi_getinfo(struct fi_info** providers, bool gaudi_direct)
         return hcclLibfabricError;
     }
 
-    get_hints(hints, gaudi_direct);
+    get_hints(hints, hmem);
     int rc = ofi_plugin->w_fi_getinfo(ofi_version, nullptr, nullptr, 0ULL, hints, providers);
     ofi_plugin->w_fi_freeinfo(hints);
 
@@ -427,14 +431,14 @@ static int run_fi_getinfo(struct fi_info** providers, bool gaudi_direct)
 
         if (rc == -FI_ENODATA)
         {
-            LOG_WARN(HCL_OFI, "Could not find any matching provider. Gaudi-direct was set to: {}", gaudi_direct);
+            LOG_WARN(HCL_OFI, "Could not find any matching provider. HMEM was set to: {}", hmem);
         }
 
         LOG_ERR(HCL_OFI,
-                "fi_getinfo() failed with rc {}, {}, gaudi_direct_mode: [{}]",
+                "fi_getinfo() failed with rc {}, {}, hmem_mode: [{}]",
                 rc,
                 ofi_plugin->w_fi_strerror(-rc),
-                gaudi_direct);
+                hmem);
         rc = hcclLibfabricError;
     }
 
@@ -490,7 +494,7 @@ bool ofi_t::checkDMABUFSupport()
 
 int ofi_t::init()
 {
-    int         ret;
+    int         ret = hcclSuccess;
     int         rc;
     bool        gaudi_direct_supported = false;
     std::string failure_str            = "";
@@ -599,30 +603,57 @@ int ofi_t::init()
         }
     }
 
-    m_gaudi_pci_dev = get_pci_info(get_gaudi_pci_ep_addr(m_device_fd));
+    // The loopback fabric doesn't involve a NIC, there is no point in locating the device on the PCIe tree
+    m_gaudi_pci_dev = GCFG_HCL_OFI_LOOPBACK.value() ? PCIE_Device {"", -1, "", ""}
+                                                    : get_pci_info(get_gaudi_pci_ep_addr(m_device_fd));
 
-    // If gaudi_direct_supported = true, attempt to get provider that supports gaudi-direct.
-    // Otherwise, get provider without gaudi-direct.
-    ret = get_ofi_provider(gaudi_direct_supported);
-    if ((ret != hcclSuccess) || (m_providers.size() == 0))
+    // Zero-copy registers user device buffers on demand, so it needs an HMEM capable provider just like gaudi-direct.
+    // It is only relevant for the host bounce buffers path; if no such provider is found we keep the staged path.
+    // The hybrid scaleout path reaches device memory the same way, but only zero-copy sends/recvs per message.
+    if ((GCFG_HCL_OFI_ZERO_COPY.value() || GCFG_HCL_HNIC_HYBRID_PATH.value()) && !gaudi_direct_supported)
     {
-        // Try to get provider again if all the bellow conditions met"
-        // 1. Gaudi-direct was not requested by user
-        // 2. Previously we tried to get gaudi-direct provider and failed
-        if (!GCFG_HCCL_GAUDI_DIRECT.isSetFromUserConfig() && gaudi_direct_supported)
+        if (FI_VERSION_GE(fabric_version, MINIMAL_LIBFABRIC_VERSION) && checkDMABUFSupport())
         {
-            LOG_HCL_DEBUG(HCL_OFI, "Gaudi-direct was not requested by user. Attempt to use OFI without gaudi-direct.");
-            ret = get_ofi_provider(false);
+            ret = get_ofi_provider(false, true);
             if ((ret != hcclSuccess) || (m_providers.size() == 0))
             {
-                LOG_HCL_ERR(HCL_OFI, "Get OFI provider failed");
-                return hcclLibfabricError;
+                LOG_HCL_WARN(HCL_OFI, "Could not find an HMEM provider for zero-copy, using staged scaleout.");
+                s_userHmem = false;
+                s_zeroCopy = false;
             }
         }
         else
         {
-            LOG_HCL_ERR(HCL_OFI, "Get OFI provider failed");
-            return hcclLibfabricError;
+            LOG_HCL_WARN(HCL_OFI, "Zero-copy requires dmabuf support, using staged scaleout.");
+        }
+    }
+
+    // If gaudi_direct_supported = true, attempt to get provider that supports gaudi-direct.
+    // Otherwise, get provider without gaudi-direct.
+    if (!s_userHmem)
+    {
+        ret = get_ofi_provider(gaudi_direct_supported);
+        if ((ret != hcclSuccess) || (m_providers.size() == 0))
+        {
+            // Try to get provider again if all the bellow conditions met"
+            // 1. Gaudi-direct was not requested by user
+            // 2. Previously we tried to get gaudi-direct provider and failed
+            if (!GCFG_HCCL_GAUDI_DIRECT.isSetFromUserConfig() && gaudi_direct_supported)
+            {
+                LOG_HCL_DEBUG(HCL_OFI,
+                              "Gaudi-direct was not requested by user. Attempt to use OFI without gaudi-direct.");
+                ret = get_ofi_provider(false);
+                if ((ret != hcclSuccess) || (m_providers.size() == 0))
+                {
+                    LOG_HCL_ERR(HCL_OFI, "Get OFI provider failed");
+                    return hcclLibfabricError;
+                }
+            }
+            else
+            {
+                LOG_HCL_ERR(HCL_OFI, "Get OFI provider failed");
+                return hcclLibfabricError;
+            }
         }
     }
 
@@ -813,6 +844,59 @@ int ofi_t::irecv(ofiComm_t* const       ofiComm,
     return hcclSuccess;
 }
 
+int ofi_t::queue(ofiComm_t* const          ofiComm,
+                 void* const               data,
+                 const size_t              size,
+                 const ofi_req_direction_t direction,
+                 ofi_req_t** const         request,
+                 OfiCompCallbackParams&    compParams,
+                 ofi_post_batch_t&         batch)
+{
+    int ret;
+
+    if (OFI_UNLIKELY(ofiComm == NULL))
+    {
+        LOG_HCL_ERR(HCL_OFI, "Invalid ofiComm");
+        return hcclLibfabricError;
+    }
+
+    const uint64_t inflight = direction == OFI_SEND ? ofiComm->num_inflight_sends : ofiComm->num_inflight_recvs;
+    if (OFI_UNLIKELY(inflight == OFI_MAX_REQUESTS))
+    {
+        LOG_HCL_ERR(HCL_OFI, "Can't support more than {} inflight requests", OFI_MAX_REQUESTS);
+        return hcclLibfabricError;
+    }
+
+    ret = m_components[ofiComm->dev]->queue(ofiComm, data, size, direction, request, compParams, batch);
+    if (ret)
+    {
+        return hcclLibfabricError;
+    }
+
+    return hcclSuccess;
+}
+
+int ofi_t::flush(ofi_post_batch_t& batch)
+{
+    int ret = hcclSuccess;
+
+    std::set<int> devices;
+    for (const ofi_post_batch_t::entry_t& entry : batch.entries)
+    {
+        devices.insert(entry.req->ofiDevice);
+    }
+    for (const int dev : devices)
+    {
+        if (m_components[dev]->post_batch(batch))
+        {
+            ret = hcclLibfabricError;
+        }
+    }
+
+    batch.entries.clear();
+    return ret;
+}
+
 int ofi_t::test(ofi_req_t* request, int* done, size_t* size)
 {
     int ret;
@@ -1037,9 +1121,16 @@ std::optional<fi_info*> ofi_t::get_verb_provider(const std::vector<fi_info*>& pr
     return provider;
 }
 
-int ofi_t::get_ofi_provider(const bool gaudi_direct)
+std::optional<fi_info*> ofi_t::get_loopback_provider(const std::vector<fi_info*>& providers)
 {
-    int rc = run_fi_getinfo(&m_fi_getinfo_result, gaudi_direct);
+    // The loopback fabric has a single domain shared by all devices of the process
+    log_provider(providers, providers[0], "");
+    return providers[0];
+}
+
+int ofi_t::get_ofi_provider(const bool gaudi_direct, const bool user_hmem)
+{
+    int rc = run_fi_getinfo(&m_fi_getinfo_result, gaudi_direct || user_hmem);
     if (rc != 0) return rc;
 
     std::optional<struct fi_info*> provider;
@@ -1053,6 +1144,7 @@ int ofi_t::get_ofi_provider(const bool gaudi_direct)
     const std::unordered_map<CORE_PROVIDER, FilterMethod> provider_filters {
         {CORE_PROVIDER::VERBS, &ofi_t::get_verb_provider},
         {CORE_PROVIDER::TCP, &ofi_t::get_tcp_provider},
+        {CORE_PROVIDER::LOOPBACK, &ofi_t::get_loopback_provider},
     };
     for (const auto& [type, current_providers] : map_by_core_provider(m_fi_getinfo_result))
     {
@@ -1079,6 +1171,13 @@ int ofi_t::get_ofi_provider(const bool gaudi_direct)
         LOG_HCL_INFO(HCL_OFI, "Gaudi-direct is enabled, provider {}.", providerName);
     }
 
+    s_userHmem = user_hmem && !gaudi_direct;
+    s_zeroCopy = s_userHmem && GCFG_HCL_OFI_ZERO_COPY.value();
+    if (s_zeroCopy)
+    {
+        LOG_HCL_INFO(HCL_OFI, "Zero-copy scaleout is enabled, provider {}.", providerName);
+    }
+
     m_ofi_device = 0;                   // This is always the first one because there is only one in m_providers.
     m_providers  = {provider.value()};  // Only the selected provider saved
 
@@ -1139,6 +1238,48 @@ struct fi_info* ofi_t::get_nic_info(int ofiDevice)
     return nullptr;
 }
 
+int ofi_t::get_nic_numa_node(const int ofiDevice)
+{
+    const struct fi_info* const prov = get_nic_info(ofiDevice);
+    if (prov != nullptr && prov->nic != nullptr && prov->nic->bus_attr != nullptr &&
+        prov->nic->bus_attr->bus_type == FI_BUS_PCI)
+    {
+        const struct fi_pci_attr& pci = prov->nic->bus_attr->attr.pci;
+        const std::string         pci_addr =
+            fmt::format("{:04x}:{:02x}:{:02x}.{:x}", pci.domain_id, pci.bus_id, pci.device_id, pci.function_id);
+        const int                 numa_node = get_numa_node(pci_addr);
+        if (numa_node >= 0)
+        {
+            return numa_node;
+        }
+    }
+
+    return m_gaudi_pci_dev.numa_node;
+}
+
+bool ofi_t::is_nic_near_gaudi(const int ofiDevice)
+{
+    const struct fi_info* const prov = get_nic_info(ofiDevice);
+    if (prov == nullptr || prov->nic == nullptr || prov->nic->bus_attr == nullptr ||
+        prov->nic->bus_attr->bus_type != FI_BUS_PCI || m_gaudi_pci_dev.switch_addr_prefix.empty())
+    {
+        return false;
+    }
+
+    const struct fi_pci_attr& pci = prov->nic->bus_attr->attr.pci;
+    const std::string         pci_addr =
+        fmt::format("{:04x}:{:02x}:{:02x}.{:x}", pci.domain_id, pci.bus_id, pci.device_id, pci.function_id);
+    const std::string switch_addr = get_pci_switch_addr_prefix(pci_addr);
+    LOG_HCL_DEBUG(HCL_OFI,
+                  "NIC {} switch {}, gaudi {} switch {}",
+                  pci_addr,
+                  switch_addr,
+                  m_gaudi_pci_dev.full_path,
+                  m_gaudi_pci_dev.switch_addr_prefix);
+
+    return switch_addr == m_gaudi_pci_dev.switch_addr_prefix;
+}
+
 ofi_component_t* ofi_t::getOfiComponent(int ofiDevice)
 {
     if (m_components[ofiDevice] == NULL)
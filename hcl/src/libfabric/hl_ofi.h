@@ -55,7 +55,7 @@
 #define REQUIRED_KERNEL_MAJOR 5
 #define REQUIRED_KERNEL_MINOR 12
 
-void get_hints(struct fi_info* hints, bool gaudi_direct);
+void get_hints(struct fi_info* hints, bool hmem);
 
 struct PCIE_Device
 {
@@ -93,6 +93,14 @@ public:
                  const size_t           size,
                  ofi_req_t** const      request,
                  OfiCompCallbackParams& compParams);
+    int    queue(ofiComm_t* const          ofiComm,
+                 void* const               data,
+                 const size_t              size,
+                 const ofi_req_direction_t direction,
+                 ofi_req_t** const         request,
+                 OfiCompCallbackParams&    compParams,
+                 ofi_post_batch_t&         batch);
+    int    flush(ofi_post_batch_t& batch);
     int    test(ofi_req_t* request, int* done, size_t* size);
     int    close(const ofiComm_t& ofiComm);
     int    close(const listenComm_t& listenComm);
@@ -102,23 +110,38 @@ public:
 
     static bool     isMRLocal() { return s_mrLocal; }
     static bool     isGaudiDirect() { return s_gaudiDirect; }
+    static bool     isZeroCopy() { return s_zeroCopy; }
+    static bool     isUserHmem() { return s_userHmem; }
     static bool     isVerbs() { return s_verbs; }
-    static bool     isFabricFlush() { return isGaudiDirect() && GCFG_HCL_FABRIC_FLUSH.value(); }
+    // Receives may land in device memory with gaudi-direct, or through user buffer registration (zero-copy, hybrid)
+    static bool     isFabricFlush() { return (isGaudiDirect() || isUserHmem()) && GCFG_HCL_FABRIC_FLUSH.value(); }
     struct fi_info* get_nic_info(int ofiDevice);
 
+    /**
+     * @brief NUMA node of the NIC used by ofiDevice, or of the gaudi if the NIC's node is unknown. -1 if both unknown.
+     */
+    int get_nic_numa_node(int ofiDevice);
+
+    /**
+     * @brief Whether the NIC used by ofiDevice is under the same PCIe switch as the gaudi, so peer-to-peer traffic
+     *        between them doesn't cross the root complex. false if the NIC's location is unknown.
+     */
+    bool is_nic_near_gaudi(int ofiDevice);
+
 private:
     /**
      * @brief The order prioritizes the providers. Lower value is better.
      */
     enum class CORE_PROVIDER
     {
-        VERBS = 1,
-        TCP   = 2
+        VERBS    = 1,
+        TCP      = 2,
+        LOOPBACK = 3
     };
 
     int                                            acquireOfiComponent(int ofiDevice);
     int                                            initOfiComponent(int ofiDevice);
-    int                                            get_ofi_provider(bool gaudi_direct);
+    int                                            get_ofi_provider(bool gaudi_direct, bool user_hmem = false);
     std::map<CORE_PROVIDER, std::vector<fi_info*>> map_by_core_provider(struct fi_info* providers);
 
     /**
@@ -144,6 +167,7 @@ private:
      */
     bool exclude_verbs_provider(const fi_info* const provider, const uint64_t expected_mem_tag_format);
     std::optional<fi_info*> get_verb_provider(const std::vector<fi_info*>& providers);
+    std::optional<fi_info*> get_loopback_provider(const std::vector<fi_info*>& providers);
 
     /**
      * @brief Check whether Linux kernel has dmabuf support by reading the kernel symbols file,
@@ -162,6 +186,8 @@ private:
 private:
     static bool s_mrLocal;
     static bool s_gaudiDirect;
+    static bool s_zeroCopy;
+    static bool s_userHmem;  // HMEM provider without gaudi-direct, user device buffers are registered on demand
     static bool s_verbs;
 
     const int                     m_device_fd;
@@ -22,7 +22,8 @@ int ofi_fi_close(fid_t domain)
     return ofi_plugin->w_fi_close(domain);
 }
 
-#define IF_GDR(value) ((ofi_t::isGaudiDirect()) ? std::optional(value) : (std::nullopt))
+#define IF_FLUSH(value)                                                                                                \
+    ((ofi_t::isGaudiDirect() || ofi_t::isFabricFlush()) ? std::optional(value) : (std::nullopt))
 
 ofi_component_t::ofi_component_t(const int                                ofiDeviceID,
                                  [[maybe_unused]] const int               hw_module_id,
@@ -42,14 +43,14 @@ ofi_component_t::ofi_component_t(const int                                ofiDev
   m_fabric_single(create_fabric(prov)),
   m_domain_single(create_domain(prov, m_fabric_single.get())),
   m_mrSingle(std::nullopt),
-  m_flush_provider(IF_GDR(m_prov)),
-  m_flush_fabric(IF_GDR(create_fabric(*m_flush_provider))),
-  m_flush_domain(IF_GDR(create_domain(*m_flush_provider, m_flush_fabric.value().get()))),
-  m_flush_cq(IF_GDR(create_cq(m_flush_domain.value().get(), m_cpuid, FI_CQ_FORMAT_TAGGED))),
-  m_flush_av(IF_GDR(create_av(m_flush_domain.value().get()))),
-  m_flush_ep(IF_GDR(
+  m_flush_provider(IF_FLUSH(m_prov)),
+  m_flush_fabric(IF_FLUSH(create_fabric(*m_flush_provider))),
+  m_flush_domain(IF_FLUSH(create_domain(*m_flush_provider, m_flush_fabric.value().get()))),
+  m_flush_cq(IF_FLUSH(create_cq(m_flush_domain.value().get(), m_cpuid, FI_CQ_FORMAT_TAGGED))),
+  m_flush_av(IF_FLUSH(create_av(m_flush_domain.value().get()))),
+  m_flush_ep(IF_FLUSH(
       create_ep(*m_flush_provider, m_flush_domain.value().get(), m_flush_cq.value().get(), m_flush_av.value().get()))),
-  m_flush_addr(IF_GDR(create_address(m_flush_ep.value().get(), m_flush_av.value().get()))),
+  m_flush_addr(IF_FLUSH(create_address(m_flush_ep.value().get(), m_flush_av.value().get()))),
   m_mrFlushLocal(std::nullopt),
   m_mrFlushRemote(std::nullopt),
   m_flushLocalBuffer(0),
@@ -58,6 +59,14 @@ ofi_component_t::ofi_component_t(const int                                ofiDev
     LOG_DEBUG(HCL_OFI, "Using provider to create a component: {}", ofi_plugin->w_fi_tostr(m_prov, FI_TYPE_INFO));
 }
 
+ofi_component_t::~ofi_component_t()
+{
+    for (const auto& [cache, entry] : m_pinnedUserMrs)
+    {
+        cache->release(entry);
+    }
+}
+
 FiObject<struct fid_fabric*> ofi_component_t::create_fabric(const struct fi_info* const provider)
 {
     struct fid_fabric* fabric = nullptr;
@@ -350,6 +359,10 @@ int ofi_component_t::test(ofi_req_t* req, int* done, size_t* size)
             }
             ofiComm->num_inflight_recvs--;
         }
+        if (req->userMr != nullptr)
+        {
+            ofiComm->mrCache->release(req->userMr);
+        }
         if (OFI_UNLIKELY(req->state == OFI_REQ_ERROR))
         {
             LOG_HCL_ERR(HCL_OFI, "Request failed with an error");
@@ -375,9 +388,9 @@ int ofi_component_t::_flush(ofiComm_t* ofiComm, ofi_req_t& request)
         return hcclLibfabricError;
     }
 
-    if (OFI_UNLIKELY(!m_mr))
+    if (OFI_UNLIKELY(!m_mrFlushLocal || !m_mrFlushRemote))
     {
-        LOG_HCL_ERR(HCL_OFI, "Missing MR handle");
+        LOG_HCL_ERR(HCL_OFI, "Missing flush MR handle");
         return hcclLibfabricError;
     }
 
@@ -552,3 +565,149 @@ int ofi_component_t::getDmabufFd()
     VERIFY(m_dmabufFD.has_value(), "Missing dmabuf FD.");
     return m_dmabufFD;
 }
+
+ofi_dmabuf_registrar_t::ofi_dmabuf_registrar_t(struct fid_domain* const domain,
+                                               const int                dmabufFd,
+                                               const uint64_t           poolAddr,
+                                               const uint64_t           poolSize)
+: m_domain(domain), m_dmabufFd(dmabufFd), m_poolAddr(poolAddr), m_poolSize(poolSize)
+{
+}
+
+bool ofi_dmabuf_registrar_t::registerRange(const uint64_t addr, const uint64_t size, void*& handle, void*& desc)
+{
+    if (addr < m_poolAddr || addr + size > m_poolAddr + m_poolSize)
+    {
+        LOG_HCL_DEBUG(HCL_OFI,
+                      "User buffer [0x{:x}, 0x{:x}) is outside of the exported pool [0x{:x}, 0x{:x})",
+                      addr,
+                      addr + size,
+                      m_poolAddr,
+                      m_poolAddr + m_poolSize);
+        return false;
+    }
+
+    struct fid_mr*      mr      = nullptr;
+    struct fi_mr_attr   mr_attr = {{0}, 0};
+    struct fi_mr_dmabuf dmabuf  = {0};
+
+    dmabuf.fd        = m_dmabufFd;
+    dmabuf.offset    = addr - m_poolAddr;
+    dmabuf.len       = size;
+    dmabuf.base_addr = reinterpret_cast<void*>(m_poolAddr);
+
+    mr_attr.dmabuf    = &dmabuf;
+    mr_attr.iov_count = 1;
+    mr_attr.access    = FI_SEND | FI_RECV;
+    mr_attr.iface     = FI_HMEM_SYNAPSEAI;
+
+    // Unlike create_mr, a failure here is not fatal - the caller falls back to the staged path
+    const int rc = ofi_plugin->w_fi_mr_regattr(m_domain, &mr_attr, FI_MR_DMABUF, &mr);
+    if (rc != 0)
+    {
+        LOG_HCL_WARN(HCL_OFI,
+                     "User buffer MR registration failed for 0x{:x}, size {}; RC: {}, ERROR: {}",
+                     addr,
+                     size,
+                     rc,
+                     ofi_plugin->w_fi_strerror(-rc));
+        return false;
+    }
+
+    desc = ofi_plugin->w_fi_mr_desc(mr);
+    if (desc == nullptr)
+    {
+        LOG_HCL_WARN(HCL_OFI, "Could not get descriptor using fi_mr_desc for user buffer 0x{:x}", addr);
+        ofi_fi_close(&mr->fid);
+        return false;
+    }
+    handle = mr;
+
+    LOG_HCL_DEBUG(HCL_OFI, "User buffer MR registration complete. mHandle={}, address=0x{:x} size={}", mr, addr, size);
+    return true;
+}
+
+void ofi_dmabuf_registrar_t::deregisterRange(void* const handle)
+{
+    ofi_fi_close(&static_cast<struct fid_mr*>(handle)->fid);
+}
+
+void ofi_component_t::initializeUserMemoryRegistration(MRParams& params)
+{
+    VERIFY(params.m_fd && params.m_addr && params.m_size, "Uninitialized MRParams");
+    const uint64_t addr   = params.m_addr.value();
+    const uint64_t size   = params.m_size.value();
+    const uint64_t offset = params.m_offset.value_or(0);
+
+    const int dmabuf_fd =
+        hlthunk_device_mapped_memory_export_dmabuf_fd(params.m_fd.value(), addr, size, offset, (O_RDWR | O_CLOEXEC));
+    if (dmabuf_fd < 0)
+    {
+        LOG_HCL_WARN(HCL_OFI,
+                     "hlthunk_device_mapped_memory_export_dmabuf_fd returned invalid FD: [{}] for size [0x{:x}], "
+                     "address [0x{:x}], offset [0x{:x}]. Zero-copy is disabled. {}",
+                     dmabuf_fd,
+                     size,
+                     addr,
+                     offset,
+                     std::strerror(dmabuf_fd * (-1)));
+        return;
+    }
+    m_userDmabufFD = FileDescriptor(dmabuf_fd);
+
+    if (ofi_t::isFabricFlush())
+    {
+        // Receives into user device buffers need the same PCIe flush as the gaudi-direct receives
+        m_flushRemoteBuffer = addr;
+        m_mrFlushLocal =
+            create_mr(m_flush_domain.value(), &m_flushLocalBuffer, sizeof(m_flushLocalBuffer), FI_HMEM_SYSTEM, 0);
+        m_mrFlushRemote = create_mr(m_flush_domain.value(),
+                                    reinterpret_cast<void*>(m_flushRemoteBuffer),
+                                    sizeof(m_flushLocalBuffer),
+                                    FI_HMEM_SYNAPSEAI,
+                                    dmabuf_fd);
+    }
+
+    const uint64_t maxEntries = GCFG_HCL_OFI_MR_CACHE_MAX_ENTRIES.value();
+    const uint64_t maxBytes   = GCFG_HCL_OFI_MR_CACHE_MAX_SIZE.value();
+    m_userRegistrar = std::make_unique<ofi_dmabuf_registrar_t>(m_domain.get(), dmabuf_fd, addr + offset, size);
+    m_userMrCache   = std::make_unique<ofi_mr_cache_t>(*m_userRegistrar, maxEntries, maxBytes);
+    m_userRegistrarSingle =
+        std::make_unique<ofi_dmabuf_registrar_t>(m_domain_single.get(), dmabuf_fd, addr + offset, size);
+    m_userMrCacheSingle = std::make_unique<ofi_mr_cache_t>(*m_userRegistrarSingle, maxEntries, maxBytes);
+
+    LOG_HCL_INFO(HCL_OFI,
+                 "User buffer registration initialized for [0x{:x}, 0x{:x}), max entries {}, max size {}MB",
+                 addr + offset,
+                 addr + offset + size,
+                 maxEntries,
+                 B2MB(maxBytes));
+}
+
+ofi_mr_cache_t* ofi_component_t::getUserMrCache(const uint16_t qpSetIndex) const
+{
+    return (GCFG_HCL_HNIC_SCALE_OUT_QP_SETS.value() != qpSetIndex) ? m_userMrCache.get() : m_userMrCacheSingle.get();
+}
+
+bool ofi_component_t::acquireUserBuffer(const uint64_t addr, const uint64_t size, const uint16_t qpSetIndex)
+{
+    ofi_mr_cache_t* const cache = getUserMrCache(qpSetIndex);
+    return (cache != nullptr) && (cache->acquire(addr, size) != nullptr);
+}
+
+bool ofi_component_t::pinUserMemoryRange(const uint64_t addr, const uint64_t size)
+{
+    for (ofi_mr_cache_t* const cache : {m_userMrCache.get(), m_userMrCacheSingle.get()})
+    {
+        const ofi_mr_cache_entry_t* const entry = (cache != nullptr) ? cache->acquire(addr, size) : nullptr;
+        if (entry == nullptr)
+        {
+            LOG_HCL_WARN(HCL_OFI, "Could not pin user memory [0x{:x}, 0x{:x})", addr, addr + size);
+            return false;
+        }
+        m_pinnedUserMrs.emplace_back(cache, entry);
+    }
+
+    LOG_HCL_INFO(HCL_OFI, "Pinned user memory [0x{:x}, 0x{:x}), size {:g}MB", addr, addr + size, B2MB(size));
+    return true;
+}
@@ -1,14 +1,15 @@
 #pragma once
 
-#include <cstdint>           // for uint64_t
-#include <cstring>           // for NULL, memset, size_t
-#include <vector>            // for vector
-#include <optional>          // for optional
-#include <utility>           // for forward
-#include <memory>            // for shared_ptr
-#include "infra/fd.h"        // for FileDescriptor
-#include "rdma/fabric.h"     // for fi_addr_t, fi_context
-#include <rdma/fi_domain.h>  // for fi_hmem_iface
+#include <cstdint>            // for uint64_t
+#include <cstring>            // for NULL, memset, size_t
+#include <vector>             // for vector
+#include <optional>           // for optional
+#include <utility>            // for forward
+#include <memory>             // for shared_ptr
+#include "infra/fd.h"         // for FileDescriptor
+#include "hl_ofi_mr_cache.h"  // for ofi_mr_cache_t
+#include "rdma/fabric.h"      // for fi_addr_t, fi_context
+#include <rdma/fi_domain.h>   // for fi_hmem_iface
 #include "platform/gen2_arch_common/host_scheduler.h"
 
 #define OFI_EXIT_ON_ERROR(fn) OFI_EXIT_ON_ERROR_VALUE(fn, 0)
@@ -71,6 +72,8 @@ struct listenComm_t
     struct fid_cq* cq;
     void*          mrDesc;
     fi_addr_t      local_ep_addr;
+
+    ofi_mr_cache_t* mrCache = nullptr;
 };
 
 struct ofiComm_t
@@ -85,6 +88,8 @@ struct ofiComm_t
     struct fid_ep* local_ep;
     struct fid_cq* cq;
     void*          mrDesc;
+
+    ofi_mr_cache_t* mrCache = nullptr;  // user buffer registrations (zero-copy), nullptr if disabled
 };
 
 struct allConnectionComm_t
@@ -122,6 +127,9 @@ public:
     // Completion params
     OfiCompCallbackParams compParams;
 
+    // User buffer registration used by the request, released on completion
+    const ofi_mr_cache_entry_t* userMr;
+
     ofi_req_t()
     {
         lComm   = NULL;
@@ -137,11 +145,32 @@ public:
         direction = OFI_INVALID;
 
         compParams.compCallBack = nullptr;
+
+        userMr = nullptr;
     }
 
     ~ofi_req_t() = default;
 };
 
+/**
+ * @brief Sends and receives queued by a single poster (host scheduler thread), posted together by ofi_t::flush.
+ *
+ * The requests are created when queued, their completions can be tested before the flush and stay pending until it.
+ */
+struct ofi_post_batch_t
+{
+    struct entry_t
+    {
+        ofi_req_t* req;
+        void*      data;
+        size_t     size;
+    };
+
+    std::vector<entry_t> entries;
+
+    bool empty() const { return entries.empty(); }
+};
+
 int ofi_fi_close(fid_t domain);
 
 template<typename T>
@@ -197,6 +226,24 @@ struct MRParams
     std::optional<uint64_t> m_offset;
 };
 
+/**
+ * @brief Registers sub-ranges of a device memory pool that was exported as a single dmabuf.
+ */
+class ofi_dmabuf_registrar_t : public ofi_mr_registrar_t
+{
+public:
+    ofi_dmabuf_registrar_t(struct fid_domain* domain, int dmabufFd, uint64_t poolAddr, uint64_t poolSize);
+
+    bool registerRange(uint64_t addr, uint64_t size, void*& handle, void*& desc) override;
+    void deregisterRange(void* handle) override;
+
+private:
+    struct fid_domain* const m_domain;
+    const int                m_dmabufFd;
+    const uint64_t           m_poolAddr;
+    const uint64_t           m_poolSize;
+};
+
 //
 // Structure of an OFI network component
 //
@@ -210,7 +257,7 @@ class ofi_component_t
 {
 public:
     ofi_component_t(int ofiDeviceId, int hw_module_id, struct fi_info* prov, int cpuid, enum fi_cq_format cq_format);
-    virtual ~ofi_component_t() = default;
+    virtual ~ofi_component_t();
 
     int inc_refcnt() { return ++m_refcnt; }
     int dec_refcnt() { return --m_refcnt; }
@@ -229,11 +276,51 @@ public:
     virtual int
     irecv(ofiComm_t* ofiComm, void* data, size_t size, ofi_req_t** request, OfiCompCallbackParams& compParams) = 0;
 
+    /**
+     * @brief Create a send/recv request and append it to batch instead of posting it. Requires msg post support of
+     *        the ofi plugin (OfiPlugin::isMsgPostSupported).
+     */
+    virtual int queue(ofiComm_t*             ofiComm,
+                      void*                  data,
+                      size_t                 size,
+                      ofi_req_direction_t    direction,
+                      ofi_req_t**            request,
+                      OfiCompCallbackParams& compParams,
+                      ofi_post_batch_t&      batch) = 0;
+
+    /**
+     * @brief Post the requests of batch that belong to this component, in queue order. All but the last post of each
+     *        endpoint are flagged FI_MORE so the provider can ring the doorbell once per endpoint.
+     */
+    virtual int post_batch(ofi_post_batch_t& batch) = 0;
+
     int test(ofi_req_t* req, int* done, size_t* size);
 
     void initializeMemoryRegion(MRParams& params);
     int  getDmabufFd();
 
+    /**
+     * @brief Export the device memory pool described by params so user buffers inside it can be registered on demand.
+     */
+    void initializeUserMemoryRegistration(MRParams& params);
+
+    /**
+     * @brief Register (or find a cached registration of) a user buffer and pin it until the next send/recv from it
+     *        completes.
+     *
+     * @return true if the buffer can be sent/received directly, false if the staged path must be used.
+     */
+    bool            acquireUserBuffer(uint64_t addr, uint64_t size, uint16_t qpSetIndex);
+    ofi_mr_cache_t* getUserMrCache(uint16_t qpSetIndex) const;
+
+    /**
+     * @brief Register [addr, addr + size) for all QP sets and keep it pinned for the lifetime of the component, so
+     *        acquireUserBuffer of any buffer inside it is a cache hit.
+     *
+     * @return false if user buffer registration isn't initialized or the range can't be registered.
+     */
+    bool pinUserMemoryRange(uint64_t addr, uint64_t size);
+
 protected:
     int                ofi_progress(struct fid_cq* cq);
     int                ofi_flush_progress();
@@ -272,6 +359,14 @@ protected:
     const FiObject<struct fid_domain*>      m_domain_single;
     std::optional<FiObject<struct fid_mr*>> m_mrSingle;
 
+    FileDescriptor                          m_userDmabufFD;
+    std::unique_ptr<ofi_dmabuf_registrar_t> m_userRegistrar;
+    std::unique_ptr<ofi_dmabuf_registrar_t> m_userRegistrarSingle;
+    std::unique_ptr<ofi_mr_cache_t>         m_userMrCache;
+    std::unique_ptr<ofi_mr_cache_t>         m_userMrCacheSingle;
+
+    std::vector<std::pair<ofi_mr_cache_t*, const ofi_mr_cache_entry_t*>> m_pinnedUserMrs;  // see pinUserMemoryRange
+
 private:
     std::optional<struct fi_info* const>              m_flush_provider;
     const std::optional<FiObject<struct fid_fabric*>> m_flush_fabric;
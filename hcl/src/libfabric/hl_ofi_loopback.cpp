@@ -0,0 +1,1159 @@
+#include "libfabric/hl_ofi_loopback.h"
+
+#include <algorithm>            // for max, min, find_if
+#include <atomic>               // for atomic
+#include <chrono>               // for steady_clock
+#include <cstdlib>              // for calloc, free
+#include <cstring>              // for memcpy, strcmp, strdup, strerror
+#include <deque>                // for deque
+#include <fcntl.h>              // for O_*
+#include <map>                  // for map
+#include <new>                  // for placement new
+#include <pthread.h>            // for pthread_mutex_*
+#include <string>               // for string
+#include <sys/mman.h>           // for mmap, munmap, shm_open, shm_unlink
+#include <sys/stat.h>           // for fstat
+#include <thread>               // for this_thread
+#include <unistd.h>             // for close, ftruncate, getpid
+#include <utility>              // for pair, move
+#include "hcl_global_conf.h"    // for GCFG_HCL_OFI_LOOPBACK_*
+#include "hcl_utils.h"          // for LOG_HCL_*
+#include "hcl_log_manager.h"    // for LOG_*
+#include "libfabric/hl_ofi.h"   // for ofi_version
+#include "rdma/fi_domain.h"     // for fid_mr, fi_mr_attr, FI_MR_DMABUF
+#include "rdma/fi_endpoint.h"   // for fid_ep
+#include "rdma/fi_errno.h"      // for FI_EAGAIN, FI_EAVAIL, FI_ETRUNC
+
+#define LOOPBACK_PROVIDER_NAME "loopback"
+
+namespace
+{
+constexpr uint32_t LOOPBACK_ADDR_MAGIC     = 0x4c4f4f50;  // "LOOP"
+constexpr uint64_t LOOPBACK_MIN_INBOX_SIZE = 64 * 1024;
+
+/**
+ * @brief Endpoint name returned by fi_getname and consumed by fi_av_insert.
+ */
+struct LoopbackAddr
+{
+    uint32_t magic;
+    uint32_t pid;
+    uint32_t epId;
+};
+
+/**
+ * @brief Header of a message fragment in an inbox, followed by fragLen payload bytes.
+ */
+struct LoopbackFrame
+{
+    uint64_t src;        // address of the sending endpoint
+    uint64_t tag;
+    uint64_t arrivalNs;  // time the whole message is received
+    uint64_t fragLen;
+    uint64_t last;       // non zero on the last fragment of the message
+};
+
+uint64_t makeAddr(const uint32_t pid, const uint32_t epId)
+{
+    return (static_cast<uint64_t>(pid) << 32) | epId;
+}
+
+std::string inboxName(const uint64_t addr)
+{
+    return fmt::format(FMT_COMPILE("/hcl_ofi_loopback_{}_{}"), addr >> 32, addr & 0xffffffff);
+}
+
+uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+template<typename T>
+T* allocAttr(const T* const src)
+{
+    T* const attr = static_cast<T*>(calloc(1, sizeof(T)));
+    if (attr != nullptr && src != nullptr)
+    {
+        *attr = *src;
+    }
+    return attr;
+}
+
+char* dupString(const char* const str)
+{
+    return (str != nullptr) ? strdup(str) : nullptr;
+}
+}  // namespace
+
+/**
+ * @brief Shared memory byte ring of frames, written by the senders of all processes and drained by the owner.
+ */
+struct ofi_loopback_plugin_t::Inbox
+{
+    pthread_mutex_t       writeLock;  // process-shared, serializes the writers
+    uint64_t              size = 0;   // bytes of the ring following this header
+    std::atomic<uint64_t> head {0};   // bytes written, published once a whole frame is written
+    std::atomic<uint64_t> tail {0};   // bytes drained by the owner
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "inbox positions are shared between processes");
+
+    uint8_t* ring() { return reinterpret_cast<uint8_t*>(this + 1); }
+
+    void write(const uint64_t pos, const void* const src, const size_t len)
+    {
+        if (len == 0) return;
+        const uint64_t offset = pos % size;
+        const size_t   first  = std::min<uint64_t>(len, size - offset);
+        memcpy(ring() + offset, src, first);
+        if (len > first) memcpy(ring(), static_cast<const uint8_t*>(src) + first, len - first);
+    }
+
+    void read(const uint64_t pos, void* const dst, const size_t len)
+    {
+        if (len == 0) return;
+        const uint64_t offset = pos % size;
+        const size_t   first  = std::min<uint64_t>(len, size - offset);
+        memcpy(dst, ring() + offset, first);
+        if (len > first) memcpy(static_cast<uint8_t*>(dst) + first, ring(), len - first);
+    }
+
+    /**
+     * @brief Creates the inbox of a local endpoint, or maps the existing inbox of another process.
+     * @return the mapped inbox, nullptr if it can't be created or doesn't exist on this host
+     */
+    static Inbox* map(const std::string& name, const bool create, const uint64_t ringSize)
+    {
+        if (create)
+        {
+            // A process that reused our pid may have left it behind
+            shm_unlink(name.c_str());
+        }
+        const int fd = shm_open(name.c_str(), create ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        size_t mapSize = sizeof(Inbox) + ringSize;
+        bool   valid   = true;
+        if (create)
+        {
+            valid = ftruncate(fd, mapSize) == 0;
+        }
+        else
+        {
+            struct stat st = {};
+            valid          = fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) > sizeof(Inbox);
+            mapSize        = st.st_size;
+        }
+        void* const addr = valid ? mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+        close(fd);
+        if (addr == MAP_FAILED)
+        {
+            if (create) shm_unlink(name.c_str());
+            return nullptr;
+        }
+        if (!create)
+        {
+            return static_cast<Inbox*>(addr);
+        }
+
+        Inbox* const        inbox = new (addr) Inbox();
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        pthread_mutex_init(&inbox->writeLock, &attr);
+        pthread_mutexattr_destroy(&attr);
+        inbox->size = ringSize;
+        return inbox;
+    }
+
+    void unmap() { munmap(this, sizeof(Inbox) + size); }
+};
+
+struct ofi_loopback_plugin_t::CompletionQueue
+{
+    struct fid_cq                                       cq;
+    std::map<std::pair<uint64_t, uint64_t>, Completion> entries;  // (ready time, sequence) -> completion
+};
+
+struct ofi_loopback_plugin_t::AddressVector
+{
+    struct fid_av         av;
+    std::vector<uint64_t> addrs;  // indexed by fi_addr_t
+};
+
+struct ofi_loopback_plugin_t::Endpoint
+{
+    struct fid_ep                         ep;
+    uint32_t                              id       = 0;
+    CompletionQueue*                      cq       = nullptr;
+    AddressVector*                        av       = nullptr;
+    bool                                  enabled  = false;
+    uint64_t                              txFreeNs = 0;  // time the transmit link is done with the last posted send
+    Inbox*                                inbox    = nullptr;
+    std::deque<PostedRecv>                recvs;
+    std::deque<Message>                   unexpected;
+    std::unordered_map<uint64_t, Message> partial;  // fragments drained so far, by source address
+};
+
+ofi_loopback_plugin_t::ofi_loopback_plugin_t()
+: m_latencyNs(GCFG_HCL_OFI_LOOPBACK_LATENCY_NS.value()),
+  m_bwMBps(GCFG_HCL_OFI_LOOPBACK_BW_MBPS.value()),
+  m_inboxSize(std::max<uint64_t>(GCFG_HCL_OFI_LOOPBACK_INBOX_SIZE.value(), LOOPBACK_MIN_INBOX_SIZE)),
+  m_pid(getpid())
+{
+    LOG_HCL_INFO(HCL_OFI,
+                 "Using shared memory loopback fabric, latency={}ns, bandwidth={}MB/s, inbox={}B",
+                 m_latencyNs,
+                 m_bwMBps,
+                 m_inboxSize);
+}
+
+ofi_loopback_plugin_t::~ofi_loopback_plugin_t()
+{
+    // Don't leave the shared memory of endpoints that weren't closed behind
+    for (auto& [id, ep] : m_endpoints)
+    {
+        ep->inbox->unmap();
+        shm_unlink(inboxName(makeAddr(m_pid, id)).c_str());
+    }
+    for (auto& [addr, inbox] : m_peerInboxes)
+    {
+        inbox->unmap();
+    }
+}
+
+bool ofi_loopback_plugin_t::matches(const PostedRecv& recv, const uint64_t src, const uint64_t tag)
+{
+    return (recv.src == 0 || recv.src == src) && (((recv.tag ^ tag) & ~recv.ignore) == 0);
+}
+
+uint64_t ofi_loopback_plugin_t::wireNs(const size_t len) const
+{
+    // 1MB/s moves one byte per 1000ns
+    return (m_bwMBps == 0) ? 0 : (len * 1000) / m_bwMBps;
+}
+
+void ofi_loopback_plugin_t::complete(CompletionQueue* const cq,
+                                     const uint64_t         postNs,
+                                     const uint64_t         readyNs,
+                                     const Completion&      completion)
+{
+    if (cq == nullptr)
+    {
+        // CQ was closed while the operation was in flight
+        return;
+    }
+    cq->entries.emplace(std::make_pair(readyNs, m_nextSeq++), completion);
+
+    const uint64_t latencyNs = readyNs - postNs;
+    m_stats.completions++;
+    m_stats.completionNs += latencyNs;
+    m_stats.maxCompletionNs = std::max(m_stats.maxCompletionNs, latencyNs);
+}
+
+ofi_loopback_plugin_t::Inbox* ofi_loopback_plugin_t::resolveInbox(const uint64_t addr)
+{
+    if ((addr >> 32) == static_cast<uint64_t>(m_pid))
+    {
+        const auto it = m_endpoints.find(static_cast<uint32_t>(addr));
+        return (it != m_endpoints.end()) ? it->second->inbox : nullptr;
+    }
+
+    const auto it = m_peerInboxes.find(addr);
+    if (it != m_peerInboxes.end())
+    {
+        return it->second;
+    }
+    Inbox* const inbox = Inbox::map(inboxName(addr), false, 0);
+    if (inbox != nullptr)
+    {
+        m_peerInboxes[addr] = inbox;
+    }
+    return inbox;
+}
+
+void ofi_loopback_plugin_t::pushFrame(Inbox* const      inbox,
+                                      const void* const frame,
+                                      const size_t      frameLen,
+                                      const void* const payload,
+                                      const size_t      payloadLen)
+{
+    const uint64_t total = frameLen + payloadLen;
+    pthread_mutex_lock(&inbox->writeLock);
+    while (inbox->size - (inbox->head.load(std::memory_order_relaxed) - inbox->tail.load(std::memory_order_acquire)) <
+           total)
+    {
+        // The owner of a full inbox may itself be waiting for one of our inboxes, so drain them while waiting
+        pthread_mutex_unlock(&inbox->writeLock);
+        progress();
+        std::this_thread::yield();
+        pthread_mutex_lock(&inbox->writeLock);
+    }
+    const uint64_t head = inbox->head.load(std::memory_order_relaxed);
+    inbox->write(head, frame, frameLen);
+    inbox->write(head + frameLen, payload, payloadLen);
+    inbox->head.store(head + total, std::memory_order_release);
+    pthread_mutex_unlock(&inbox->writeLock);
+}
+
+void ofi_loopback_plugin_t::drain(Endpoint* const endpoint)
+{
+    Inbox* const   inbox = endpoint->inbox;
+    const uint64_t head  = inbox->head.load(std::memory_order_acquire);
+    uint64_t       tail  = inbox->tail.load(std::memory_order_relaxed);
+    while (tail != head)
+    {
+        LoopbackFrame frame;
+        inbox->read(tail, &frame, sizeof(frame));
+        Message&     msg    = endpoint->partial[frame.src];
+        const size_t offset = msg.data.size();
+        msg.data.resize(offset + frame.fragLen);
+        inbox->read(tail + sizeof(frame), msg.data.data() + offset, frame.fragLen);
+        tail += sizeof(frame) + frame.fragLen;
+        inbox->tail.store(tail, std::memory_order_release);
+        if (!frame.last)
+        {
+            continue;
+        }
+
+        msg.src       = frame.src;
+        msg.tag       = frame.tag;
+        msg.arrivalNs = frame.arrivalNs;
+        auto recvIt   = std::find_if(endpoint->recvs.begin(), endpoint->recvs.end(), [&](const PostedRecv& recv) {
+            return matches(recv, msg.src, msg.tag);
+        });
+        if (recvIt != endpoint->recvs.end())
+        {
+            deliver(*recvIt,
+                    msg.tag,
+                    msg.data.data(),
+                    msg.data.size(),
+                    std::max(recvIt->postNs, msg.arrivalNs),
+                    endpoint->cq);
+            endpoint->recvs.erase(recvIt);
+        }
+        else
+        {
+            // Buffer the message until a matching receive is posted
+            endpoint->unexpected.push_back(std::move(msg));
+            m_stats.unexpected++;
+        }
+        endpoint->partial.erase(frame.src);
+    }
+}
+
+void ofi_loopback_plugin_t::progress()
+{
+    for (auto& [id, ep] : m_endpoints)
+    {
+        drain(ep);
+    }
+}
+
+void ofi_loopback_plugin_t::deliver(const PostedRecv&      recv,
+                                    const uint64_t         tag,
+                                    const void* const      data,
+                                    const size_t           len,
+                                    const uint64_t         readyNs,
+                                    CompletionQueue* const cq)
+{
+    const size_t copied = std::min(len, recv.len);
+    if (copied > 0)
+    {
+        memcpy(recv.buf, data, copied);
+    }
+
+    Completion completion = {};
+    completion.entry      = {recv.context, FI_TAGGED | FI_RECV, copied, recv.buf, 0, tag};
+    if (len > recv.len)
+    {
+        completion.err  = FI_ETRUNC;
+        completion.olen = len - recv.len;
+        m_stats.truncated++;
+    }
+    m_stats.recvs++;
+    complete(cq, recv.postNs, readyNs, completion);
+}
+
+int ofi_loopback_plugin_t::w_fi_getinfo([[maybe_unused]] int         version,
+                                        [[maybe_unused]] const char* node,
+                                        [[maybe_unused]] const char* service,
+                                        [[maybe_unused]] uint64_t    flags,
+                                        const struct fi_info*        hints,
+                                        struct fi_info**             info)
+{
+    *info = nullptr;
+    if (hints != nullptr)
+    {
+        if (hints->caps & (FI_HMEM | FI_RMA | FI_ATOMIC))
+        {
+            return -FI_ENODATA;
+        }
+        if (hints->ep_attr != nullptr && hints->ep_attr->type != FI_EP_UNSPEC && hints->ep_attr->type != FI_EP_RDM)
+        {
+            return -FI_ENODATA;
+        }
+    }
+
+    struct fi_info* const prov = w_fi_allocinfo();
+    if (prov == nullptr)
+    {
+        return -FI_ENOMEM;
+    }
+
+    prov->caps        = FI_MSG | FI_TAGGED | FI_SEND | FI_RECV;
+    prov->mode        = FI_CONTEXT;
+    prov->addr_format = FI_FORMAT_UNSPEC;
+
+    prov->tx_attr->caps      = prov->caps;
+    prov->tx_attr->msg_order = FI_ORDER_SAS;
+    prov->rx_attr->caps      = prov->caps;
+    prov->rx_attr->msg_order = FI_ORDER_SAS;
+
+    prov->ep_attr->type           = FI_EP_RDM;
+    prov->ep_attr->protocol       = FI_PROTO_UNSPEC;
+    prov->ep_attr->max_msg_size   = SIZE_MAX;
+    prov->ep_attr->mem_tag_format = ~0ull;  // all tag bits are available to the user
+
+    prov->domain_attr->name             = dupString(LOOPBACK_PROVIDER_NAME);
+    prov->domain_attr->threading        = FI_THREAD_SAFE;
+    prov->domain_attr->control_progress = FI_PROGRESS_AUTO;
+    prov->domain_attr->data_progress    = FI_PROGRESS_AUTO;
+    prov->domain_attr->av_type          = FI_AV_TABLE;
+    prov->domain_attr->mr_mode          = FI_MR_LOCAL | FI_MR_VIRT_ADDR | FI_MR_ALLOCATED | FI_MR_PROV_KEY;
+    prov->domain_attr->mr_key_size      = sizeof(uint64_t);
+
+    prov->fabric_attr->name         = dupString(LOOPBACK_PROVIDER_NAME);
+    prov->fabric_attr->prov_name    = dupString(LOOPBACK_PROVIDER_NAME);
+    prov->fabric_attr->prov_version = FI_VERSION(1, 0);
+
+    *info = prov;
+    return 0;
+}
+
+struct fi_info* ofi_loopback_plugin_t::w_fi_allocinfo()
+{
+    struct fi_info* const info = static_cast<struct fi_info*>(calloc(1, sizeof(struct fi_info)));
+    if (info == nullptr)
+    {
+        return nullptr;
+    }
+    info->tx_attr     = allocAttr<struct fi_tx_attr>(nullptr);
+    info->rx_attr     = allocAttr<struct fi_rx_attr>(nullptr);
+    info->ep_attr     = allocAttr<struct fi_ep_attr>(nullptr);
+    info->domain_attr = allocAttr<struct fi_domain_attr>(nullptr);
+    info->fabric_attr = allocAttr<struct fi_fabric_attr>(nullptr);
+    if (!info->tx_attr || !info->rx_attr || !info->ep_attr || !info->domain_attr || !info->fabric_attr)
+    {
+        w_fi_freeinfo(info);
+        return nullptr;
+    }
+    return info;
+}
+
+void ofi_loopback_plugin_t::w_fi_freeinfo(struct fi_info* info)
+{
+    while (info != nullptr)
+    {
+        struct fi_info* const next = info->next;
+        free(info->src_addr);
+        free(info->dest_addr);
+        if (info->domain_attr != nullptr)
+        {
+            free(info->domain_attr->name);
+        }
+        if (info->fabric_attr != nullptr)
+        {
+            free(info->fabric_attr->name);
+            free(info->fabric_attr->prov_name);
+        }
+        free(info->tx_attr);
+        free(info->rx_attr);
+        free(info->ep_attr);
+        free(info->domain_attr);
+        free(info->fabric_attr);
+        free(info);
+        info = next;
+    }
+}
+
+struct fi_info* ofi_loopback_plugin_t::w_fi_dupinfo(const struct fi_info* info)
+{
+    if (info == nullptr)
+    {
+        return w_fi_allocinfo();
+    }
+
+    struct fi_info* const dup = static_cast<struct fi_info*>(calloc(1, sizeof(struct fi_info)));
+    if (dup == nullptr)
+    {
+        return nullptr;
+    }
+    *dup = *info;
+
+    // Only the attributes are deep copied, addresses, NIC and auth keys are never set by this provider
+    dup->next         = nullptr;
+    dup->src_addr     = nullptr;
+    dup->src_addrlen  = 0;
+    dup->dest_addr    = nullptr;
+    dup->dest_addrlen = 0;
+    dup->nic          = nullptr;
+    dup->tx_attr      = allocAttr(info->tx_attr);
+    dup->rx_attr      = allocAttr(info->rx_attr);
+    dup->ep_attr      = allocAttr(info->ep_attr);
+    dup->domain_attr  = allocAttr(info->domain_attr);
+    dup->fabric_attr  = allocAttr(info->fabric_attr);
+    if (!dup->tx_attr || !dup->rx_attr || !dup->ep_attr || !dup->domain_attr || !dup->fabric_attr)
+    {
+        if (dup->domain_attr) dup->domain_attr->name = nullptr;
+        if (dup->fabric_attr) dup->fabric_attr->name = dup->fabric_attr->prov_name = nullptr;
+        w_fi_freeinfo(dup);
+        return nullptr;
+    }
+    dup->ep_attr->auth_key          = nullptr;
+    dup->ep_attr->auth_key_size     = 0;
+    dup->domain_attr->auth_key      = nullptr;
+    dup->domain_attr->auth_key_size = 0;
+    dup->domain_attr->name          = dupString(info->domain_attr->name);
+    dup->fabric_attr->name          = dupString(info->fabric_attr->name);
+    dup->fabric_attr->prov_name     = dupString(info->fabric_attr->prov_name);
+    return dup;
+}
+
+const char* ofi_loopback_plugin_t::w_fi_strerror(int err)
+{
+    if (err < FI_ERRNO_OFFSET)
+    {
+        return strerror(err);
+    }
+    switch (err)
+    {
+        case FI_ETOOSMALL:
+            return "Provided buffer is too small";
+        case FI_EOPBADSTATE:
+            return "Operation not permitted in current state";
+        case FI_EAVAIL:
+            return "Error available";
+        case FI_ENOCQ:
+            return "Missing or unavailable completion queue";
+        case FI_ETRUNC:
+            return "Truncation error";
+        case FI_ENOAV:
+            return "Missing or unavailable address vector";
+        default:
+            return "Unspecified error";
+    }
+}
+
+char* ofi_loopback_plugin_t::w_fi_tostr(const void* data, enum fi_type datatype)
+{
+    thread_local std::string str;
+    switch (datatype)
+    {
+        case FI_TYPE_INFO:
+        {
+            const struct fi_info* const info = static_cast<const struct fi_info*>(data);
+            str = fmt::format(FMT_COMPILE("fi_info: provider {}, domain {}, caps 0x{:x}, mode 0x{:x}, mr_mode 0x{:x}, "
+                                          "mem_tag_format 0x{:x}"),
+                              info->fabric_attr->prov_name,
+                              info->domain_attr->name,
+                              info->caps,
+                              info->mode,
+                              info->domain_attr->mr_mode,
+                              info->ep_attr->mem_tag_format);
+            break;
+        }
+        case FI_TYPE_ADDR_FORMAT:
+            str = fmt::format(FMT_COMPILE("addr_format {}"), *static_cast<const uint32_t*>(data));
+            break;
+        default:
+            str = fmt::format(FMT_COMPILE("fi_type {}"), static_cast<int>(datatype));
+            break;
+    }
+    return str.data();
+}
+
+int ofi_loopback_plugin_t::w_fi_close(fid_t fid)
+{
+    if (fid == nullptr)
+    {
+        return -FI_EINVAL;
+    }
+
+    locker_t lock(m_lock);
+    switch (fid->fclass)
+    {
+        case FI_CLASS_FABRIC:
+            delete reinterpret_cast<struct fid_fabric*>(fid);
+            return 0;
+        case FI_CLASS_DOMAIN:
+            delete reinterpret_cast<struct fid_domain*>(fid);
+            return 0;
+        case FI_CLASS_MR:
+            delete reinterpret_cast<struct fid_mr*>(fid);
+            return 0;
+        case FI_CLASS_AV:
+        {
+            AddressVector* const av = reinterpret_cast<AddressVector*>(fid);
+            for (auto& [id, ep] : m_endpoints)
+            {
+                if (ep->av == av) ep->av = nullptr;
+            }
+            delete av;
+            return 0;
+        }
+        case FI_CLASS_CQ:
+        {
+            CompletionQueue* const cq = reinterpret_cast<CompletionQueue*>(fid);
+            for (auto& [id, ep] : m_endpoints)
+            {
+                if (ep->cq == cq) ep->cq = nullptr;
+            }
+            delete cq;
+            return 0;
+        }
+        case FI_CLASS_EP:
+        {
+            Endpoint* const ep = reinterpret_cast<Endpoint*>(fid);
+            m_endpoints.erase(ep->id);
+            ep->inbox->unmap();
+            shm_unlink(inboxName(makeAddr(m_pid, ep->id)).c_str());
+            delete ep;
+            if (m_endpoints.empty())
+            {
+                LOG_HCL_INFO(HCL_OFI,
+                             "Loopback fabric: sends={}, recvs={}, unexpected={}, truncated={}, bytes={}, "
+                             "registrations={}, completions={}, avgCompletionNs={}, maxCompletionNs={}, morePosts={}",
+                             m_stats.sends,
+                             m_stats.recvs,
+                             m_stats.unexpected,
+                             m_stats.truncated,
+                             m_stats.bytes,
+                             m_stats.registrations,
+                             m_stats.completions,
+                             m_stats.completions ? m_stats.completionNs / m_stats.completions : 0,
+                             m_stats.maxCompletionNs,
+                             m_stats.morePosts);
+            }
+            return 0;
+        }
+        default:
+            LOG_HCL_ERR(HCL_OFI, "Loopback fabric can't close fid class {}", fid->fclass);
+            return -FI_EINVAL;
+    }
+}
+
+int ofi_loopback_plugin_t::w_fi_fabric(struct fi_fabric_attr* attr, struct fid_fabric** fabric, void* context)
+{
+    if (attr == nullptr || attr->prov_name == nullptr || strcmp(attr->prov_name, LOOPBACK_PROVIDER_NAME) != 0)
+    {
+        return -FI_ENODATA;
+    }
+    struct fid_fabric* const newFabric = new fid_fabric();
+    newFabric->fid.fclass              = FI_CLASS_FABRIC;
+    newFabric->fid.context             = context;
+    *fabric                            = newFabric;
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_domain([[maybe_unused]] struct fid_fabric* fabric,
+                                       [[maybe_unused]] struct fi_info*    info,
+                                       struct fid_domain**                 domain,
+                                       void*                               context)
+{
+    struct fid_domain* const newDomain = new fid_domain();
+    newDomain->fid.fclass              = FI_CLASS_DOMAIN;
+    newDomain->fid.context             = context;
+    *domain                            = newDomain;
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_endpoint([[maybe_unused]] struct fid_domain* domain,
+                                         [[maybe_unused]] struct fi_info*    info,
+                                         struct fid_ep**                     ep,
+                                         void*                               context)
+{
+    locker_t          lock(m_lock);
+    const std::string name  = inboxName(makeAddr(m_pid, m_nextEpId));
+    Inbox* const      inbox = Inbox::map(name, true, m_inboxSize);
+    if (inbox == nullptr)
+    {
+        LOG_HCL_ERR(HCL_OFI, "Loopback fabric failed to create the shared memory inbox {}", name);
+        return -FI_ENOMEM;
+    }
+    Endpoint* const newEp  = new Endpoint();
+    newEp->ep.fid.fclass   = FI_CLASS_EP;
+    newEp->ep.fid.context  = context;
+    newEp->id              = m_nextEpId++;
+    newEp->inbox           = inbox;
+    m_endpoints[newEp->id] = newEp;
+    *ep                    = &newEp->ep;
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_cq_open([[maybe_unused]] struct fid_domain* domain,
+                                        struct fi_cq_attr*                  attr,
+                                        struct fid_cq**                     cq,
+                                        void*                               context)
+{
+    if (attr != nullptr && attr->format != FI_CQ_FORMAT_UNSPEC && attr->format != FI_CQ_FORMAT_TAGGED)
+    {
+        return -FI_ENOSYS;
+    }
+    CompletionQueue* const newCq = new CompletionQueue();
+    newCq->cq.fid.fclass         = FI_CLASS_CQ;
+    newCq->cq.fid.context        = context;
+    *cq                          = &newCq->cq;
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_av_open([[maybe_unused]] struct fid_domain* domain,
+                                        [[maybe_unused]] struct fi_av_attr* attr,
+                                        struct fid_av**                     av,
+                                        void*                               context)
+{
+    AddressVector* const newAv = new AddressVector();
+    newAv->av.fid.fclass       = FI_CLASS_AV;
+    newAv->av.fid.context      = context;
+    *av                        = &newAv->av;
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_ep_bind(struct fid_ep* ep, struct fid* fid, [[maybe_unused]] uint64_t flags)
+{
+    locker_t        lock(m_lock);
+    Endpoint* const endpoint = reinterpret_cast<Endpoint*>(ep);
+    switch (fid->fclass)
+    {
+        case FI_CLASS_CQ:
+            endpoint->cq = reinterpret_cast<CompletionQueue*>(fid);
+            return 0;
+        case FI_CLASS_AV:
+            endpoint->av = reinterpret_cast<AddressVector*>(fid);
+            return 0;
+        default:
+            return -FI_EINVAL;
+    }
+}
+
+int ofi_loopback_plugin_t::w_fi_enable(struct fid_ep* ep)
+{
+    locker_t        lock(m_lock);
+    Endpoint* const endpoint = reinterpret_cast<Endpoint*>(ep);
+    if (endpoint->cq == nullptr)
+    {
+        return -FI_ENOCQ;
+    }
+    if (endpoint->av == nullptr)
+    {
+        return -FI_ENOAV;
+    }
+    endpoint->enabled = true;
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_getname(fid_t fid, void* addr, size_t* addrlen)
+{
+    if (fid->fclass != FI_CLASS_EP)
+    {
+        return -FI_EINVAL;
+    }
+    if (*addrlen < sizeof(LoopbackAddr))
+    {
+        *addrlen = sizeof(LoopbackAddr);
+        return -FI_ETOOSMALL;
+    }
+    const LoopbackAddr name = {LOOPBACK_ADDR_MAGIC,
+                               static_cast<uint32_t>(m_pid),
+                               reinterpret_cast<Endpoint*>(fid)->id};
+    memcpy(addr, &name, sizeof(name));
+    *addrlen = sizeof(name);
+    return 0;
+}
+
+int ofi_loopback_plugin_t::w_fi_av_insert(struct fid_av*            av,
+                                          void*                     addr,
+                                          size_t                    count,
+                                          fi_addr_t*                fi_addrs,
+                                          [[maybe_unused]] uint64_t flags,
+                                          [[maybe_unused]] void*    context)
+{
+    locker_t             lock(m_lock);
+    AddressVector* const addressVector = reinterpret_cast<AddressVector*>(av);
+    int                  inserted      = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        LoopbackAddr name;
+        memcpy(&name, static_cast<const uint8_t*>(addr) + i * sizeof(name), sizeof(name));
+        fi_addr_t fiAddr = FI_ADDR_NOTAVAIL;
+        const uint64_t remote = makeAddr(name.pid, name.epId);
+        if (name.magic != LOOPBACK_ADDR_MAGIC || name.epId == 0)
+        {
+            LOG_HCL_ERR(HCL_OFI, "Loopback fabric got a name that isn't a loopback endpoint");
+        }
+        else if (resolveInbox(remote) == nullptr)
+        {
+            LOG_HCL_ERR(HCL_OFI,
+                        "Loopback fabric can't map the inbox of endpoint {} of process {}, only processes of the "
+                        "same host can be connected",
+                        name.epId,
+                        name.pid);
+        }
+        else
+        {
+            fiAddr = addressVector->addrs.size();
+            addressVector->addrs.push_back(remote);
+            inserted++;
+        }
+        if (fi_addrs != nullptr)
+        {
+            fi_addrs[i] = fiAddr;
+        }
+    }
+    return inserted;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_tsend(struct fid_ep*         ep,
+                                          const void*            buf,
+                                          size_t                 len,
+                                          [[maybe_unused]] void* desc,
+                                          fi_addr_t              dest_addr,
+                                          uint64_t               tag,
+                                          void*                  context)
+{
+    locker_t        lock(m_lock);
+    Endpoint* const src = reinterpret_cast<Endpoint*>(ep);
+    if (!src->enabled)
+    {
+        return -FI_EOPBADSTATE;
+    }
+    if (src->av == nullptr || dest_addr >= src->av->addrs.size())
+    {
+        return -FI_EINVAL;
+    }
+    Inbox* const inbox = resolveInbox(src->av->addrs[dest_addr]);
+    if (inbox == nullptr)
+    {
+        return -FI_EHOSTUNREACH;
+    }
+
+    const uint64_t postNs    = nowNs();
+    src->txFreeNs            = std::max(postNs, src->txFreeNs) + wireNs(len);
+    const uint64_t arrivalNs = src->txFreeNs + m_latencyNs;
+    m_stats.sends++;
+    m_stats.bytes += len;
+
+    // A fragment takes at most half of the inbox, so the owner can drain one while the next is written
+    const uint8_t* const data    = static_cast<const uint8_t*>(buf);
+    const size_t         maxFrag = inbox->size / 2 - sizeof(LoopbackFrame);
+    const uint64_t       srcAddr = makeAddr(m_pid, src->id);
+    size_t               offset  = 0;
+    do
+    {
+        const size_t        fragLen = std::min(len - offset, maxFrag);
+        const LoopbackFrame frame   = {srcAddr, tag, arrivalNs, fragLen, offset + fragLen == len};
+        pushFrame(inbox, &frame, sizeof(frame), data + offset, fragLen);
+        offset += fragLen;
+    } while (offset < len);
+
+    Completion completion = {};
+    completion.entry      = {context, FI_TAGGED | FI_SEND, len, nullptr, 0, tag};
+    complete(src->cq, postNs, src->txFreeNs, completion);
+    return 0;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_trecv(struct fid_ep*         ep,
+                                          void*                  buf,
+                                          size_t                 len,
+                                          [[maybe_unused]] void* desc,
+                                          fi_addr_t              src_addr,
+                                          uint64_t               tag,
+                                          uint64_t               ignore,
+                                          void*                  context)
+{
+    locker_t        lock(m_lock);
+    Endpoint* const endpoint = reinterpret_cast<Endpoint*>(ep);
+    if (!endpoint->enabled)
+    {
+        return -FI_EOPBADSTATE;
+    }
+
+    uint64_t src = 0;
+    if (src_addr != FI_ADDR_UNSPEC)
+    {
+        if (endpoint->av == nullptr || src_addr >= endpoint->av->addrs.size())
+        {
+            return -FI_EINVAL;
+        }
+        src = endpoint->av->addrs[src_addr];
+    }
+
+    // Messages already in the inbox arrived before this receive was posted
+    drain(endpoint);
+    const PostedRecv recv  = {buf, len, src, tag, ignore, context, nowNs()};
+    auto             msgIt = std::find_if(endpoint->unexpected.begin(),
+                                          endpoint->unexpected.end(),
+                                          [&](const Message& msg) { return matches(recv, msg.src, msg.tag); });
+    if (msgIt != endpoint->unexpected.end())
+    {
+        deliver(recv,
+                msgIt->tag,
+                msgIt->data.data(),
+                msgIt->data.size(),
+                std::max(recv.postNs, msgIt->arrivalNs),
+                endpoint->cq);
+        endpoint->unexpected.erase(msgIt);
+    }
+    else
+    {
+        endpoint->recvs.push_back(recv);
+    }
+    return 0;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_cq_read(struct fid_cq* cq, void* buf, size_t count)
+{
+    locker_t                         lock(m_lock);
+    CompletionQueue* const           queue   = reinterpret_cast<CompletionQueue*>(cq);
+    struct fi_cq_tagged_entry* const entries = static_cast<struct fi_cq_tagged_entry*>(buf);
+    progress();
+    const uint64_t now = nowNs();
+
+    size_t read = 0;
+    auto   it   = queue->entries.begin();
+    while (read < count && it != queue->entries.end() && it->first.first <= now)
+    {
+        if (it->second.err != 0)
+        {
+            // Report the successful completions first, the error is read by fi_cq_readerr
+            if (read == 0) return -FI_EAVAIL;
+            break;
+        }
+        entries[read++] = it->second.entry;
+        it              = queue->entries.erase(it);
+    }
+    return (read > 0) ? static_cast<ssize_t>(read) : -FI_EAGAIN;
+}
+
+ssize_t
+ofi_loopback_plugin_t::w_fi_cq_readerr(struct fid_cq* cq, struct fi_cq_err_entry* buf, [[maybe_unused]] uint64_t flags)
+{
+    locker_t               lock(m_lock);
+    CompletionQueue* const queue = reinterpret_cast<CompletionQueue*>(cq);
+    const auto             it    = queue->entries.begin();
+    if (it == queue->entries.end() || it->first.first > nowNs() || it->second.err == 0)
+    {
+        return -FI_EAGAIN;
+    }
+
+    const Completion& completion = it->second;
+    *buf                         = {};
+    buf->op_context              = completion.entry.op_context;
+    buf->flags                   = completion.entry.flags;
+    buf->len                     = completion.entry.len;
+    buf->buf                     = completion.entry.buf;
+    buf->data                    = completion.entry.data;
+    buf->tag                     = completion.entry.tag;
+    buf->olen                    = completion.olen;
+    buf->err                     = completion.err;
+    buf->prov_errno              = completion.err;
+    queue->entries.erase(it);
+    return 1;
+}
+
+const char* ofi_loopback_plugin_t::w_fi_cq_strerror([[maybe_unused]] struct fid_cq* cq,
+                                                    int                             prov_errno,
+                                                    [[maybe_unused]] const void*    err_data,
+                                                    char*                           buf,
+                                                    size_t                          len)
+{
+    const char* const str = w_fi_strerror(prov_errno);
+    if (buf != nullptr && len > 0)
+    {
+        strncpy(buf, str, len - 1);
+        buf[len - 1] = '\0';
+        return buf;
+    }
+    return str;
+}
+
+void* ofi_loopback_plugin_t::w_fi_mr_desc(struct fid_mr* mr)
+{
+    return mr->mem_desc;
+}
+
+int ofi_loopback_plugin_t::w_fi_mr_regattr([[maybe_unused]] struct fid_domain* domain,
+                                           const struct fi_mr_attr*            attr,
+                                           uint64_t                            flags,
+                                           struct fid_mr**                     mr)
+{
+    if ((flags & FI_MR_DMABUF) || (attr != nullptr && attr->iface != FI_HMEM_SYSTEM))
+    {
+        return -FI_ENOSYS;
+    }
+
+    locker_t             lock(m_lock);
+    struct fid_mr* const newMr = new fid_mr();
+    newMr->fid.fclass          = FI_CLASS_MR;
+    newMr->fid.context         = (attr != nullptr) ? attr->context : nullptr;
+    newMr->mem_desc            = newMr;
+    newMr->key                 = m_nextMrKey++;
+    m_stats.registrations++;
+    *mr = newMr;
+    return 0;
+}
+
+uint64_t ofi_loopback_plugin_t::w_fi_mr_key(struct fid_mr* mr)
+{
+    return mr->key;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_read([[maybe_unused]] struct fid_ep* ep,
+                                         [[maybe_unused]] void*          buf,
+                                         [[maybe_unused]] size_t         len,
+                                         [[maybe_unused]] void*          desc,
+                                         [[maybe_unused]] fi_addr_t      src_addr,
+                                         [[maybe_unused]] uint64_t       addr,
+                                         [[maybe_unused]] uint64_t       key,
+                                         [[maybe_unused]] void*          context)
+{
+    return -FI_ENOSYS;
+}
+
+uint32_t ofi_loopback_plugin_t::w_fi_version()
+{
+    // The minimal version HCL supports, gaudi-direct and zero-copy are not attempted
+    return ofi_version;
+}
+
+int ofi_loopback_plugin_t::w_fi_eq_open([[maybe_unused]] struct fid_fabric* fabric,
+                                        [[maybe_unused]] struct fi_eq_attr* attr,
+                                        [[maybe_unused]] struct fid_eq**    eq,
+                                        [[maybe_unused]] void*              context)
+{
+    return -FI_ENOSYS;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_eq_sread([[maybe_unused]] struct fid_eq* eq,
+                                             [[maybe_unused]] uint32_t*      event,
+                                             [[maybe_unused]] void*          buf,
+                                             [[maybe_unused]] size_t         len,
+                                             [[maybe_unused]] int            timeout,
+                                             [[maybe_unused]] uint64_t       flags)
+{
+    return -FI_ENOSYS;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_eq_readerr([[maybe_unused]] struct fid_eq*          eq,
+                                               [[maybe_unused]] struct fi_eq_err_entry* buf,
+                                               [[maybe_unused]] uint64_t                flags)
+{
+    return -FI_ENOSYS;
+}
+
+int ofi_loopback_plugin_t::w_fi_passive_ep([[maybe_unused]] struct fid_fabric* fabric,
+                                           [[maybe_unused]] struct fi_info*    info,
+                                           [[maybe_unused]] struct fid_pep**   pep,
+                                           [[maybe_unused]] void*              context)
+{
+    return -FI_ENOSYS;
+}
+
+int ofi_loopback_plugin_t::w_fi_pep_bind([[maybe_unused]] struct fid_pep* pep,
+                                         [[maybe_unused]] struct fid*     bfid,
+                                         [[maybe_unused]] uint64_t        flags)
+{
+    return -FI_ENOSYS;
+}
+
+int ofi_loopback_plugin_t::w_fi_listen([[maybe_unused]] struct fid_pep* pep)
+{
+    return -FI_ENOSYS;
+}
+
+int ofi_loopback_plugin_t::w_fi_connect([[maybe_unused]] struct fid_ep* ep,
+                                        [[maybe_unused]] const void*    addr,
+                                        [[maybe_unused]] const void*    param,
+                                        [[maybe_unused]] size_t         paramlen)
+{
+    return -FI_ENOSYS;
+}
+
+int ofi_loopback_plugin_t::w_fi_accept([[maybe_unused]] struct fid_ep* ep,
+                                       [[maybe_unused]] const void*    param,
+                                       [[maybe_unused]] size_t         paramlen)
+{
+    return -FI_ENOSYS;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_send([[maybe_unused]] struct fid_ep* ep,
+                                         [[maybe_unused]] const void*    buf,
+                                         [[maybe_unused]] size_t         len,
+                                         [[maybe_unused]] void*          desc,
+                                         [[maybe_unused]] fi_addr_t      dest_addr,
+                                         [[maybe_unused]] void*          context)
+{
+    return -FI_ENOSYS;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_recv([[maybe_unused]] struct fid_ep* ep,
+                                         [[maybe_unused]] void*          buf,
+                                         [[maybe_unused]] size_t         len,
+                                         [[maybe_unused]] void*          desc,
+                                         [[maybe_unused]] fi_addr_t      src_addr,
+                                         [[maybe_unused]] void*          context)
+{
+    return -FI_ENOSYS;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_tsendmsg(struct fid_ep* ep, const struct fi_msg_tagged* msg, uint64_t flags)
+{
+    if (msg->iov_count != 1)
+    {
+        return -FI_EINVAL;
+    }
+    const ssize_t ret = w_fi_tsend(ep,
+                                   msg->msg_iov[0].iov_base,
+                                   msg->msg_iov[0].iov_len,
+                                   msg->desc ? msg->desc[0] : nullptr,
+                                   msg->addr,
+                                   msg->tag,
+                                   msg->context);
+    if (ret == 0 && (flags & FI_MORE))
+    {
+        locker_t lock(m_lock);
+        m_stats.morePosts++;
+    }
+    return ret;
+}
+
+ssize_t ofi_loopback_plugin_t::w_fi_trecvmsg(struct fid_ep* ep, const struct fi_msg_tagged* msg, uint64_t flags)
+{
+    if (msg->iov_count != 1)
+    {
+        return -FI_EINVAL;
+    }
+    const ssize_t ret = w_fi_trecv(ep,
+                                   msg->msg_iov[0].iov_base,
+                                   msg->msg_iov[0].iov_len,
+                                   msg->desc ? msg->desc[0] : nullptr,
+                                   msg->addr,
+                                   msg->tag,
+                                   msg->ignore,
+                                   msg->context);
+    if (ret == 0 && (flags & FI_MORE))
+    {
+        locker_t lock(m_lock);
+        m_stats.morePosts++;
+    }
+    return ret;
+}
+
+ofi_loopback_stats_t ofi_loopback_plugin_t::getStats()
+{
+    locker_t lock(m_lock);
+    return m_stats;
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>        // for uint*_t
+#include <sys/types.h>    // for pid_t
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "hccl_ofi_wrapper_interface.h"  // for ofi_plugin_interface
+#include "hcl_types.h"                   // for lock_t, locker_t
+#include "rdma/fi_eq.h"                  // for fi_cq_tagged_entry
+
+struct ofi_loopback_stats_t
+{
+    uint64_t sends           = 0;
+    uint64_t recvs           = 0;
+    uint64_t unexpected      = 0;  // sends that arrived before a matching recv was posted
+    uint64_t truncated       = 0;
+    uint64_t bytes           = 0;
+    uint64_t registrations   = 0;
+    uint64_t completions     = 0;
+    uint64_t completionNs    = 0;  // sum of post to completion-ready time over all completions
+    uint64_t maxCompletionNs = 0;
+    uint64_t morePosts       = 0;  // msg posts flagged FI_MORE
+};
+
+/**
+ * @brief Shared memory fabric implementing the subset of ofi_plugin_interface used by the host scaleout path.
+ *
+ * Selected by HCL_OFI_LOOPBACK instead of loading libhccl_ofi_wrapper.so. Every endpoint owns a shared memory inbox
+ * of HCL_OFI_LOOPBACK_INBOX_SIZE named after its process id and endpoint id, which is also the name returned by
+ * fi_getname. Senders of any process of the host write their messages into the inbox of the destination, in
+ * fragments when a message doesn't fit, and the owner drains it into its receives whenever it posts a receive or
+ * reads its CQ. Endpoints of the same process go through the same inbox, so ranks of one process and ranks of
+ * several processes behave alike. A name of another host can't be mapped and is rejected by fi_av_insert.
+ *
+ * Supported are a single RDM provider ("loopback"), fabric/domain/endpoint/AV/CQ objects, tagged send/recv with
+ * ignore masks and unexpected-message buffering, tagged CQ format with error entries, and host memory registration.
+ * Tagged msg posts take a single iov and are written to the inbox immediately, FI_MORE is only counted.
+ * HMEM, RMA and connection-oriented calls are not supported, so gaudi-direct, zero-copy and the PCIe flush stay off.
+ *
+ * Each endpoint has a transmit link of HCL_OFI_LOOPBACK_BW_MBPS (0 for unlimited). A send occupies the link for
+ * len / bandwidth, its completion is ready when the link is done and the matching receive completes
+ * HCL_OFI_LOOPBACK_LATENCY_NS later, on the steady clock which all processes of the host share. Completions are
+ * returned by fi_cq_read once ready, in ready time order.
+ * Thread-safe; all objects of a process share a single lock, writers of an inbox share its process-shared mutex.
+ */
+class ofi_loopback_plugin_t : public ofi_plugin_interface
+{
+public:
+    ofi_loopback_plugin_t();
+    virtual ~ofi_loopback_plugin_t();
+
+    ofi_loopback_plugin_t(const ofi_loopback_plugin_t&)            = delete;
+    ofi_loopback_plugin_t& operator=(const ofi_loopback_plugin_t&) = delete;
+
+    virtual int             w_fi_getinfo(int                   version,
+                                         const char*           node,
+                                         const char*           service,
+                                         uint64_t              flags,
+                                         const struct fi_info* hints,
+                                         struct fi_info**      info) override;
+    virtual struct fi_info* w_fi_allocinfo() override;
+    virtual void            w_fi_freeinfo(struct fi_info* info) override;
+    virtual const char*     w_fi_strerror(int err) override;
+    virtual char*           w_fi_tostr(const void* data, enum fi_type datatype) override;
+    virtual int             w_fi_close(fid_t fid) override;
+    virtual int w_fi_fabric(struct fi_fabric_attr* attr, struct fid_fabric** fabric, void* context) override;
+    virtual int
+    w_fi_domain(struct fid_fabric* fabric, struct fi_info* info, struct fid_domain** domain, void* context) override;
+    virtual int
+    w_fi_endpoint(struct fid_domain* domain, struct fi_info* info, struct fid_ep** ep, void* context) override;
+    virtual int
+    w_fi_cq_open(struct fid_domain* domain, struct fi_cq_attr* attr, struct fid_cq** cq, void* context) override;
+    virtual int
+    w_fi_av_open(struct fid_domain* domain, struct fi_av_attr* attr, struct fid_av** av, void* context) override;
+    virtual int w_fi_ep_bind(struct fid_ep* ep, struct fid* fid, uint64_t flags) override;
+    virtual int w_fi_enable(struct fid_ep* ep) override;
+    virtual int w_fi_getname(fid_t fid, void* addr, size_t* addrlen) override;
+    virtual int w_fi_av_insert(struct fid_av* av,
+                               void*          addr,
+                               size_t         count,
+                               fi_addr_t*     fi_addrs,
+                               uint64_t       flags,
+                               void*          context) override;
+
+    virtual ssize_t w_fi_tsend(struct fid_ep* ep,
+                               const void*    buf,
+                               size_t         len,
+                               void*          desc,
+                               fi_addr_t      dest_addr,
+                               uint64_t       tag,
+                               void*          context) override;
+    virtual ssize_t w_fi_trecv(struct fid_ep* ep,
+                               void*          buf,
+                               size_t         len,
+                               void*          desc,
+                               fi_addr_t      src_addr,
+                               uint64_t       tag,
+                               uint64_t       ignore,
+                               void*          context) override;
+
+    virtual ssize_t w_fi_cq_read(struct fid_cq* cq, void* buf, size_t count) override;
+    virtual ssize_t w_fi_cq_readerr(struct fid_cq* cq, struct fi_cq_err_entry* buf, uint64_t flags) override;
+    virtual const char*
+    w_fi_cq_strerror(struct fid_cq* cq, int prov_errno, const void* err_data, char* buf, size_t len) override;
+    virtual void* w_fi_mr_desc(struct fid_mr* mr) override;
+    virtual int w_fi_mr_regattr(struct fid_domain*       domain,
+                                const struct fi_mr_attr* attr,
+                                uint64_t                 flags,
+                                struct fid_mr**          mr) override;
+    virtual uint64_t w_fi_mr_key(struct fid_mr* mr) override;
+
+    virtual ssize_t w_fi_read(struct fid_ep* ep,
+                              void*          buf,
+                              size_t         len,
+                              void*          desc,
+                              fi_addr_t      src_addr,
+                              uint64_t       addr,
+                              uint64_t       key,
+                              void*          context) override;
+
+    virtual uint32_t w_fi_version() override;
+
+    virtual struct fi_info* w_fi_dupinfo(const struct fi_info* info) override;
+
+    virtual int
+    w_fi_eq_open(struct fid_fabric* fabric, struct fi_eq_attr* attr, struct fid_eq** eq, void* context) override;
+    virtual ssize_t
+    w_fi_eq_sread(struct fid_eq* eq, uint32_t* event, void* buf, size_t len, int timeout, uint64_t flags) override;
+    virtual ssize_t w_fi_eq_readerr(struct fid_eq* eq, struct fi_eq_err_entry* buf, uint64_t flags) override;
+
+    virtual int
+    w_fi_passive_ep(struct fid_fabric* fabric, struct fi_info* info, struct fid_pep** pep, void* context) override;
+    virtual int w_fi_pep_bind(struct fid_pep* pep, struct fid* bfid, uint64_t flags) override;
+    virtual int w_fi_listen(struct fid_pep* pep) override;
+    virtual int w_fi_connect(struct fid_ep* ep, const void* addr, const void* param, size_t paramlen) override;
+    virtual int w_fi_accept(struct fid_ep* ep, const void* param, size_t paramlen) override;
+
+    virtual ssize_t
+    w_fi_send(struct fid_ep* ep, const void* buf, size_t len, void* desc, fi_addr_t dest_addr, void* context) override;
+    virtual ssize_t
+    w_fi_recv(struct fid_ep* ep, void* buf, size_t len, void* desc, fi_addr_t src_addr, void* context) override;
+
+    virtual ssize_t w_fi_tsendmsg(struct fid_ep* ep, const struct fi_msg_tagged* msg, uint64_t flags) override;
+    virtual ssize_t w_fi_trecvmsg(struct fid_ep* ep, const struct fi_msg_tagged* msg, uint64_t flags) override;
+
+    ofi_loopback_stats_t getStats();
+
+private:
+    struct Inbox;
+    struct Endpoint;
+    struct CompletionQueue;
+    struct AddressVector;
+
+    struct Completion
+    {
+        struct fi_cq_tagged_entry entry;
+        int                       err;   // 0 for a successful completion, positive fabric errno otherwise
+        size_t                    olen;  // truncated bytes of an FI_ETRUNC completion
+    };
+
+    struct Message
+    {
+        uint64_t             src;
+        uint64_t             tag;
+        std::vector<uint8_t> data;
+        uint64_t             arrivalNs;
+    };
+
+    struct PostedRecv
+    {
+        void*    buf;
+        size_t   len;
+        uint64_t src;  // 0 for any source
+        uint64_t tag;
+        uint64_t ignore;
+        void*    context;
+        uint64_t postNs;
+    };
+
+    static bool matches(const PostedRecv& recv, uint64_t src, uint64_t tag);
+
+    void     complete(CompletionQueue* cq, uint64_t postNs, uint64_t readyNs, const Completion& completion);
+    void     deliver(const PostedRecv& recv,
+                     uint64_t          tag,
+                     const void*       data,
+                     size_t            len,
+                     uint64_t          readyNs,
+                     CompletionQueue*  cq);
+    uint64_t wireNs(size_t len) const;
+    Inbox*   resolveInbox(uint64_t addr);
+    void     pushFrame(Inbox* inbox, const void* frame, size_t frameLen, const void* payload, size_t payloadLen);
+    void     drain(Endpoint* endpoint);
+    void     progress();
+
+    const uint64_t m_latencyNs;
+    const uint64_t m_bwMBps;
+    const uint64_t m_inboxSize;
+    const pid_t    m_pid;
+
+    lock_t                                  m_lock;
+    std::unordered_map<uint32_t, Endpoint*> m_endpoints;
+    std::unordered_map<uint64_t, Inbox*>    m_peerInboxes;  // inboxes of other processes by address
+    uint32_t                                m_nextEpId  = 1;  // 0 is reserved for any source
+    uint64_t                                m_nextMrKey = 1;
+    uint64_t                                m_nextSeq   = 0;
+    ofi_loopback_stats_t                    m_stats;
+};
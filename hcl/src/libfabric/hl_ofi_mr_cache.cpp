@@ -0,0 +1,180 @@
+#include "libfabric/hl_ofi_mr_cache.h"
+
+#include <algorithm>  // for min, max
+#include <vector>     // for vector
+#include "hcl_utils.h"        // for VERIFY, LOG_HCL_*
+#include "hcl_log_manager.h"  // for LOG_*
+
+ofi_mr_cache_t::ofi_mr_cache_t(ofi_mr_registrar_t& registrar, const uint64_t maxEntries, const uint64_t maxBytes)
+: m_registrar(registrar), m_maxEntries(std::max<uint64_t>(maxEntries, 1)), m_maxBytes(maxBytes)
+{
+}
+
+ofi_mr_cache_t::~ofi_mr_cache_t()
+{
+    LOG_HCL_INFO(HCL_OFI,
+                 "MR cache: hits={}, misses={}, registrations={}, failures={}, evictions={}, merges={}",
+                 m_stats.hits,
+                 m_stats.misses,
+                 m_stats.registrations,
+                 m_stats.failures,
+                 m_stats.evictions,
+                 m_stats.merges);
+
+    for (auto& [start, entry] : m_entries)
+    {
+        if (entry.refcnt != 0)
+        {
+            LOG_HCL_WARN(HCL_OFI, "MR cache entry [0x{:x}, 0x{:x}) is still in use", entry.start, entry.end);
+        }
+        m_registrar.deregisterRange(entry.handle);
+    }
+}
+
+ofi_mr_cache_t::EntryMap::iterator ofi_mr_cache_t::findContaining(const uint64_t addr, const uint64_t end)
+{
+    // entries don't overlap, so the only candidate is the last one starting at or before addr
+    auto it = m_entries.upper_bound(addr);
+    if (it == m_entries.begin())
+    {
+        return m_entries.end();
+    }
+    --it;
+    return (it->second.end >= end) ? it : m_entries.end();
+}
+
+void ofi_mr_cache_t::touch(ofi_mr_cache_entry_t& entry)
+{
+    m_lru.splice(m_lru.begin(), m_lru, entry.lruIt);
+}
+
+void ofi_mr_cache_t::erase(EntryMap::iterator it)
+{
+    m_registrar.deregisterRange(it->second.handle);
+    m_bytes -= it->second.end - it->second.start;
+    m_lru.erase(it->second.lruIt);
+    m_entries.erase(it);
+}
+
+void ofi_mr_cache_t::evict(const uint64_t incomingBytes)
+{
+    auto lruIt = m_lru.end();
+    while (lruIt != m_lru.begin() &&
+           (m_entries.size() >= m_maxEntries || (m_maxBytes != 0 && m_bytes + incomingBytes > m_maxBytes)))
+    {
+        --lruIt;
+        auto it = m_entries.find(*lruIt);
+        if (it->second.refcnt != 0)
+        {
+            continue;
+        }
+        LOG_HCL_DEBUG(HCL_OFI, "MR cache evicting [0x{:x}, 0x{:x})", it->second.start, it->second.end);
+        lruIt = std::next(lruIt);
+        erase(it);
+        m_stats.evictions++;
+    }
+}
+
+const ofi_mr_cache_entry_t* ofi_mr_cache_t::acquire(const uint64_t addr, const uint64_t size)
+{
+    VERIFY(size > 0, "Cannot register an empty range at 0x{:x}", addr);
+    const uint64_t end = addr + size;
+
+    locker_t lock(m_lock);
+
+    auto it = findContaining(addr, end);
+    if (it != m_entries.end())
+    {
+        m_stats.hits++;
+        it->second.refcnt++;
+        touch(it->second);
+        return &it->second;
+    }
+    m_stats.misses++;
+
+    // Collect overlapping entries, the new registration will cover their union
+    uint64_t                        newStart = addr;
+    uint64_t                        newEnd   = end;
+    std::vector<EntryMap::iterator> overlapping;
+    auto                            first = m_entries.upper_bound(addr);
+    if (first != m_entries.begin() && std::prev(first)->second.end > addr)
+    {
+        --first;
+    }
+    for (auto ovIt = first; ovIt != m_entries.end() && ovIt->second.start < end; ++ovIt)
+    {
+        if (ovIt->second.refcnt != 0)
+        {
+            LOG_HCL_DEBUG(HCL_OFI,
+                          "MR cache can't register [0x{:x}, 0x{:x}), overlaps in-use entry [0x{:x}, 0x{:x})",
+                          addr,
+                          end,
+                          ovIt->second.start,
+                          ovIt->second.end);
+            m_stats.failures++;
+            return nullptr;
+        }
+        newStart = std::min(newStart, ovIt->second.start);
+        newEnd   = std::max(newEnd, ovIt->second.end);
+        overlapping.push_back(ovIt);
+    }
+
+    for (auto ovIt : overlapping)
+    {
+        erase(ovIt);
+        m_stats.merges++;
+    }
+
+    evict(newEnd - newStart);
+
+    void* handle = nullptr;
+    void* desc   = nullptr;
+    if (!m_registrar.registerRange(newStart, newEnd - newStart, handle, desc))
+    {
+        m_stats.failures++;
+        return nullptr;
+    }
+    m_stats.registrations++;
+
+    m_lru.push_front(newStart);
+    ofi_mr_cache_entry_t& entry = m_entries[newStart];
+    entry                       = {newStart, newEnd, handle, desc, 1, m_lru.begin()};
+    m_bytes += newEnd - newStart;
+
+    LOG_HCL_DEBUG(HCL_OFI,
+                  "MR cache registered [0x{:x}, 0x{:x}), entries={}, bytes={}",
+                  newStart,
+                  newEnd,
+                  m_entries.size(),
+                  m_bytes);
+    return &entry;
+}
+
+const ofi_mr_cache_entry_t* ofi_mr_cache_t::find(const uint64_t addr, const uint64_t size)
+{
+    locker_t lock(m_lock);
+
+    auto it = findContaining(addr, addr + size);
+    return (it != m_entries.end()) ? &it->second : nullptr;
+}
+
+void ofi_mr_cache_t::release(const ofi_mr_cache_entry_t* const entry)
+{
+    locker_t lock(m_lock);
+
+    auto it = m_entries.find(entry->start);
+    VERIFY(it != m_entries.end() && it->second.refcnt > 0, "Releasing an unknown MR cache entry 0x{:x}", entry->start);
+    it->second.refcnt--;
+}
+
+ofi_mr_cache_stats_t ofi_mr_cache_t::getStats()
+{
+    locker_t lock(m_lock);
+    return m_stats;
+}
+
+size_t ofi_mr_cache_t::size()
+{
+    locker_t lock(m_lock);
+    return m_entries.size();
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>  // for uint64_t
+#include <list>     // for list
+#include <map>      // for map
+#include "hcl_types.h"  // for lock_t, locker_t
+
+/**
+ * @brief Backend used by ofi_mr_cache_t to register/deregister memory ranges.
+ *
+ * The component implements it on top of fi_mr_regattr. Keeping it abstract allows driving the cache with a fake
+ * provider that only counts registrations.
+ */
+class ofi_mr_registrar_t
+{
+public:
+    virtual ~ofi_mr_registrar_t() = default;
+
+    /**
+     * @brief Register [addr, addr + size).
+     *
+     * @return true on success, in which case handle and desc are filled; false if the range cannot be registered.
+     */
+    virtual bool registerRange(uint64_t addr, uint64_t size, void*& handle, void*& desc) = 0;
+    virtual void deregisterRange(void* handle)                                           = 0;
+};
+
+struct ofi_mr_cache_entry_t
+{
+    uint64_t start;
+    uint64_t end;  // exclusive
+    void*    handle;
+    void*    desc;
+    unsigned refcnt;
+
+    std::list<uint64_t>::iterator lruIt;  // position in the LRU list (keyed by start address)
+};
+
+struct ofi_mr_cache_stats_t
+{
+    uint64_t hits          = 0;
+    uint64_t misses        = 0;
+    uint64_t registrations = 0;
+    uint64_t failures      = 0;
+    uint64_t evictions     = 0;
+    uint64_t merges        = 0;
+};
+
+/**
+ * @brief Interval-keyed, LRU-bounded cache of memory registrations.
+ *
+ * Entries never overlap. A request that is fully contained in an entry is a hit. On a miss, all unpinned entries
+ * overlapping the requested range are merged into a single registration that covers their union, so repeated
+ * accesses to neighbouring sub-ranges of the same user buffer converge to one MR. If a pinned entry overlaps the
+ * request, the merge is not possible and the request fails (the caller falls back to the staged path).
+ *
+ * When the number of entries or the registered bytes exceed the configured bounds, least recently used unpinned
+ * entries are deregistered. Thread-safe.
+ */
+class ofi_mr_cache_t
+{
+public:
+    ofi_mr_cache_t(ofi_mr_registrar_t& registrar, uint64_t maxEntries, uint64_t maxBytes);
+    ~ofi_mr_cache_t();
+
+    ofi_mr_cache_t(const ofi_mr_cache_t&)            = delete;
+    ofi_mr_cache_t& operator=(const ofi_mr_cache_t&) = delete;
+
+    /**
+     * @brief Find or create a registration covering [addr, addr + size) and pin it.
+     *
+     * @return the pinned entry, or nullptr if the range could not be registered.
+     */
+    const ofi_mr_cache_entry_t* acquire(uint64_t addr, uint64_t size);
+
+    /**
+     * @brief Find an existing registration covering [addr, addr + size) without changing its pin count.
+     */
+    const ofi_mr_cache_entry_t* find(uint64_t addr, uint64_t size);
+
+    void release(const ofi_mr_cache_entry_t* entry);
+
+    ofi_mr_cache_stats_t getStats();
+    size_t               size();
+
+private:
+    using EntryMap = std::map<uint64_t /*start*/, ofi_mr_cache_entry_t>;
+
+    EntryMap::iterator findContaining(uint64_t addr, uint64_t end);
+    void               touch(ofi_mr_cache_entry_t& entry);
+    void               erase(EntryMap::iterator it);
+    void               evict(uint64_t incomingBytes);
+
+    ofi_mr_registrar_t&  m_registrar;
+    const uint64_t       m_maxEntries;
+    const uint64_t       m_maxBytes;
+    uint64_t             m_bytes = 0;
+    EntryMap             m_entries;
+    std::list<uint64_t>  m_lru;  // front = most recently used
+    ofi_mr_cache_stats_t m_stats;
+    lock_t               m_lock;
+};
@@ -1,5 +1,8 @@
 #include "hl_ofi_rdm_component.h"
 
+#include <set>            // for set
+#include <unordered_map>  // for unordered_map
+
 #include "hccl_ofi_wrapper_interface.h"  // for ofi_plugin_interface
 #include "hccl_types.h"                  // for hcclLibfabricError, hcclSuccess
 #include "hcl_utils.h"                   // for LOG_HCL_ERR, LOG_HCL_DEBUG
@@ -11,6 +14,7 @@
 #include "rdma/fi_endpoint.h"            // for fid_ep
 #include "rdma/fi_eq.h"                  // for fi_cq_tagged_entry, fi_cq_er...
 #include "rdma/fi_errno.h"               // for FI_EAGAIN, FI_EAVAIL
+#include "rdma/fi_tagged.h"              // for fi_msg_tagged
 #include "infra/hcl_debug_stats.h"       // for DEBUG_STATS_...
 
 ofi_rdm_component_t::ofi_rdm_component_t(int ofiDeviceId, int hw_module_id, struct fi_info* prov, int cpuid)
@@ -91,6 +95,7 @@ int ofi_rdm_component_t::listen(uint64_t      tag,
     listenComm->accepted      = false;
     listenComm->dev           = m_ofiDeviceID;
     listenComm->local_ep_addr = local_ep_addr;
+    listenComm->mrCache       = getUserMrCache(qpSetIndex);
     listenComm->isInitialized = true;
 
     LOG_HCL_DEBUG(HCL_OFI,
@@ -161,6 +166,7 @@ int ofi_rdm_component_t::accept(listenComm_t* lComm, ofiComm_t* ofiComm)
     ofiComm->mrDesc         = lComm->mrDesc;
     ofiComm->local_ep_addr  = lComm->local_ep_addr;
     ofiComm->remote_ep_addr = remote_ep;
+    ofiComm->mrCache        = lComm->mrCache;
     ofiComm->dev            = m_ofiDeviceID;
     ofiComm->isInitialized  = true;
 
@@ -212,6 +218,7 @@ int ofi_rdm_component_t::connect(const void*            handle,
     ofiComm->cq             = *cq;
     ofiComm->mrDesc         = desc;
     ofiComm->remote_ep_addr = remote_addr;
+    ofiComm->mrCache        = getUserMrCache(qpSetIndex);
     ofiComm->dev            = m_ofiDeviceID;
     ofiComm->isInitialized  = true;
 
@@ -329,11 +336,13 @@ int ofi_rdm_component_t::isend(ofiComm_t* const       ofiComm,
 
     OFI_EXIT_ON_ERROR(ofi_progress(ofiComm->cq));
 
+    req->userMr = findUserMr(ofiComm, data, size);
+
     // Try sending data to remote EP; return nullptr request if not able to send
     rc = ofi_plugin->w_fi_tsend(ofiComm->local_ep,
                                 data,
                                 size,
-                                ofiComm->mrDesc,
+                                req->userMr ? req->userMr->desc : ofiComm->mrDesc,
                                 ofiComm->remote_ep_addr,
                                 ofiComm->tag,
                                 &req->ctx);
@@ -379,9 +388,17 @@ int ofi_rdm_component_t::irecv(ofiComm_t* const       ofiComm,
 
     OFI_EXIT_ON_ERROR(ofi_progress(ofiComm->cq));
 
+    req->userMr = findUserMr(ofiComm, data, size);
+
     // Try posting buffer to local EP
-    rc = ofi_plugin
-             ->w_fi_trecv(ofiComm->local_ep, data, size, ofiComm->mrDesc, FI_ADDR_UNSPEC, ofiComm->tag, 0, &req->ctx);
+    rc = ofi_plugin->w_fi_trecv(ofiComm->local_ep,
+                                data,
+                                size,
+                                req->userMr ? req->userMr->desc : ofiComm->mrDesc,
+                                FI_ADDR_UNSPEC,
+                                ofiComm->tag,
+                                0,
+                                &req->ctx);
     if (rc == -FI_EAGAIN)
     {
         // return nullptr request
@@ -406,6 +423,17 @@ error:
     return ret;
 }
 
+const ofi_mr_cache_entry_t*
+ofi_rdm_component_t::findUserMr(ofiComm_t* const ofiComm, void* const data, const size_t size)
+{
+    if (ofiComm->mrCache == nullptr)
+    {
+        return nullptr;
+    }
+    // The buffer was pinned by acquireUserBuffer when the transfer was scheduled, the pin is released in test()
+    return ofiComm->mrCache->find(reinterpret_cast<uint64_t>(data), size);
+}
+
 ofi_rdm_component_t::Resources ofi_rdm_component_t::acquire_resources(unsigned                          hostConnIdx,
                                                                       ofi_rdm_component_t::EndpointRole role,
                                                                       uint16_t                          qpSetIndex)
@@ -456,3 +484,124 @@ bool ofi_rdm_component_t::isDifferentQP(const unsigned
     return ((requestedHostConnIdx != existingHostConnIdx) || (requestedRole != existingRole) ||
             (requestedQpSetIndex != existingQpSetIndex));
 }
+
+int ofi_rdm_component_t::queue(ofiComm_t* const          ofiComm,
+                               void* const               data,
+                               const size_t              size,
+                               const ofi_req_direction_t direction,
+                               ofi_req_t** const         request,
+                               OfiCompCallbackParams&    compParams,
+                               ofi_post_batch_t&         batch)
+{
+    assert(ofiComm->dev == m_ofiDeviceID);
+
+    ofi_req_t* const req = new ofi_req_t();
+    req->ofiComm         = ofiComm;
+    req->ofiDevice       = ofiComm->dev;
+    req->direction       = direction;
+    req->compParams      = compParams;
+    req->userMr          = findUserMr(ofiComm, data, size);
+
+    // Counted as inflight from now on, test() of a request that wasn't posted yet finds it not done
+    if (direction == OFI_SEND)
+    {
+        ofiComm->num_inflight_sends++;
+    }
+    else
+    {
+        ofiComm->num_inflight_recvs++;
+    }
+
+    batch.entries.push_back({req, data, size});
+    *request = req;
+    return hcclSuccess;
+}
+
+int ofi_rdm_component_t::post_batch(ofi_post_batch_t& batch)
+{
+    int ret = hcclSuccess;
+
+    // Index of the last post of every endpoint, the only one posted without FI_MORE
+    std::unordered_map<struct fid_ep*, size_t> lastPost;
+    std::set<struct fid_cq*>                   cqs;
+    for (size_t i = 0; i < batch.entries.size(); i++)
+    {
+        const ofi_req_t* const req = batch.entries[i].req;
+        if (req->ofiDevice == m_ofiDeviceID)
+        {
+            lastPost[req->ofiComm->local_ep] = i;
+            cqs.insert(req->ofiComm->cq);
+        }
+    }
+
+    // A single progress per CQ for the whole batch instead of one per post
+    for (struct fid_cq* const cq : cqs)
+    {
+        if (OFI_UNLIKELY(ofi_progress(cq) != 0))
+        {
+            LOG_HCL_ERR(HCL_OFI, "Could not progress OFI device ID {} before posting a batch", m_ofiDeviceID);
+            // Nothing of this device is posted, complete all its requests with an error on their next test
+            for (ofi_post_batch_t::entry_t& entry : batch.entries)
+            {
+                if (entry.req->ofiDevice == m_ofiDeviceID)
+                {
+                    entry.req->state = OFI_REQ_ERROR;
+                }
+            }
+            return hcclLibfabricError;
+        }
+    }
+
+    for (size_t i = 0; i < batch.entries.size(); i++)
+    {
+        ofi_post_batch_t::entry_t& entry = batch.entries[i];
+        ofi_req_t* const           req   = entry.req;
+        if (req->ofiDevice != m_ofiDeviceID)
+        {
+            continue;
+        }
+
+        ofiComm_t* const ofiComm = req->ofiComm;
+        struct iovec     iov     = {entry.data, entry.size};
+        void*            desc    = req->userMr ? req->userMr->desc : ofiComm->mrDesc;
+
+        struct fi_msg_tagged msg = {};
+        msg.msg_iov              = &iov;
+        msg.desc                 = &desc;
+        msg.iov_count            = 1;
+        msg.tag                  = ofiComm->tag;
+        msg.context              = &req->ctx;
+
+        const uint64_t flags = FI_COMPLETION | (lastPost[ofiComm->local_ep] == i ? 0 : FI_MORE);
+        ssize_t        rc    = 0;
+        if (req->direction == OFI_SEND)
+        {
+            msg.addr = ofiComm->remote_ep_addr;
+            rc       = RETRY_ON_EAGAIN(ofi_plugin->w_fi_tsendmsg(ofiComm->local_ep, &msg, flags),
+                                       m_eagainMaxRetryDuration,
+                                       ofi_progress(ofiComm->cq));
+        }
+        else
+        {
+            msg.addr = FI_ADDR_UNSPEC;
+            rc       = RETRY_ON_EAGAIN(ofi_plugin->w_fi_trecvmsg(ofiComm->local_ep, &msg, flags),
+                                       m_eagainMaxRetryDuration,
+                                       ofi_progress(ofiComm->cq));
+        }
+
+        if (OFI_UNLIKELY(rc != 0))
+        {
+            LOG_HCL_ERR(HCL_OFI,
+                        "Could not post batched {} for OFI device ID {}; RC: {}, ERROR: {}",
+                        req->direction == OFI_SEND ? "send" : "recv",
+                        ofiComm->dev,
+                        rc,
+                        ofi_plugin->w_fi_strerror(-rc));
+            // Completes the request with an error on its next test
+            req->state = OFI_REQ_ERROR;
+            ret        = hcclLibfabricError;
+        }
+    }
+
+    return ret;
+}
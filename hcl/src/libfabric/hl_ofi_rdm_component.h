@@ -39,6 +39,14 @@ public:
               const size_t           size,
               ofi_req_t** const      request,
               OfiCompCallbackParams& compParams) override;
+    int queue(ofiComm_t*             ofiComm,
+              void*                  data,
+              size_t                 size,
+              ofi_req_direction_t    direction,
+              ofi_req_t**            request,
+              OfiCompCallbackParams& compParams,
+              ofi_post_batch_t&      batch) override;
+    int post_batch(ofi_post_batch_t& batch) override;
 
     using Resources =
         std::tuple<FiObjectPtr<struct fid_ep*>, FiObjectPtr<struct fid_av*>, FiObjectPtr<struct fid_cq*>, void*>;
@@ -55,6 +63,7 @@ public:
 
 private:
     int             process_completions(void* cq_buf, uint64_t num_cqes) override;
+    static const ofi_mr_cache_entry_t* findUserMr(ofiComm_t* ofiComm, void* data, size_t size);
     static uint64_t calculate_max_tag(const struct fi_info* const provider);
     /**
      * @brief Check whether the required parameters and existing parameters utilize different QPs.
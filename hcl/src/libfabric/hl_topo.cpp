@@ -10,6 +10,7 @@
 #include <hwloc.h>
 #include "hcl_utils.h"  // for VERIFY, LOG_HCL_DEBUG, LOG_H...
 #include "hcl_topology.h"
+#include "hl_topo_cache.h"
 #include <regex>
 #if !defined __GNUC__ || __GNUC__ >= 8
 #include <filesystem>
@@ -401,16 +402,46 @@ std::string translateHwlocType(const hwloc_obj_type_t hwlocType)
     return hwloc_obj_type_string(hwlocType);
 }
 
+static std::string providersCacheKey(const std::string& prefix, const std::vector<struct fi_info*>& providers)
+{
+    std::string key = prefix;
+    for (const struct fi_info* const provider : providers)
+    {
+        key += std::string(":") + provider->nic->device_attr->name;
+    }
+    return key;
+}
+
+static size_t findProvider(const std::vector<struct fi_info*>& providers, const std::string& nicName)
+{
+    return std::distance(providers.cbegin(),
+                         std::find_if(providers.cbegin(), providers.cend(), [&nicName](const fi_info* const provider) {
+                             return nicName == provider->nic->device_attr->name;
+                         }));
+}
+
 std::tuple<size_t, std::string> getBestProvider(const std::vector<struct fi_info*>& providers, const std::string& accel)
 {
     VERIFY(!providers.empty(), "Providers list is empty");
 
+    const std::string cacheKey = providersCacheKey("best:" + accel, providers);
+    if (const auto cached = cache::load(cacheKey))
+    {
+        const std::string nic   = cached->value("nic", "");
+        const size_t      index = nic.empty() ? 0 : findProvider(providers, nic);
+        if (index < providers.size())
+        {
+            return {index, cached->value("match", "")};
+        }
+    }
+
     HwlocTopology topology;
     const auto [oams, hnics] = findPciDevices(*topology);
 
     if (oams.empty())
     {
         // In simulator there are no OAMs
+        cache::store(cacheKey, {{"nic", ""}, {"match", ""}});
         return {0, ""};
     }
 
@@ -425,13 +456,10 @@ std::tuple<size_t, std::string> getBestProvider(const std::vector<struct fi_info
 
     const auto        connection = connectionMatrix.at(oam).at(hnic);
     const std::string matchType  = translateHwlocType(connection->type);
+    const std::string nicName    = getOpenfabricName(hnic);
+    cache::store(cacheKey, {{"nic", nicName}, {"match", matchType}});
     // Return the index of the correct fi_info*
-    const auto index =
-        std::distance(providers.cbegin(),
-                      std::find_if(providers.cbegin(), providers.cend(), [&hnic](const fi_info* const provider) {
-                          return getOpenfabricName(hnic) == provider->nic->device_attr->name;
-                      }));
-    return {index, matchType};
+    return {findProvider(providers, nicName), matchType};
 }
 
 std::unordered_map<const struct fi_info*, std::string>
@@ -439,24 +467,88 @@ getProviderInterface(const std::vector<struct fi_info*>& providers)
 {
     VERIFY(!providers.empty(), "Providers list is empty");
 
+    std::unordered_map<const struct fi_info*, std::string> provider_interfaces;
+
+    const std::string cacheKey = providersCacheKey("interfaces", providers);
+    if (const auto cached = cache::load(cacheKey))
+    {
+        for (const struct fi_info* const provider : providers)
+        {
+            const auto it = cached->find(provider->nic->device_attr->name);
+            if (it != cached->end() && it->is_string())
+            {
+                provider_interfaces[provider] = it->get<std::string>();
+            }
+        }
+        if (provider_interfaces.size() == providers.size())
+        {
+            return provider_interfaces;
+        }
+        provider_interfaces.clear();
+    }
+
     HwlocTopology topology;
     const auto [oams, hnics] = findPciDevices(*topology);
     UNUSED(oams);
 
-    std::unordered_map<const struct fi_info*, std::string> provider_interfaces;
+    nlohmann::json interfaces = nlohmann::json::object();
     for (const struct fi_info* const provider : providers)
     {
         for (const hwloc_obj_t& hnic : hnics)
         {
             if (getOpenfabricName(hnic) == provider->nic->device_attr->name)
             {
-                provider_interfaces[provider] = getNetworkOSDevice(hnic)->name;
+                provider_interfaces[provider]                = getNetworkOSDevice(hnic)->name;
+                interfaces[provider->nic->device_attr->name] = provider_interfaces[provider];
                 break;
             }
         }
     }
+    cache::store(cacheKey, interfaces);
 
     return provider_interfaces;
 }
 
+bool bindToNumaNode(void* const addr, const size_t size, const int numaNode)
+{
+    HwlocTopology        topology;
+    const hwloc_bitmap_t nodeset = hwloc_bitmap_alloc();
+    hwloc_bitmap_only(nodeset, numaNode);
+
+    const int rc =
+        hwloc_set_area_membind(*topology, addr, size, nodeset, HWLOC_MEMBIND_BIND, HWLOC_MEMBIND_BYNODESET);
+    if (rc != 0)
+    {
+        LOG_HCL_WARN(HCL_OFI,
+                     "Failed to bind 0x{:x} size {} to NUMA node {}, errno {}",
+                     (uint64_t)addr,
+                     size,
+                     numaNode,
+                     strerror(errno));
+    }
+
+    hwloc_bitmap_free(nodeset);
+    return rc == 0;
+}
+
+std::string getNumaNodes(const void* const addr, const size_t size)
+{
+    HwlocTopology        topology;
+    const hwloc_bitmap_t nodeset = hwloc_bitmap_alloc();
+    std::string          nodes;
+
+    if (hwloc_get_area_memlocation(*topology, addr, size, nodeset, HWLOC_MEMBIND_BYNODESET) == 0)
+    {
+        char* nodesStr = nullptr;
+        if (hwloc_bitmap_list_asprintf(&nodesStr, nodeset) >= 0)
+        {
+            nodes = nodesStr;
+            free(nodesStr);
+        }
+    }
+
+    hwloc_bitmap_free(nodeset);
+    return nodes;
+}
+
 }  // namespace hl_topo
@@ -2,6 +2,7 @@
 #include <vector>         // for std::vector
 #include <string>         // for std::string
 #include <unordered_map>  // for std::unordered_map
+#include <cstddef>        // for size_t
 #include "rdma/fabric.h"  // for struct fi_info
 
 namespace hl_topo
@@ -27,4 +28,21 @@ std::tuple<size_t, std::string> getBestProvider(const std::vector<struct fi_info
 std::unordered_map<const struct fi_info*, std::string>
 getProviderInterface(const std::vector<struct fi_info*>& providers);
 
+/**
+ * @brief Bind a memory range to a NUMA node. Must be called before the pages are first touched.
+ *
+ * @param addr page aligned start of the range
+ * @param size range size
+ * @param numaNode OS index of the NUMA node
+ * @return true on success
+ */
+bool bindToNumaNode(void* addr, size_t size, int numaNode);
+
+/**
+ * @brief Find the NUMA nodes the pages of a memory range currently reside on.
+ *
+ * @return NUMA node list, such as "0" or "0-1". Empty if it can't be determined.
+ */
+std::string getNumaNodes(const void* addr, size_t size);
+
 }  // namespace hl_topo
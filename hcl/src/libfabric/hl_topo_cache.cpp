@@ -0,0 +1,146 @@
+#include "hl_topo_cache.h"
+
+#include <unistd.h>    // for getpid
+#include <hwloc.h>     // for HWLOC_API_VERSION
+#include <algorithm>   // for sort, replace_if
+#include <cctype>      // for isalnum
+#include <cstdio>      // for rename, remove
+#include <fstream>     // for ifstream, ofstream
+#include <functional>  // for hash
+#include <vector>      // for vector
+#include "hcl_global_conf.h"  // for GCFG_HCL_TOPOLOGY_CACHE_DIR
+#include "hcl_utils.h"        // for LOG_HCL_*
+#include "hcl_log_manager.h"  // for LOG_*
+#if !defined __GNUC__ || __GNUC__ >= 8
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+
+using json = nlohmann::json;
+
+namespace hl_topo
+{
+namespace cache
+{
+
+// Bump when the cached entries change meaning
+static constexpr unsigned CACHE_FORMAT_VERSION = 2;
+
+static std::string readFirstLine(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string   line;
+    std::getline(file, line);
+    return line;
+}
+
+// "name=pci path" of every device of a sysfs class, sorted
+static void addClassDevices(const std::string& classPath, std::string& state)
+{
+    std::error_code ec;
+    if (!fs::is_directory(classPath, ec))
+    {
+        return;
+    }
+
+    std::vector<std::string> devices;
+    for (const auto& entry : fs::directory_iterator(classPath, ec))
+    {
+        const fs::path device = fs::canonical(entry.path(), ec);
+        devices.push_back(entry.path().filename().string() + "=" + (ec ? std::string() : device.string()));
+    }
+    std::sort(devices.begin(), devices.end());
+
+    for (const std::string& device : devices)
+    {
+        state += device + ";";
+    }
+}
+
+static const std::string& fingerprint()
+{
+    static const std::string s_fingerprint = []() {
+        std::string state = fmt::format("v{};hwloc={:x};", CACHE_FORMAT_VERSION, HWLOC_API_VERSION);
+        state += "boot=" + readFirstLine("/proc/sys/kernel/random/boot_id") + ";";
+        state += "driver=" + readFirstLine("/sys/module/habanalabs/version") + ";";
+        addClassDevices("/sys/class/accel", state);
+        addClassDevices("/sys/class/infiniband", state);
+        addClassDevices("/sys/class/net", state);
+        return fmt::format("{:016x}", std::hash<std::string> {}(state));
+    }();
+    return s_fingerprint;
+}
+
+static std::string cacheFileName(const std::string& key)
+{
+    // Keys hold characters such as ':', keep the file names portable. The key is also stored in the file, so keys
+    // that map to the same name can't be confused.
+    std::string name = key;
+    std::replace_if(
+        name.begin(),
+        name.end(),
+        [](const char c) { return !std::isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '.'; },
+        '_');
+    return GCFG_HCL_TOPOLOGY_CACHE_DIR.value() + "/hcl_topo_" + fingerprint() + "_" + name + ".json";
+}
+
+std::optional<json> load(const std::string& key)
+{
+    if (GCFG_HCL_TOPOLOGY_CACHE_DIR.value().empty())
+    {
+        return std::nullopt;
+    }
+
+    const std::string fileName = cacheFileName(key);
+    std::ifstream     file(fileName);
+    if (!file.good())
+    {
+        LOG_HCL_DEBUG(HCL_OFI, "Topology cache miss, key={}, file={}", key, fileName);
+        return std::nullopt;
+    }
+
+    const json content = json::parse(file, nullptr, false);
+    if (!content.is_object() || content.value("fingerprint", "") != fingerprint() || content.value("key", "") != key ||
+        !content.contains("value"))
+    {
+        LOG_HCL_WARN(HCL_OFI, "Ignoring invalid topology cache file {}", fileName);
+        return std::nullopt;
+    }
+
+    LOG_HCL_DEBUG(HCL_OFI, "Topology cache hit, key={}, file={}", key, fileName);
+    return content["value"];
+}
+
+void store(const std::string& key, const json& value)
+{
+    if (GCFG_HCL_TOPOLOGY_CACHE_DIR.value().empty())
+    {
+        return;
+    }
+
+    const std::string fileName    = cacheFileName(key);
+    const std::string tmpFileName = fileName + "." + std::to_string(getpid());
+    {
+        std::ofstream file(tmpFileName);
+        if (!file.good())
+        {
+            LOG_HCL_WARN(HCL_OFI, "Failed to write topology cache file {}", tmpFileName);
+            return;
+        }
+        file << json {{"fingerprint", fingerprint()}, {"key", key}, {"value", value}}.dump();
+    }
+
+    if (std::rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+    {
+        LOG_HCL_WARN(HCL_OFI, "Failed to rename topology cache file {}, errno {}", tmpFileName, strerror(errno));
+        std::remove(tmpFileName.c_str());
+        return;
+    }
+    LOG_HCL_DEBUG(HCL_OFI, "Topology cache stored, key={}, file={}", key, fileName);
+}
+
+}  // namespace cache
+}  // namespace hl_topo
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>           // for optional
+#include <string>             // for string
+#include <nlohmann/json.hpp>  // for json
+
+namespace hl_topo
+{
+
+/**
+ * @brief On-disk cache of host topology discovery results, enabled by HCL_TOPOLOGY_CACHE_DIR.
+ *
+ * All processes of a node match their Gaudi against the same host NICs, which requires loading the whole hwloc
+ * topology including PCI. Each result is stored in its own <dir>/hcl_topo_<fingerprint>_<key>.json, so the processes of
+ * a node starting together don't overwrite each other's keys. The fingerprint covers
+ * the boot, the accel, infiniband and net devices and their PCI paths, and the driver version. It is computed from a
+ * few sysfs entries only, so a stale cache is never used and a valid one is found without touching hwloc.
+ */
+namespace cache
+{
+
+/**
+ * @brief Cached value of key, if the cache is enabled and holds one for the current fingerprint.
+ */
+std::optional<nlohmann::json> load(const std::string& key);
+
+/**
+ * @brief Store value of key. The file of the key is replaced atomically, so concurrent processes never read a partial
+ * file; processes storing the same key store the same value.
+ */
+void store(const std::string& key, const nlohmann::json& value);
+
+}  // namespace cache
+}  // namespace hl_topo
@@ -405,7 +405,8 @@ void ContextManager::serializeMultipleQPsUpdateScaleUp(
     [[maybe_unused]] unsigned&                                     commDescIndex,
     [[maybe_unused]] bool                                          isScaleup)
 {
-    NicsDwordsArray buffer;
+    NicsDwordsArray     buffer;
+    hcl::ScalStreamBase tmp;  // reused, so the staging buffer is only allocated once
 
     for (auto& kvPair : commDescWithQPs)
     {
@@ -413,8 +414,7 @@ void ContextManager::serializeMultipleQPsUpdateScaleUp(
         unsigned              qpn         = kvPair.first.second;
         std::vector<uint8_t>& nics        = kvPair.second;
 
-        hcl::ScalStreamBase tmp;
-        ContextValues       contextValues = {};
+        ContextValues contextValues = {};
         updateDWord(contextValues, DW_COMM_QP, qpn);
         SchedArcCommandsGaudi2::serializeUpdateCollectiveContextCommand(tmp,
                                                                         isSend,
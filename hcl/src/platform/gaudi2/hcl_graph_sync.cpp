@@ -1,14 +1,15 @@
 #include "platform/gaudi2/hcl_graph_sync.h"
 
-#include <cstddef>                                            // for offsetof
-#include "gaudi2/asic_reg/gaudi2_blocks.h"                    // for mmDCORE...
-#include "gaudi2/asic_reg_structs/sob_objs_regs.h"            // for block_s...
-#include "hcl_utils.h"                                        // for VERIFY
-#include "infra/scal/gen2_arch_common/scal_stream.h"          // for ScalStream
-#include "infra/scal/gen2_arch_common/scal_utils.h"           // for varoffs...
-#include "infra/scal/gaudi2/scal_utils.h"                     // for Gaudi2HclScalU...
-#include "platform/gen2_arch_common/commands/hcl_commands.h"  // for HclComm...
-#include "g2_sched_pkts.h"                                    // for g2fw
+#include <cstddef>                                               // for offsetof
+#include "gaudi2/asic_reg/gaudi2_blocks.h"                       // for mmDCORE...
+#include "gaudi2/asic_reg_structs/sob_objs_regs.h"               // for block_s...
+#include "hcl_utils.h"                                           // for VERIFY
+#include "infra/scal/gen2_arch_common/scal_stream.h"             // for ScalStream
+#include "infra/scal/gen2_arch_common/scal_utils.h"              // for varoffs...
+#include "infra/scal/gaudi2/scal_utils.h"                        // for Gaudi2HclScalU...
+#include "platform/gen2_arch_common/commands/hcl_commands.h"     // for HclComm...
+#include "platform/gen2_arch_common/hcl_lbw_write_aggregator.h"  // for HclLbwWriteAggregator
+#include "g2_sched_pkts.h"                                       // for g2fw
 
 HclGraphSyncGaudi2::HclGraphSyncGaudi2(unsigned syncSmIdx, HclCommandsGen2Arch& commands)
 : HclGraphSyncGen2Arch(syncSmIdx, commands)
@@ -136,33 +137,29 @@ uint32_t HclGraphSyncGaudi2::getSoConfigValue(unsigned value, bool isReduction)
     return soConfigMsg._raw;
 }
 
-void HclGraphSyncGaudi2::createSetupMonMessages(hcl::ScalStream& scalStream,
-                                                uint64_t         address,
-                                                unsigned         fenceIdx,
-                                                unsigned         monitorIdx,
-                                                uint64_t         smBase,
-                                                bool             isLong)
+void HclGraphSyncGaudi2::createSetupMonMessages(HclLbwWriteAggregator& aggregator,
+                                                uint64_t               address,
+                                                unsigned               fenceIdx,
+                                                unsigned               monitorIdx,
+                                                uint64_t               smBase,
+                                                bool                   isLong)
 {
-    HclGraphSyncGen2Arch::createSetupMonMessages(scalStream, address, fenceIdx, monitorIdx, smBase, isLong);
+    HclGraphSyncGen2Arch::createSetupMonMessages(aggregator, address, fenceIdx, monitorIdx, smBase, isLong);
 
-    unsigned schedIdx = scalStream.getSchedIdx();
     if (isLong)
     {
-        LBWBurstData_t destData;
         // 2nd dummy message to DCORE0_SYNC_MNGR_OBJS SOB_OBJ_8184
         uint64_t address2 = offsetof(gaudi2::block_sob_objs, sob_obj[8184]) + smBase;
         // Setup to payload address (of dummy SOB)
 
         uint32_t destination = varoffsetof(gaudi2::block_sob_objs, mon_pay_addrl[monitorIdx + 1]) + smBase;
-        destData.push_back({destination, (uint32_t)address2 & 0xffffffff});
+        aggregator.aggregate(destination, (uint32_t)address2 & 0xffffffff);
 
         destination = varoffsetof(gaudi2::block_sob_objs, mon_pay_addrh[monitorIdx + 1]) + smBase;
-        destData.push_back({destination, (uint32_t)((address2 >> 32) & 0xffffffff)});
+        aggregator.aggregate(destination, (uint32_t)((address2 >> 32) & 0xffffffff));
 
         // Create a dummy data that would be written to SOB_OBJ_8184
         destination = varoffsetof(gaudi2::block_sob_objs, mon_pay_data[monitorIdx + 1]) + smBase;
-        destData.push_back({destination, 0});
-
-        m_commands.serializeLbwBurstWriteCommand(scalStream, schedIdx, destData);
+        aggregator.aggregate(destination, 0);
     }
 }
@@ -38,10 +38,10 @@ private:
                                   int            i,
                                   bool           useEqual) override;
     virtual uint32_t createSchedMonExpFence(unsigned fenceIdx) override;
-    virtual void     createSetupMonMessages(hcl::ScalStream& scalStream,
-                                            uint64_t         address,
-                                            unsigned         fenceIdx,
-                                            unsigned         monitorIdx,
-                                            uint64_t         smBase,
-                                            bool             isLong) override;
+    virtual void     createSetupMonMessages(HclLbwWriteAggregator& aggregator,
+                                            uint64_t               address,
+                                            unsigned               fenceIdx,
+                                            unsigned               monitorIdx,
+                                            uint64_t               smBase,
+                                            bool                   isLong) override;
 };
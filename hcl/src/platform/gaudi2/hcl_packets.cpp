@@ -390,10 +390,9 @@ void SchedArcCommandsGaudi2::serializeDmaCommand(hcl::ScalStreamBase& scalStream
         SET_FIELD(edma_ops->dst_addr_hi, (destAddress >> 32));
         SET_FIELD(edma_ops->src_addr_lo, (srcAddress & 0xffffffff));
         SET_FIELD(edma_ops->src_addr_hi, ((srcAddress >> 32) & 0xffffff));
-        SET_FIELD(edma_ops->local_datasize, (is16BitMemcpy ? 1 : 2));  // 16bit / 32bit
-        SET_FIELD(edma_ops->sibo_datasize, (is16BitMemcpy ? 1 : 2));   // 16bit / 32bit
-        SET_FIELD(edma_ops->output_datasize,
-                  (((is16BitMemcpy && !useCasting) || (!is16BitMemcpy && useCasting)) ? 1 : 2));
+        SET_FIELD(edma_ops->local_datasize, getEdmaDataSize(dataType, is16BitMemcpy));
+        SET_FIELD(edma_ops->sibo_datasize, getEdmaDataSize(dataType, is16BitMemcpy));
+        SET_FIELD(edma_ops->output_datasize, getEdmaDataSize(dataType, is16BitMemcpy != useCasting));
         SET_FIELD(edma_ops->dtype, get_nic_edma_dtype(dataType, is16BitMemcpy, useCasting, isBFloat));
         SET_FIELD(edma_ops->reduction_ind, 1);
         SET_FIELD(edma_ops->context_id, streamCtxtID);
@@ -460,9 +459,8 @@ void SchedArcCommandsGaudi2::serializeDmaCommand(hcl::ScalStreamBase& scalStream
         SET_FIELD(edma_ops->dst_addr_hi, (destAddress >> 32));
         SET_FIELD(edma_ops->src_addr_lo, (srcAddress & 0xffffffff));
         SET_FIELD(edma_ops->src_addr_hi, ((srcAddress >> 32) & 0xffffff));
-        SET_FIELD(edma_ops->input_datasize, (is16BitMemcpy ? 1 : 2));  // 16bit / 32bit
-        SET_FIELD(edma_ops->output_datasize,
-                  (((is16BitMemcpy && !useCasting) || (!is16BitMemcpy && useCasting)) ? 1 : 2));  // 16bit / 32bit
+        SET_FIELD(edma_ops->input_datasize, getEdmaDataSize(dataType, is16BitMemcpy));
+        SET_FIELD(edma_ops->output_datasize, getEdmaDataSize(dataType, is16BitMemcpy != useCasting));
         SET_FIELD(edma_ops->dtype, get_nic_edma_dtype(dataType, is16BitMemcpy, useCasting, isBFloat));
         SET_FIELD(edma_ops->reduction_ind, (useReductionInd ? 1 : 0));
         SET_FIELD(edma_ops->context_id, streamCtxtID);
@@ -32,7 +32,8 @@ void SimbPoolContainerAllocatorGaudi2::init()
     else
     {
         poolTypes[SIBO_DOUBLE_SIMB_SIZE].push_back(SCALEOUT_POOL);
-        if (GCFG_HCCL_GAUDI_DIRECT.value())
+        // the hybrid scaleout path runs the gaudi-direct flow for large collectives
+        if (GCFG_HCCL_GAUDI_DIRECT.value() || GCFG_HCL_HNIC_HYBRID_PATH.value())
         {
             poolTypes[SIBO_STANDARD_SIMB_SIZE].push_back(SCALEOUT_GDR_POOL);
         }
@@ -89,4 +90,5 @@ void SimbPoolContainerAllocatorGaudi2::init()
     }
 
     allocateFwIntermediateBuffer();
+    allocateFusionBuffers();
 }
\ No newline at end of file
@@ -879,9 +879,9 @@ void HclDeviceGaudi3::migrateQPs(const HCL_Comm comm)
 
 void HclDeviceGaudi3::reportCommNicStatus(const uint16_t port, const bool up)
 {
-    // if comm init rank in progress, wait until it is completed (new communicator added to
+    // if comm init ranks are in progress, wait until they are completed (new communicators added to
     // m_faultToleranceScaleoutComms )
-    locker_t locker(hccl_ctx.comm_init_lock());
+    std::unique_lock<std::shared_mutex> locker(hccl_ctx.comm_init_lock());
 
     HLFT_INF("port={} is {}", port, up ? "up" : "shutdown");
     m_failedScaleOutPortsMask[port] = !up;
@@ -922,7 +922,7 @@ const eIbvNicPhysicalState HclDeviceGaudi3::getNicPhysicalState(const uint32_t n
     return g_ibv.get_nic_phys_state(nic);
 }
 
-extern std::unordered_map<HCL_Comm, spHcclCoordinatorClient> g_hcclCordClient;
+spHcclCoordinatorClient getHcclCordClient(const HCL_Comm comm);
 
 void HclDeviceGaudi3::updateMigrationQpsToRts(const CommIds& commIds)
 {
@@ -931,7 +931,7 @@ void HclDeviceGaudi3::updateMigrationQpsToRts(const CommIds& commIds)
     HLFT_COMM_HDR_INF("mQP moved to RTR", commIds);
     setMigrationQPsRTS(commIds.commId);
     HLFT_COMM_HDR_INF("moved mQP to RTS", commIds);
-    g_hcclCordClient[commIds.commId]->rendezvous();
+    getHcclCordClient(commIds.commId)->rendezvous();
     HLFT_COMM_HDR_INF("rendezvous done", commIds);
     migrateQPs(commIds.commId);
     HLFT_COMM_HDR_INF("QP migration done", commIds);
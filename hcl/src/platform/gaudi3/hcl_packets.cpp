@@ -1098,12 +1098,10 @@ void serializeDmaCommand(hcl::ScalStreamBase&            scalStream,
         SET_FIELD(edma_ops->dst_addr_hi, destAddress >> 32);
         SET_FIELD(edma_ops->src_addr_lo, srcAddress & 0xffffffff);
         SET_FIELD(edma_ops->src_addr_hi, (srcAddress >> 32) & 0xffffff);
-        SET_FIELD(edma_ops->local_datasize, isWideAccumulation ? 1 : (is16BitMemcpy ? 1 : 2));  // 16bit / 32bit
-        SET_FIELD(edma_ops->sibo_datasize, isWideAccumulation ? 2 : (is16BitMemcpy ? 1 : 2));   // 16bit / 32bit
+        SET_FIELD(edma_ops->local_datasize, isWideAccumulation ? 1 : getEdmaDataSize(dataType, is16BitMemcpy));
+        SET_FIELD(edma_ops->sibo_datasize, isWideAccumulation ? 2 : getEdmaDataSize(dataType, is16BitMemcpy));
         SET_FIELD(edma_ops->output_datasize,
-                  isWideAccumulation
-                      ? 2
-                      : (((is16BitMemcpy && !useCasting) || (!is16BitMemcpy && useCasting)) ? 1 : 2));  // 16bit / 32bit
+                  isWideAccumulation ? 2 : getEdmaDataSize(dataType, is16BitMemcpy != useCasting));
         SET_FIELD(edma_ops->local_hbw_axcache, DEFAULT_CACHE_ALLOC);
         SET_FIELD(edma_ops->local_class_type, DEFAULT_CACHE_CLASS);
         SET_FIELD(edma_ops->output_hbw_axcache, DEFAULT_CACHE_ALLOC);
@@ -1179,9 +1177,8 @@ void serializeDmaCommand(hcl::ScalStreamBase&            scalStream,
         SET_FIELD(edma_ops->dst_addr_hi, destAddress >> 32);
         SET_FIELD(edma_ops->src_addr_lo, srcAddress & 0xffffffff);
         SET_FIELD(edma_ops->src_addr_hi, (srcAddress >> 32) & 0xffffff);
-        SET_FIELD(edma_ops->input_datasize, is16BitMemcpy ? 1 : 2);  // 16bit / 32bit
-        SET_FIELD(edma_ops->output_datasize,
-                  (is16BitMemcpy && !useCasting) || (!is16BitMemcpy && useCasting) ? 1 : 2);            // 16bit / 32bit
+        SET_FIELD(edma_ops->input_datasize, getEdmaDataSize(dataType, is16BitMemcpy));
+        SET_FIELD(edma_ops->output_datasize, getEdmaDataSize(dataType, is16BitMemcpy != useCasting));
         SET_FIELD(edma_ops->dtype, get_nic_edma_dtype(dataType, is16BitMemcpy, useCasting, isBFloat));  // BF / FP
         SET_FIELD(edma_ops->reduction_ind, useReductionInd ? 1 : 0);
         SET_FIELD(edma_ops->context_id, streamCtxtID);
@@ -1273,7 +1270,7 @@ void serializePdmaCommand(hcl::ScalStreamBase&            scalStream,
                           uint8_t                         apiId,
                           [[maybe_unused]] unsigned       streamIndex,
                           uint8_t                         streamCtxtID,
-                          [[maybe_unused]] hcclDataType_t dataType,
+                          hcclDataType_t                  dataType,
                           uint32_t                        sobAddr)
 {
     static const unsigned opcodes[(unsigned)hcl::SchedulersIndex::count] = {
@@ -1317,7 +1314,10 @@ void serializePdmaCommand(hcl::ScalStreamBase&            scalStream,
     SET_FIELD(command->reduction_ind, isReduction);
     reduction_operation_e reductionOp = isReduction ? getReductionOp(reduceOp) : REDUCTION_OP_NONE;
     SET_FIELD(command->reduction_op, reductionOp);
-    SET_FIELD(command->reduction_dtype, isCastUp ? REDUCTION_UPSCALING_BF16 : REDUCTION_FP32);
+    // floats are reduced in fp32 (16-bit ones are cast up), integers in their own type
+    const bool isFloat = dataType == hcclFloat32 || dataType == hcclBfloat16 || dataType == hcclFloat16;
+    SET_FIELD(command->reduction_dtype,
+              isCastUp ? REDUCTION_UPSCALING_BF16 : (isFloat ? REDUCTION_FP32 : getReductionDataType(false, dataType)));
     SET_FIELD(command->pay_data, 0x80000001);
     SET_FIELD(command->pay_addr, sobAddr);  // should also indicate 4 bit for cg index
     SET_FIELD(command->batch_params->transfer_size, size);
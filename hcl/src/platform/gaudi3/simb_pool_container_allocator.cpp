@@ -34,7 +34,8 @@ void SimbPoolContainerAllocatorGaudi3::init()
     else
     {
         poolTypes[SIBO_DOUBLE_SIMB_SIZE].push_back(SCALEOUT_POOL);
-        if (GCFG_HCCL_GAUDI_DIRECT.value())
+        // the hybrid scaleout path runs the gaudi-direct flow for large collectives
+        if (GCFG_HCCL_GAUDI_DIRECT.value() || GCFG_HCL_HNIC_HYBRID_PATH.value())
         {
             poolTypes[NON_SIBO_STANDARD_SIMB_SIZE].push_back(SCALEOUT_GDR_POOL);
         }
@@ -113,4 +114,5 @@ void SimbPoolContainerAllocatorGaudi3::init()
     }
 
     allocateFwIntermediateBuffer();
+    allocateFusionBuffers();
 }
\ No newline at end of file
@@ -37,8 +37,8 @@ void ActiveStreamManagerGen2Arch::initializeActiveStreams(CommonState& commonSta
     bool isHierarchicalSelfBox =
         (boxNum == m_commonState->m_dynamicComm.getMyScaleupGroup() && m_commonState->m_isMultiScaleupGroup);
     bool reductionRS = (m_commonState->m_currentOp == eHCLReduceScatter) && (!isHierarchicalSelfBox);
-    bool isLastBox =
-        (getNextBox(boxNum, m_commonState->m_boxIterations) == m_commonState->m_dynamicComm.getMyScaleupGroup());
+    bool isLastBox   = (m_commonState->m_dynamicComm.getNextRingBox(boxNum, m_commonState->m_boxIterations) ==
+                      m_commonState->m_dynamicComm.getMyScaleupGroup());
     bool isFirstBox = boxNum == m_commonState->m_dynamicComm.getMyScaleupGroup();
 
     for (unsigned sched = 0; sched < hcl::SchedulersIndex::count; sched++)
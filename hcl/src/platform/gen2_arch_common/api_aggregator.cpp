@@ -26,6 +26,28 @@ ApiAggregatorGen2Arch::ApiAggregatorGen2Arch(HclCollectiveRoutinesGen2Arch* coll
     }
 }
 
+void ApiAggregatorGen2Arch::ranks_t::insert(const HCL_Rank rank, const uint32_t commSize)
+{
+    if (unlikely(rank >= isSet.size()))
+    {
+        isSet.resize(std::max(commSize, rank + 1), false);
+    }
+    if (!isSet[rank])
+    {
+        isSet[rank] = true;
+        ranks.push_back(rank);
+    }
+}
+
+void ApiAggregatorGen2Arch::ranks_t::clear()
+{
+    for (const HCL_Rank rank : ranks)
+    {
+        isSet[rank] = false;
+    }
+    ranks.clear();
+}
+
 hcclResult_t ApiAggregatorGen2Arch::addGroupStart()
 {
     m_collectiveRoutines->setGroupContext(true);
@@ -50,7 +72,7 @@ hcclResult_t ApiAggregatorGen2Arch::onGroupEnd()
         m_collectiveRoutines->sendRecv(m_groupCalls[comm],
                                        m_sendRecvMemCpyVec,
                                        comm,
-                                       m_remoteRanks[comm],
+                                       m_remoteRanks[comm].ranks,
                                        hccl_ctx.generateApiId());
 
         LOG_HCL_TRACE(HCL, "Finished comm={}", comm);
@@ -104,7 +126,10 @@ uint64_t ApiAggregatorGen2Arch::checkGroupCollectiveDependency()
     // handle all collective calls next
     for (HclCollectiveParams& params : m_collectiveStack)
     {
-        auto&&      device = m_collectiveRoutines->getDevice();
+        auto&& device = m_collectiveRoutines->getDevice();
+        // same scaleout path as the call will take, see hclCollectiveCall
+        const ScaleoutProvider::PathScope scaleoutPath(*device->getScaleOutProvider(), params);
+
         CommonState commonState {
             params,
             m_collectiveRoutines->getDeviceSimbPoolManager(),
@@ -119,10 +144,179 @@ uint64_t ApiAggregatorGen2Arch::checkGroupCollectiveDependency()
         retTargetVal  = std::max(retTargetVal, tempTargetVal);
     }
 
+    // fused collectives read and write the user buffers in their gather / scatter copies
+    for (const fusion_t& fusion : m_collectiveFusions)
+    {
+        for (const memcpy_calls_t* copies : {&fusion.gather, &fusion.scatter})
+        {
+            for (const SendRecvMemCopyEntry& copy : *copies)
+            {
+                const uint64_t size = copy.chunkCount * dataTypeSizeInBytes(copy.dataType);
+
+                tempTargetVal = m_collectiveRoutines->checkSendRecvDependency(copy.sendBaseAddress,
+                                                                              size,
+                                                                              nextTargetVal,
+                                                                              true,
+                                                                              false);
+                retTargetVal  = std::max(retTargetVal, tempTargetVal);
+                tempTargetVal = m_collectiveRoutines->checkSendRecvDependency(copy.recvBaseAddress,
+                                                                              size,
+                                                                              nextTargetVal,
+                                                                              false,
+                                                                              false);
+                retTargetVal  = std::max(retTargetVal, tempTargetVal);
+            }
+        }
+    }
+
     m_collectiveRoutines->setGroupMaxTargetValue(retTargetVal);
     return retTargetVal;
 }
 
+bool ApiAggregatorGen2Arch::isFusionEnabled() const
+{
+    // Group ops are weakly ordered unless fusion requests strong order, which HABANA_WEAK_ORDER overrides, and fault
+    // tolerance replays collectives by their API counters, so both are left unfused
+    return GCFG_HCL_GROUP_FUSION.value() && !GCFG_WEAK_ORDER.value() && !GCFG_HCL_FAULT_TOLERANCE_ENABLE.value();
+}
+
+bool ApiAggregatorGen2Arch::isFusible(const HclCollectiveParams& params) const
+{
+    return params.m_collectiveOp == eHCLAllReduce && params.m_count > 0 &&
+           params.m_count * dataTypeSizeInBytes(params.m_dataType) <= GCFG_HCL_GROUP_FUSION_THRESHOLD.value();
+}
+
+/**
+ * @brief Replace the small AllReduce calls of the group that share comm, data type, reduction op and flags by a single
+ * in place AllReduce over the stream staging buffer. The fused collective runs at the position of its first call.
+ * Since all ranks of a comm issue the same collectives in a group, all of them fuse the same way.
+ * Ops of a group aren't ordered against each other, so every fusion of the group gets its own slice of the staging
+ * buffer, and calls that no longer fit in it are left unfused.
+ */
+void ApiAggregatorGen2Arch::fuseCollectives()
+{
+    m_collectiveFusions.assign(m_collectiveStack.size(), fusion_t());
+    if (m_collectiveStack.size() < 2 || !isFusionEnabled())
+    {
+        return;
+    }
+
+    const SimbPoolContainerAllocator& allocator   = *m_collectiveRoutines->getDevice()->m_sibContainerManager;
+    const uint32_t                    streamId    = m_collectiveRoutines->getArchStream();
+    const uint64_t                    stagingAddr = allocator.getFusionBufferAddr(streamId);
+    const uint64_t                    stagingSize = allocator.getFusionBufferSize();
+
+    collective_calls_t fusedStack;
+    fusion_calls_t     fusions;
+    std::vector<bool>  isFused(m_collectiveStack.size(), false);
+    uint64_t           stagingUsed = 0;  // bytes of the staging buffer taken by earlier fusions of the group
+    for (size_t first = 0; first < m_collectiveStack.size(); first++)
+    {
+        if (isFused[first])
+        {
+            continue;
+        }
+
+        const HclCollectiveParams& firstParams = m_collectiveStack[first];
+        std::vector<size_t>        members     = {first};
+        uint64_t                   count       = firstParams.m_count;
+        if (isFusible(firstParams))
+        {
+            const uint64_t typeSize = dataTypeSizeInBytes(firstParams.m_dataType);
+            for (size_t next = first + 1; next < m_collectiveStack.size(); next++)
+            {
+                const HclCollectiveParams& params = m_collectiveStack[next];
+                if (isFused[next] || !isFusible(params) || params.m_comm != firstParams.m_comm ||
+                    params.m_dataType != firstParams.m_dataType || params.m_reduceOp != firstParams.m_reduceOp ||
+                    params.m_userFlags != firstParams.m_userFlags)
+                {
+                    continue;
+                }
+                if (stagingUsed + (count + params.m_count) * typeSize > stagingSize)
+                {
+                    break;
+                }
+                members.push_back(next);
+                count += params.m_count;
+            }
+        }
+
+        if (members.size() == 1)
+        {
+            fusedStack.push_back(firstParams);
+            fusions.emplace_back();
+            continue;
+        }
+
+        fusion_t       fusion;
+        const uint64_t fusionAddr    = stagingAddr + stagingUsed;
+        uint64_t       stagingOffset = fusionAddr;
+        for (const size_t member : members)
+        {
+            const HclCollectiveParams& params = m_collectiveStack[member];
+            fusion.gather.push_back({params.m_count, params.m_dataType, stagingOffset, params.m_sendBufferAddr});
+            fusion.scatter.push_back({params.m_count, params.m_dataType, params.m_recvBufferAddr, stagingOffset});
+            stagingOffset += params.m_count * dataTypeSizeInBytes(params.m_dataType);
+            isFused[member] = true;
+        }
+        stagingUsed = stagingOffset - stagingAddr;
+
+        HclCollectiveParams fusedParams(firstParams);
+        fusedParams.m_sendBufferAddr = fusionAddr;
+        fusedParams.m_recvBufferAddr = fusionAddr;
+        fusedParams.m_count          = count;
+        LOG_HCL_DEBUG(HCL,
+                      "Fused {} AllReduce calls of comm {} into one, count={}, dataType={}",
+                      members.size(),
+                      fusedParams.m_comm,
+                      count,
+                      fusedParams.m_dataType);
+
+        fusedStack.push_back(fusedParams);
+        fusions.push_back(std::move(fusion));
+    }
+
+    m_collectiveStack.swap(fusedStack);
+    m_collectiveFusions.swap(fusions);
+}
+
+hcclResult_t ApiAggregatorGen2Arch::runFusedCollective(HclCollectiveParams& params, fusion_t& fusion)
+{
+    // The gather and scatter copies run as send/recv calls without remote ranks. Ops after the first of a group are
+    // weakly ordered and the group skips the per-op dependency wait, so the fused collective and the scatter request
+    // strong order to wait for the gather and the fused collective respectively
+    const RanksVector      noRemoteRanks;
+    hcl::GroupCallsBuckets gatherCalls;
+    hcclResult_t           rc = m_collectiveRoutines->sendRecv(gatherCalls,
+                                                               fusion.gather,
+                                                               params.m_comm,
+                                                               noRemoteRanks,
+                                                               hccl_ctx.generateApiId(),
+                                                               FUSION_MEMCPYS_PER_ITER);
+    if (rc != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "Gather of fused collective of comm {} failed", params.m_comm);
+        return rc;
+    }
+
+    m_collectiveRoutines->requestStrongOrder();
+    rc = m_collectiveRoutines->hclCollectiveCall(params);
+    if (rc != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "Fused collective of comm {} failed", params.m_comm);
+        return rc;
+    }
+
+    hcl::GroupCallsBuckets scatterCalls;
+    m_collectiveRoutines->requestStrongOrder();
+    return m_collectiveRoutines->sendRecv(scatterCalls,
+                                          fusion.scatter,
+                                          params.m_comm,
+                                          noRemoteRanks,
+                                          hccl_ctx.generateApiId(),
+                                          FUSION_MEMCPYS_PER_ITER);
+}
+
 SendRecvApiEntries ApiAggregatorGen2Arch::createScaleoutExpandedVector(const SendRecvApiEntry& entry) const
 {
     SendRecvApiEntries result;
@@ -258,7 +452,7 @@ hcclResult_t ApiAggregatorGen2Arch::addSendRecvApiCall(HCL_Rank myRank, const Se
     {
         LOG_HCL_TRACE(HCL, "addSendRecvApiCall to m_sendRecvStack");
         m_sendRecvStack.push_back(entry);
-        m_remoteRanks[entry.comm].insert(entry.remoteRank);
+        m_remoteRanks[entry.comm].insert(entry.remoteRank, hccl_device()->getComm(entry.comm).getCommSize());
     }
 
     LOG_HCL_TRACE(HCL, "calling addGroupEnd2");
@@ -328,6 +522,7 @@ hcclResult_t ApiAggregatorGen2Arch::addGroupEnd(const bool firstStream)
         return hcclSuccess;
     }
 
+    fuseCollectives();
     checkGroupCollectiveDependency();
 
     // handle all send-recv calls first
@@ -343,8 +538,17 @@ hcclResult_t ApiAggregatorGen2Arch::addGroupEnd(const bool firstStream)
     while (m_collectiveStack.size())
     {
         HclCollectiveParams& params = m_collectiveStack.front();
-        m_collectiveRoutines->hclCollectiveCall(params);
+        fusion_t&            fusion = m_collectiveFusions.front();
+        if (fusion.gather.empty())
+        {
+            m_collectiveRoutines->hclCollectiveCall(params);
+        }
+        else
+        {
+            runFusedCollective(params, fusion);
+        }
         m_collectiveStack.pop_front();
+        m_collectiveFusions.pop_front();
     }
 
     onGroupEnd();  // Process send/recv
@@ -352,7 +556,10 @@ hcclResult_t ApiAggregatorGen2Arch::addGroupEnd(const bool firstStream)
     m_calls = 0;
 
     m_comms.clear();
-    m_remoteRanks.clear();
+    for (auto& [comm, remoteRanks] : m_remoteRanks)
+    {
+        remoteRanks.clear();
+    }
 
     return hcclSuccess;
 }
@@ -1,7 +1,7 @@
 #pragma once
 
+#include <array>                                     // for array
 #include <cstdint>                                   // for uint64_t
-#include <map>                                       // for map
 #include <deque>                                     // for deque
 #include <vector>                                    // for vector
 #include "group_calls.h"                             // for GroupCalls
@@ -15,20 +15,41 @@ class HclCollectiveRoutinesGen2Arch;
 
 constexpr auto MAX_AGG_OPS = 1024;
 
+// Gather / scatter copies of a fused collective issued per send/recv iteration
+constexpr unsigned FUSION_MEMCPYS_PER_ITER = 64;
+
 using SendRecvApiEntries = std::vector<SendRecvApiEntry>;
 
 class ApiAggregatorGen2Arch
 {
+    // Remote ranks of a comm in the current group. The bitmap over the comm ranks dedups in O(1) and is kept across
+    // groups, so only the ranks list is walked on group end.
+    struct ranks_t
+    {
+        std::vector<bool> isSet;
+        RanksVector       ranks;
+
+        void insert(HCL_Rank rank, uint32_t commSize);
+        void clear();
+    };
+
     using IndexedGroupCalls  = std::unordered_map<hcl::SchedulersIndex, hcl::GroupCalls>;
     using sendrecv_calls_t   = std::deque<SendRecvApiEntry>;
     using collective_calls_t = std::deque<HclCollectiveParams>;
-    using type_sendrecv_map  = std::map<ApiType, sendrecv_calls_t>;
+    using type_sendrecv_map  = std::array<sendrecv_calls_t, ApiType::CollectiveOp>;  // indexed by Send / Recv
     using comms_t            = std::unordered_set<HCL_Comm>;
-    using ranks_t            = std::set<HCL_Rank>;
     using comm_ranks_t       = std::unordered_map<HCL_Comm, ranks_t>;
     using comm_groupcall_map = std::unordered_map<HCL_Comm, IndexedGroupCalls>;
     using memcpy_calls_t     = std::vector<SendRecvMemCopyEntry>;
 
+    // Copies around a fused collective of the group, both empty for a collective that isn't fused
+    struct fusion_t
+    {
+        memcpy_calls_t gather;   // user send buffers -> staging buffer
+        memcpy_calls_t scatter;  // staging buffer -> user recv buffers
+    };
+    using fusion_calls_t = std::deque<fusion_t>;
+
 public:
     ApiAggregatorGen2Arch(HclCollectiveRoutinesGen2Arch* collectiveRoutines);
     virtual ~ApiAggregatorGen2Arch() = default;
@@ -37,6 +58,7 @@ public:
     hcclResult_t addCollectiveApiCall(HclCollectiveParams& params);
     hcclResult_t addGroupStart();
     hcclResult_t addGroupEnd(const bool firstStream = true);
+    bool         isInGroup() const { return m_counter > 0; }
 
 protected:
     void onHandleSendRecvEntry(SendRecvApiEntry& entry);
@@ -46,6 +68,11 @@ protected:
     uint64_t     checkGroupCollectiveDependency();
     hcclResult_t onGroupEnd();
 
+    bool         isFusionEnabled() const;
+    bool         isFusible(const HclCollectiveParams& params) const;
+    void         fuseCollectives();
+    hcclResult_t runFusedCollective(HclCollectiveParams& params, fusion_t& fusion);
+
     [[nodiscard]] SendRecvApiEntries createScaleoutExpandedVector(const SendRecvApiEntry& entry) const;
 
     int      m_counter = 0;
@@ -55,6 +82,7 @@ protected:
     comm_ranks_t       m_remoteRanks;
     sendrecv_calls_t   m_sendRecvStack;
     collective_calls_t m_collectiveStack;
+    fusion_calls_t     m_collectiveFusions;  // per entry of m_collectiveStack
     type_sendrecv_map  m_selfSendRecvStack;
     comm_groupcall_map m_groupCalls;
     memcpy_calls_t     m_sendRecvMemCpyVec;
@@ -15,7 +15,6 @@
 #include "interfaces/hcl_unique_sorted_vector.h"
 #include "platform/gen2_arch_common/hcl_address_generator.h"
 #include "platform/gen2_arch_common/signals/manager.h"   // for SignalsManager
-#include "platform/gen2_arch_common/collective_utils.h"  // for getNextBox, getPrevBox
 #include "hcl_math_utils.h"                              // for div_round_up
 
 #define SLICE_RATIO_FIXED_POINT_ACCURACY 4
@@ -291,12 +290,7 @@ bool CommonState::isEdgeIteration() const
 
 unsigned CommonState::calcBoxIterRecv(BoxNumInfo& boxNumInfo) const
 {
-    unsigned boxIter = m_boxIterations + m_dynamicComm.getMyScaleupGroup() - boxNumInfo.m_boxNum;
-    if (boxIter >= m_boxIterations)
-    {
-        boxIter -= m_boxIterations;
-    }
-    return boxIter;
+    return m_dynamicComm.getBoxRingDistance(boxNumInfo.m_boxNum, m_dynamicComm.getMyScaleupGroup(), m_boxIterations);
 }
 
 uint64_t CommonState::calcSendAddrSize() const
@@ -1049,7 +1043,7 @@ bool CommonState::isScaleoutRequired(bool isSend, BoxNumInfo& sendBoxNumInfo)
             {
                 // send out only to next box (box iteration 1). no send to root box
                 // and in single peer broadcast only root and its peers send out
-                if (sendBoxNumInfo.m_boxNum == getNextBox(myBox, m_boxIterations) &&
+                if (sendBoxNumInfo.m_boxNum == m_dynamicComm.getNextRingBox(myBox, m_boxIterations) &&
                     sendBoxNumInfo.m_boxNum != rootBox() &&
                     (m_collectiveOp != eHCLSinglePeerBroadcast || isRootOrRootPeer()))
                 {
@@ -1060,7 +1054,8 @@ bool CommonState::isScaleoutRequired(bool isSend, BoxNumInfo& sendBoxNumInfo)
             {
                 // recv only from prev box (box iteration 1). root box doesn;t recv
                 // and in single peer broadcast only root peers recv
-                if (sendBoxNumInfo.m_boxNum == getPrevBox(myBox, m_boxIterations) && myBox != rootBox() &&
+                if (sendBoxNumInfo.m_boxNum == m_dynamicComm.getPrevRingBox(myBox, m_boxIterations) &&
+                    myBox != rootBox() &&
                     (m_collectiveOp != eHCLSinglePeerBroadcast || isRootPeer()))
                 {
                     return true;
@@ -1444,7 +1439,7 @@ bool SliceState::gatherOpsWaitForRS(bool isScaleup)
     else  // scaleout
     {
         AGWaitForRS = m_collectiveOp == eHCLAllReduce && m_currentOp == eHCLAllGather && m_isMultiScaleupGroup &&
-                      getPrevBox(m_boxNumInfo.m_boxNum, m_boxIterations) == myScaleupGroup;
+                      m_dynamicComm.getPrevRingBox(m_boxNumInfo.m_boxNum, m_boxIterations) == myScaleupGroup;
         GatherWaitForRS = m_collectiveOp == eHCLReduce && m_currentOp == eHCLGather && m_isMultiScaleupGroup &&
                           m_boxNumInfo.m_boxNum == m_rootBox && myScaleupGroup != m_rootBox;
     }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>  // for uint8_t
+#include <vector>   // for vector
+
 static inline unsigned int getNextBox(const unsigned currBox, const unsigned numOfBoxes)
 {
     // increment with wrap-around
@@ -11,3 +14,63 @@ static inline unsigned int getPrevBox(const unsigned currBox, const unsigned num
     // decrement with wrap-around
     return (currBox == 0) ? numOfBoxes - 1 : currBox - 1;
 }
+
+enum class BoxTreeType : uint8_t
+{
+    NONE     = 0,
+    BINOMIAL = 1,  // log2(#boxes) levels, for latency bound messages
+    CHAIN    = 2   // rootBox -> rootBox + 1 -> ..., pipelined in chunks for larger messages
+};
+
+struct BoxTreePeers
+{
+    int                   parent = -1;  // -1 for the root box
+    std::vector<unsigned> children;     // in send order
+};
+
+/**
+ * @brief Calculate the parent and children of myBox in a tree of numOfBoxes boxes rooted at rootBox.
+ *
+ * Boxes are renumbered relative to the root, so any root gives the same tree shape. In the binomial tree the
+ * children are ordered by decreasing subtree size, so the deepest subtree starts first.
+ */
+static inline BoxTreePeers
+getBoxTreePeers(const BoxTreeType type, const unsigned myBox, const unsigned rootBox, const unsigned numOfBoxes)
+{
+    BoxTreePeers   peers;
+    const unsigned relBox = (myBox + numOfBoxes - rootBox) % numOfBoxes;
+    const auto     toBox  = [&](const unsigned rel) { return (rel + rootBox) % numOfBoxes; };
+
+    if (type == BoxTreeType::CHAIN)
+    {
+        if (relBox > 0)
+        {
+            peers.parent = toBox(relBox - 1);
+        }
+        if (relBox + 1 < numOfBoxes)
+        {
+            peers.children.push_back(toBox(relBox + 1));
+        }
+        return peers;
+    }
+
+    // binomial - the parent clears the lowest set bit, children set each lower bit
+    unsigned mask = 1;
+    while (mask < numOfBoxes)
+    {
+        if (relBox & mask)
+        {
+            peers.parent = toBox(relBox - mask);
+            break;
+        }
+        mask <<= 1;
+    }
+    for (mask >>= 1; mask > 0; mask >>= 1)
+    {
+        if (relBox + mask < numOfBoxes)
+        {
+            peers.children.push_back(toBox(relBox + mask));
+        }
+    }
+    return peers;
+}
@@ -17,6 +17,7 @@ public:
     void            advanceProg(uint64_t currTargetValue);
     bool            isCreditExpiring();
     inline unsigned getPoolSize() { return m_poolSize; }
+    inline uint64_t getLastExpiration() { return m_creditExpirationsAtTargetValue; }
 
 protected:
     int getCurrentCreditIndex(bool inc);
@@ -114,9 +114,9 @@ void NativeScaleoutDescriptor::run(SliceState& sliceState)
     }
     else
     {
-        unsigned boxIter = mod(sliceState.m_boxNumInfo.m_boxNum + sliceState.m_boxIterations -
-                                   sliceState.m_dynamicComm.getMyScaleupGroup(),
-                               sliceState.m_boxIterations);
+        unsigned boxIter = sliceState.m_dynamicComm.getBoxRingDistance(sliceState.m_dynamicComm.getMyScaleupGroup(),
+                                                                       sliceState.m_boxNumInfo.m_boxNum,
+                                                                       sliceState.m_boxIterations);
         doReduction      = (sliceState.m_isReductionCollective && boxIter >= sliceState.m_scaleoutBuffersAmount &&
                        !sliceState.isRSContReduction()) ||
                       sliceState.doReduction();
@@ -456,6 +456,13 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
                   nonCollectiveState.m_recvFenceValue,
                   nonCollectiveState.m_isSend);
 
+    // When the user buffer can be registered, the NIC reads/writes it directly and the PDMA staging through the host
+    // buffer is replaced by a plain signal, so the sync scheme stays the same as in the staged path
+    const bool     zeroCopy        = provider.acquireUserBuffer(nonCollectiveState.m_execution.m_deviceAddress,
+                                                            size,
+                                                            nonCollectiveState.getQpSet());
+    const uint64_t transferAddress = zeroCopy ? nonCollectiveState.m_execution.m_deviceAddress : hostAddress;
+
     if (nonCollectiveState.m_isSend)
     {
         HostStream* sendHostStream = provider.m_hostStreamVec[m_archStreamIdx][hostUarchStreamIdx][HOST_STREAM_SEND];
@@ -463,28 +470,44 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
             provider.m_hostStreamVec[m_archStreamIdx][hostUarchStreamIdx][HOST_STREAM_WAIT_FOR_SEND_COMP];
         const FenceInfo fence(nonCollectiveState.m_execution.m_scaleoutFences[0]);
 
-        LOG_HCL_TRACE(HCL,
-                      "scaleout send's pdma will signal to {}; move {} bytes of data from device addr 0x{:x} to mapped "
-                      "addr 0x{:x} (host 0x{:x})",
-                      m_collectiveRoutines.getScalUtils()->printSOBInfo(fence.lbw.addr),
-                      size,
-                      nonCollectiveState.m_execution.m_deviceAddress,
-                      hostMappedAddress,
-                      hostAddress);
+        if (zeroCopy)
+        {
+            LOG_HCL_TRACE(HCL,
+                          "scaleout zero-copy send of {} bytes from device addr 0x{:x}, signal to {}",
+                          size,
+                          nonCollectiveState.m_execution.m_deviceAddress,
+                          m_collectiveRoutines.getScalUtils()->printSOBInfo(fence.lbw.addr));
 
-        m_commands.serializePdmaCommand(m_currentStream,
-                                        m_schedIdx,
-                                        false,  // isDownload
-                                        hostMappedAddress,
-                                        nonCollectiveState.m_execution.m_deviceAddress,
-                                        size,
-                                        false,  // isReduction
-                                        hcclOpNone,
-                                        false,  // isCastUp
-                                        nonCollectiveState.m_apiId,
-                                        m_archStreamIdx,
-                                        nonCollectiveState.m_dataType,
-                                        fence.lbw.addr);
+            m_commands.serializeLbwWriteCommand(m_currentStream,
+                                                m_schedIdx,
+                                                fence.lbw.addr,
+                                                m_collectiveRoutines.getSoConfigValue(1, true));
+        }
+        else
+        {
+            LOG_HCL_TRACE(HCL,
+                          "scaleout send's pdma will signal to {}; move {} bytes of data from device addr 0x{:x} to "
+                          "mapped addr 0x{:x} (host 0x{:x})",
+                          m_collectiveRoutines.getScalUtils()->printSOBInfo(fence.lbw.addr),
+                          size,
+                          nonCollectiveState.m_execution.m_deviceAddress,
+                          hostMappedAddress,
+                          hostAddress);
+
+            m_commands.serializePdmaCommand(m_currentStream,
+                                            m_schedIdx,
+                                            false,  // isDownload
+                                            hostMappedAddress,
+                                            nonCollectiveState.m_execution.m_deviceAddress,
+                                            size,
+                                            false,  // isReduction
+                                            hcclOpNone,
+                                            false,  // isCastUp
+                                            nonCollectiveState.m_apiId,
+                                            m_archStreamIdx,
+                                            nonCollectiveState.m_dataType,
+                                            fence.lbw.addr);
+        }
 
         const uint32_t soAddr = nonCollectiveState.m_execution.m_completionSoAddr;
         const SobInfo  sob(m_collectiveRoutines.getScalUtils()->getSOBInfo(soAddr));
@@ -505,7 +528,7 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
             libfabricCompCallback};
         HostSchedCommandsGen2Arch::serializeHostScaleOutCommandWithFence(sendHostStream->getOuterQueue(),
                                                                          nonCollectiveState.m_isSend,
-                                                                         hostAddress,
+                                                                         transferAddress,
                                                                          remoteRank,
                                                                          size,
                                                                          nonCollectiveState.m_comm,
@@ -552,7 +575,7 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
             libfabricCompCallback};
         HostSchedCommandsGen2Arch::serializeHostSendScaleOutCommand(recvHostStream->getOuterQueue(),
                                                                     nonCollectiveState.m_isSend,
-                                                                    hostAddress,
+                                                                    transferAddress,
                                                                     remoteRank,
                                                                     size,
                                                                     nonCollectiveState.m_comm,
@@ -575,27 +598,42 @@ void LibfabricNonCollectiveScaleoutDescriptor::run(NonCollectiveState& nonCollec
         const uint32_t soAddr = nonCollectiveState.m_execution.m_completionSoAddr;
         const SobInfo  sob2(m_collectiveRoutines.getScalUtils()->getSOBInfo(soAddr));
         LOG_HCL_TRACE(HCL, "recv remoteRank={}, soAddr=0x{:x}, sob2.sobId={}", remoteRank, soAddr, sob2.sobId);
-        LOG_HCL_TRACE(HCL,
-                      "scaleout recv's pdma will signal to {}; move {} bytes of data from mapped "
-                      "addr 0x{:x} (host 0x{:x}) to device addr 0x{:x}",
-                      m_collectiveRoutines.getScalUtils()->printSOBInfo(soAddr),
-                      size,
-                      hostMappedAddress,
-                      hostAddress,
-                      nonCollectiveState.m_execution.m_deviceAddress);
-        m_commands.serializePdmaCommand(m_currentStream,
-                                        m_schedIdx,
-                                        true,  // isDownload
-                                        hostMappedAddress,
-                                        nonCollectiveState.m_execution.m_deviceAddress,
-                                        size,
-                                        false,  // isReduction
-                                        hcclOpNone,
-                                        false,  // isCastUp
-                                        nonCollectiveState.m_apiId,
-                                        m_archStreamIdx,
-                                        nonCollectiveState.m_dataType,
-                                        soAddr);
+        if (zeroCopy)
+        {
+            LOG_HCL_TRACE(HCL,
+                          "scaleout zero-copy recv of {} bytes to device addr 0x{:x}, signal to {}",
+                          size,
+                          nonCollectiveState.m_execution.m_deviceAddress,
+                          m_collectiveRoutines.getScalUtils()->printSOBInfo(soAddr));
+            m_commands.serializeLbwWriteCommand(m_currentStream,
+                                                m_schedIdx,
+                                                soAddr,
+                                                m_collectiveRoutines.getSoConfigValue(1, true));
+        }
+        else
+        {
+            LOG_HCL_TRACE(HCL,
+                          "scaleout recv's pdma will signal to {}; move {} bytes of data from mapped "
+                          "addr 0x{:x} (host 0x{:x}) to device addr 0x{:x}",
+                          m_collectiveRoutines.getScalUtils()->printSOBInfo(soAddr),
+                          size,
+                          hostMappedAddress,
+                          hostAddress,
+                          nonCollectiveState.m_execution.m_deviceAddress);
+            m_commands.serializePdmaCommand(m_currentStream,
+                                            m_schedIdx,
+                                            true,  // isDownload
+                                            hostMappedAddress,
+                                            nonCollectiveState.m_execution.m_deviceAddress,
+                                            size,
+                                            false,  // isReduction
+                                            hcclOpNone,
+                                            false,  // isCastUp
+                                            nonCollectiveState.m_apiId,
+                                            m_archStreamIdx,
+                                            nonCollectiveState.m_dataType,
+                                            soAddr);
+        }
     }
 
     provider.notifyHostScheduler(m_archStreamIdx);
@@ -701,6 +739,7 @@ void GaudiDirectScaleoutDescriptor::run(SliceState& sliceState)
                           fence.lbw.addr,
                           fence.lbw.data);
 
+            provider.acquireDirectBuffer(sendAddr, dataSize, sliceState.getQpSet());
             sendHostStream->incSrCount();
             OfiCompCallbackParams compParams {
                 sob.smIdx,
@@ -751,6 +790,7 @@ void GaudiDirectScaleoutDescriptor::run(SliceState& sliceState)
         }
         else
         {
+            provider.acquireDirectBuffer(recvAddr, dataSize, sliceState.getQpSet());
             recvHostStream->incSrCount();
             OfiCompCallbackParams compParams {
                 sob.smIdx,
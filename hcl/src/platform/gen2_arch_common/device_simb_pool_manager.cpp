@@ -1,12 +1,14 @@
 #include "device_simb_pool_manager.h"
 
 #include <cstdint>
+#include <algorithm>  // for min, max
 
 #include "hcl_device.h"
 #include "hcl_global_conf.h"
 #include "hcl_utils.h"        // for VERIFY
 #include "hcl_log_manager.h"  // for LOG_*
 #include "hcl_math_utils.h"
+#include "infra/hcl_debug_stats.h"                     // for g_dbgStats, DEBUG_STATS_...
 #include "infra/scal/gen2_arch_common/scal_manager.h"  // for getHBMBaseVAAddress
 #include "infra/buffer_handle_generator.h"
 #include "platform/gen2_arch_common/simb_pool_manager_base.h"
@@ -15,10 +17,40 @@
 DeviceSimbPoolManagerBase::DeviceSimbPoolManagerBase(
     std::array<SimbPoolContainerParamsPerStream, MAX_POOL_CONTAINER_IDX> spcParamsPerStream,
     const std::map<e_devicePoolID, unsigned>&                            sizes)
-: SimbPoolManagerBase(spcParamsPerStream, sizes)
+: SimbPoolManagerBase(spcParamsPerStream, sizes), m_adaptive(GCFG_HCL_SIMB_POOL_ADAPTIVE.value())
 {
 }
 
+DeviceSimbPoolManagerBase::~DeviceSimbPoolManagerBase()
+{
+    for (const auto& [poolIdx, stats] : m_poolStats)
+    {
+        if (stats.allocations == 0) continue;
+
+        LOG_HCL_INFO(HCL,
+                     "SIMB pool {}: allocations={}, stalls={}, stallOps={}, size={} (initial {}), grown={}, shrunk={}",
+                     poolIdx,
+                     stats.allocations,
+                     stats.stalls,
+                     stats.stallOps,
+                     m_poolSizes.at(poolIdx),
+                     m_initialPoolSizes.at(poolIdx),
+                     stats.grownSimbs,
+                     stats.shrunkSimbs);
+
+        if (GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW)
+        {
+            g_dbgStats.addCounter(fmt::format("simbPool{}Stalls", (unsigned)poolIdx), stats.stalls);
+            g_dbgStats.addCounter(fmt::format("simbPool{}StallOps", (unsigned)poolIdx), stats.stallOps);
+        }
+    }
+
+    if (m_repartitions > 0)
+    {
+        LOG_HCL_INFO(HCL, "SIMB pools were repartitioned {} times", m_repartitions);
+    }
+}
+
 void DeviceSimbPoolManagerBase::init()
 {
     unsigned gcfgFactor                       = GCFG_HCL_SCALEOUT_BUFFER_FACTOR.value();
@@ -30,7 +62,9 @@ void DeviceSimbPoolManagerBase::init()
         m_creditManagers.emplace(poolIndex,
                                  m_poolSizes.at(poolIndex) / getFactor(static_cast<e_devicePoolID>(poolIndex)));
         poolBase[getPoolContainerIndex((e_devicePoolID)poolIndex)] += m_poolSizes.at(poolIndex);
+        m_poolStats[poolIndex] = {};
     }
+    m_initialPoolSizes = m_poolSizes;
     VERIFY(gcfgFactor <= MAX_SCALEOUT_FACTOR,
            "HCL_SCALEOUT_BUFFER_FACTOR({}) is expected to be <= {}",
            gcfgFactor,
@@ -157,6 +191,12 @@ int64_t DeviceSimbPoolManagerBase::getCurrentTargetValue(const e_devicePoolID
 
 void DeviceSimbPoolManagerBase::advanceProg(uint64_t currTargetValue)
 {
+    m_currTargetValue = currTargetValue;
+    if (m_adaptive && m_cgSize > 0 && currTargetValue >= m_nextRepartitionTarget)
+    {
+        repartition();
+    }
+
     for (auto& creditManagerEntry : m_creditManagers)
     {
         creditManagerEntry.second.advanceProg(currTargetValue);
@@ -170,7 +210,166 @@ bool DeviceSimbPoolManagerBase::bufferExpired(e_devicePoolID poolId)
 
 uint64_t DeviceSimbPoolManagerBase::allocNextBuffer(uint64_t targetValue, const e_devicePoolID poolIdx)
 {
-    return m_creditManagers[poolIdx].allocNextCredit(targetValue);
+    const uint64_t   prevTargetValue = m_creditManagers[poolIdx].allocNextCredit(targetValue);
+    DevicePoolStats& stats           = m_poolStats[poolIdx];
+
+    stats.allocations++;
+    // same rule as the extra credits calculation: the previous user of the credit is only known to be done once it
+    // falls out of the completion group window
+    if (prevTargetValue != 0 && prevTargetValue < m_currTargetValue && m_currTargetValue - prevTargetValue < m_cgSize)
+    {
+        const uint64_t stallOps = m_cgSize - (m_currTargetValue - prevTargetValue);
+        stats.stalls++;
+        stats.stallOps += stallOps;
+        stats.windowStallOps += stallOps;
+    }
+
+    return prevTargetValue;
+}
+
+bool DeviceSimbPoolManagerBase::isResizable(const e_devicePoolID poolIdx) const
+{
+    // the scaleup pool size is configured into the graph sync (LTU), and in the RS continuous reduction flow the
+    // accumulation pool is sized after the scaleout pools
+    if (poolIdx == SCALEUP_AND_ALL2ALL_POOL)
+    {
+        return false;
+    }
+    if (GCFG_HCL_RS_SO_RECV_CONT_REDUCTION.value() &&
+        (poolIdx == SCALEOUT_POOL || poolIdx == SCALEOUT_POOL_1 || poolIdx == SCALEOUT_ACC_POOL))
+    {
+        return false;
+    }
+
+    return m_initialPoolSizes.at(poolIdx) % s_resizeStep == 0;
+}
+
+unsigned DeviceSimbPoolManagerBase::getMinPoolSize(const e_devicePoolID poolIdx) const
+{
+    // a pool never drops below half of its configured size, an op may hold several of its credits
+    unsigned half = round_to_multiple(m_initialPoolSizes.at(poolIdx) / 2, s_resizeStep);
+    return std::max(half, s_resizeStep);
+}
+
+bool DeviceSimbPoolManagerBase::isContainerIdle(const std::vector<e_devicePoolID>& layout)
+{
+    for (e_devicePoolID poolIdx : layout)
+    {
+        if (m_creditManagers[poolIdx].getLastExpiration() + m_cgSize > m_currTargetValue)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DeviceSimbPoolManagerBase::repartitionContainer(const std::vector<e_devicePoolID>& layout)
+{
+    int receiver = -1;
+    for (unsigned pos = 0; pos < layout.size(); pos++)
+    {
+        if (isResizable(layout[pos]) && m_poolStats[layout[pos]].windowStallOps > 0 &&
+            (receiver < 0 || m_poolStats[layout[pos]].windowStallOps > m_poolStats[layout[receiver]].windowStallOps))
+        {
+            receiver = pos;
+        }
+    }
+    if (receiver < 0)
+    {
+        return true;
+    }
+
+    if (!isContainerIdle(layout))
+    {
+        return false;
+    }
+
+    // donor is the idle pool with the most spare SIMBs that can be reached without moving a fixed pool
+    int      donor      = -1;
+    unsigned donorSpare = 0;
+    for (int pos = 0; pos < (int)layout.size(); pos++)
+    {
+        e_devicePoolID poolIdx = layout[pos];
+        if (pos == receiver || !isResizable(poolIdx) || m_poolStats[poolIdx].windowStallOps > 0) continue;
+
+        bool blocked = false;
+        for (int between = std::min(pos, receiver) + 1; between < std::max(pos, receiver); between++)
+        {
+            blocked |= !isResizable(layout[between]);
+        }
+
+        unsigned minSize = getMinPoolSize(poolIdx);
+        unsigned spare   = m_poolSizes[poolIdx] > minSize ? m_poolSizes[poolIdx] - minSize : 0;
+        if (!blocked && spare >= s_resizeStep && spare > donorSpare)
+        {
+            donor      = pos;
+            donorSpare = spare;
+        }
+    }
+    if (donor < 0)
+    {
+        return true;
+    }
+
+    const int first = std::min(donor, receiver);
+    const int last  = std::max(donor, receiver);
+    if (m_poolBases[layout[first]] % s_resizeStep != 0)
+    {
+        return true;
+    }
+
+    m_poolSizes[layout[donor]] -= s_resizeStep;
+    m_poolSizes[layout[receiver]] += s_resizeStep;
+    m_poolStats[layout[donor]].shrunkSimbs += s_resizeStep;
+    m_poolStats[layout[receiver]].grownSimbs += s_resizeStep;
+
+    // all credits of the container are free, so the moved pools restart with fresh credit managers
+    unsigned base = m_poolBases[layout[first]];
+    for (int pos = first; pos <= last; pos++)
+    {
+        e_devicePoolID poolIdx    = layout[pos];
+        m_poolBases[poolIdx]      = base;
+        m_creditManagers[poolIdx] = CreditManager(m_poolSizes[poolIdx] / getFactor(poolIdx));
+        base += m_poolSizes[poolIdx];
+    }
+    m_repartitions++;
+
+    LOG_HCL_DEBUG(HCL,
+                  "Moved {} SIMBs from pool {} (size {}) to pool {} (size {}), targetValue={}",
+                  s_resizeStep,
+                  layout[donor],
+                  m_poolSizes[layout[donor]],
+                  layout[receiver],
+                  m_poolSizes[layout[receiver]],
+                  m_currTargetValue);
+    return true;
+}
+
+void DeviceSimbPoolManagerBase::repartition()
+{
+    bool done = true;
+    for (unsigned poolContainerIndex = 0; poolContainerIndex < getPoolContainerCount(); poolContainerIndex++)
+    {
+        std::vector<e_devicePoolID> layout;  // pools of the container in base order
+        for (auto const& sizeEntry : m_poolSizes)
+        {
+            if (getPoolContainerIndex(sizeEntry.first) == poolContainerIndex)
+            {
+                layout.push_back(sizeEntry.first);
+            }
+        }
+        done &= repartitionContainer(layout);
+    }
+
+    // a container with stalls that isn't idle yet is checked again on the next op
+    if (done)
+    {
+        for (auto& statsEntry : m_poolStats)
+        {
+            statsEntry.second.windowStallOps = 0;
+        }
+        m_nextRepartitionTarget = m_currTargetValue + GCFG_HCL_SIMB_POOL_ADAPTIVE_INTERVAL.value();
+    }
 }
 
 unsigned DeviceSimbPoolManagerBase::getPoolContainerIndexByAddr(uint64_t address)
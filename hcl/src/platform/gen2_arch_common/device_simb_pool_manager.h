@@ -2,6 +2,7 @@
 #pragma once
 #include <cstdint>  // for int64_t, uint64_t, uint32_t
 #include <vector>   // for vector
+#include <map>      // for map
 
 #include "simb_pool_manager_base.h"
 #include "hccl_types.h"  // for hcclRedOp_t
@@ -12,10 +13,27 @@ constexpr unsigned MIN_SCALEOUT_FACTOR = 1;
 class HclDeviceGen2Arch;
 struct BufferToken;
 
+struct DevicePoolStats
+{
+    uint64_t allocations    = 0;
+    uint64_t stalls         = 0;  // allocations of a credit that may still be used by one of the last cgSize ops
+    uint64_t stallOps       = 0;  // ops the device waits for those credits to be released, summed over all stalls
+    uint64_t windowStallOps = 0;  // stallOps since the last repartition check
+    uint64_t grownSimbs     = 0;  // SIMBs received from other pools of the container
+    uint64_t shrunkSimbs    = 0;  // SIMBs given to other pools of the container
+};
+
+/**
+ * Each pool owns a fixed range of its container and throttles on its own credits. In adaptive mode
+ * (HCL_SIMB_POOL_ADAPTIVE) the manager counts credit-wait stalls per pool and, at most once per
+ * HCL_SIMB_POOL_ADAPTIVE_INTERVAL ops, moves SIMBs from a pool that did not stall to the pool that stalled the most.
+ * A container is repartitioned only when all its credits expired at least cgSize ops ago, i.e. none of its buffers
+ * can still be in use by the device, and only between pools whose size isn't baked into the device configuration.
+ */
 class DeviceSimbPoolManagerBase : public SimbPoolManagerBase<e_devicePoolID, MAX_POOL_CONTAINER_IDX>
 {
 public:
-    virtual ~DeviceSimbPoolManagerBase() = default;
+    virtual ~DeviceSimbPoolManagerBase();
 
     DeviceSimbPoolManagerBase(std::array<SimbPoolContainerParamsPerStream, MAX_POOL_CONTAINER_IDX> spcParamsPerStream,
                               const std::map<e_devicePoolID, unsigned>&                            sizes);
@@ -40,6 +58,8 @@ public:
 
     void                              advanceProg(uint64_t currTargetValue);
     bool                              bufferExpired(e_devicePoolID poolId);
+    void                              setCgSize(uint64_t cgSize) { m_cgSize = cgSize; }
+    const DevicePoolStats&            getPoolStats(const e_devicePoolID poolIdx) { return m_poolStats[poolIdx]; }
     unsigned                          getPoolContainerIndexByAddr(uint64_t address);
     virtual unsigned                  getPoolContainerIndex(const e_devicePoolID poolIdx) const = 0;
     SimbPoolContainerParamsPerStream& getPoolContainerParamsPerStream(const unsigned poolContainerIndex);
@@ -49,9 +69,25 @@ public:
     static bool                       isSiboPool(const e_devicePoolID poolIdx);
 
 private:
+    bool     isResizable(const e_devicePoolID poolIdx) const;
+    unsigned getMinPoolSize(const e_devicePoolID poolIdx) const;
+    bool     isContainerIdle(const std::vector<e_devicePoolID>& layout);
+    bool     repartitionContainer(const std::vector<e_devicePoolID>& layout);
+    void     repartition();
+
+    const bool                                m_adaptive;
+    uint64_t                                  m_cgSize                = 0;
+    uint64_t                                  m_currTargetValue       = 0;
+    uint64_t                                  m_nextRepartitionTarget = 0;
+    uint64_t                                  m_repartitions          = 0;
+    std::map<e_devicePoolID, unsigned>        m_initialPoolSizes;
+    std::map<e_devicePoolID, DevicePoolStats> m_poolStats;
+
     // Granularity requirements for buffers:
     // 8 for scaleup buffers pool
     // All values must be a power of 2
     static const unsigned s_defaultFactor = 1;
     static const unsigned s_scaleupFactor = 8;
+    // Pools are resized in steps of the largest factor, so every pool base stays aligned to any pool factor
+    static const unsigned s_resizeStep = MAX_SCALEOUT_FACTOR;
 };
@@ -1,7 +1,8 @@
 
 #include "group_calls.h"
 
-#include <algorithm>  // for max, none_of
+#include <algorithm>  // for max, none_of, find
+#include <map>        // for map
 #include <unordered_map>
 #include <ostream>  // for operator<<, ostream
 
@@ -27,12 +28,12 @@ void GroupCalls::addCall(const SendRecvApiEntry& sendRecvEntry)
     m_groupCalls[sendRecvEntry.hwModuleID].push_back(entry);
 }
 
-unsigned GroupCalls::getRemoteRanksCount()
+unsigned GroupCalls::getRemoteRanksCount() const
 {
     unsigned ret = 0;
-    for (auto& remoteRanks : m_groupCalls)
+    for (const SendRecvVector& remoteRanks : m_groupCalls)
     {
-        ret += remoteRanks.second.size();
+        ret += remoteRanks.size();
     }
 
     return ret;
@@ -40,10 +41,11 @@ unsigned GroupCalls::getRemoteRanksCount()
 
 std::ostream& operator<<(std::ostream& os, const GroupCallsAggregation& groupCalls)
 {
-    for (const auto& mapPair : groupCalls)
+    for (size_t hwModId = 0; hwModId < groupCalls.size(); hwModId++)
     {
-        os << "{ Key=" << mapPair.first << " : V=";
-        os << mapPair.second;
+        if (groupCalls[hwModId].empty()) continue;
+        os << "{ Key=" << hwModId << " : V=";
+        os << groupCalls[hwModId];
         os << " }, ";
     }
     return os;
@@ -73,11 +75,12 @@ SendRecvVector GroupCalls::createScaleoutIterationEntries(const unsigned iter) c
     return iterationRanksVector;
 }
 
-const SendRecvVector& GroupCalls::buildIterationsLayout(const bool     isSend,
-                                                        const HCL_Rank currRank,
-                                                        const unsigned currBox,
-                                                        const unsigned numOfBoxes,
-                                                        const HCL_Rank numOfRanks)
+const SendRecvVector& GroupCalls::buildIterationsLayout(const bool                   isSend,
+                                                        const HCL_Rank               currRank,
+                                                        const unsigned               currBox,
+                                                        const unsigned               numOfBoxes,
+                                                        const HCL_Rank               numOfRanks,
+                                                        const std::vector<unsigned>& boxRing)
 {
     LOG_HCL_TRACE(HCL,
                   "isSend={}, currRank={}, currBox={}, numOfBoxes={}, numOfRanks={}",
@@ -91,10 +94,8 @@ const SendRecvVector& GroupCalls::buildIterationsLayout(const bool     isSend,
     // Key => rank, Value => vector of entries to send / recv from that rank
     std::map<HCL_Rank, SendRecvVector> orderedMap;
 
-    for (const auto& mapPair : m_groupCalls)
+    for (const SendRecvVector& ranksVectorPerHwModule : m_groupCalls)
     {
-        const SendRecvVector& ranksVectorPerHwModule = m_groupCalls.at(mapPair.first);
-
         for (const SendRecvEntry& entry : ranksVectorPerHwModule)
         {
             VERIFY(entry.isValid, "Invalid entry");
@@ -102,78 +103,52 @@ const SendRecvVector& GroupCalls::buildIterationsLayout(const bool     isSend,
             orderedMap[remoteRank].push_back(entry);
         }
     }
-    // now iterate over boxes. For send -> go right from our current box until wrap around. For recv -> go left until
-    // wrap around
+    // now iterate over boxes in scaleout order (see HclDynamicCommunicator::getBoxRing). For send -> go right from our
+    // current box until wrap around. For recv -> go left until wrap around
     const unsigned int ranksPerBox = numOfRanks / numOfBoxes;
     LOG_HCL_TRACE(HCL, "isSend={}, numOfBoxes={}, ranksPerBox={}", isSend, numOfBoxes, ranksPerBox);
+    VERIFY(boxRing.size() == numOfBoxes, "boxRing.size={} doesn't match numOfBoxes={}", boxRing.size(), numOfBoxes);
+    const unsigned currPosition = std::find(boxRing.begin(), boxRing.end(), currBox) - boxRing.begin();
 
     // calc send / recv ranks order
-    unsigned int boxIter = currBox;
-    while ((boxIter = isSend ? getNextBox(boxIter, numOfBoxes) : getPrevBox(boxIter, numOfBoxes)) != currBox)
+    unsigned int position = currPosition;
+    while ((position = isSend ? getNextBox(position, numOfBoxes) : getPrevBox(position, numOfBoxes)) != currPosition)
     {
-        HCL_Rank firstRankInBox = boxIter * ranksPerBox;
-        HCL_Rank lastRankInBox  = boxIter * ranksPerBox + ranksPerBox - 1;
+        const unsigned int boxIter        = boxRing[position];
+        const HCL_Rank     firstRankInBox = boxIter * ranksPerBox;
+        const HCL_Rank     lastRankInBox  = boxIter * ranksPerBox + ranksPerBox - 1;
         LOG_HCL_TRACE(HCL,
-                      "isSend={}, boxIter={}, firstRankInBox={}, lastRankInBox={}",
+                      "isSend={}, position={}, boxIter={}, firstRankInBox={}, lastRankInBox={}",
                       isSend,
+                      position,
                       boxIter,
                       firstRankInBox,
                       lastRankInBox);
-        auto it = isSend ? ((firstRankInBox > 0) ? orderedMap.upper_bound(firstRankInBox - 1) : orderedMap.begin())
-                         : orderedMap.lower_bound(lastRankInBox +
-                                                  1);  // try to find next rank with entries in the target box direction
-        bool foundRank = false;
-        if (isSend)
-        {
-            foundRank = it != orderedMap.end();
-        }
-        else
+
+        // copy the entries of all the ranks in this box to target list, in rank order
+        auto it = orderedMap.lower_bound(firstRankInBox);
+        if (it == orderedMap.end() || it->first > lastRankInBox)
         {
-            foundRank = it != orderedMap.begin();
-            if (foundRank) it--;
+            LOG_HCL_TRACE(HCL, "isSend={}, Nothing to process in this boxIter={}", isSend, boxIter);
+            continue;
         }
-        if (foundRank)  // found at least one rank in target box direction
+        while (it != orderedMap.end() && it->first <= lastRankInBox)
         {
-            // process all entries for this found box
-            const HCL_Rank nextRank = it->first;               // a rank with entry(ies) in box in current direction
-            boxIter                 = nextRank / ranksPerBox;  // update the box number of found
-            firstRankInBox          = boxIter * ranksPerBox;   // update first rank in box found
-            lastRankInBox           = boxIter * ranksPerBox + ranksPerBox - 1;  // update last rank in box found
-            LOG_HCL_TRACE(HCL,
-                          "isSend={}, boxIter={}, firstRankInBox={}, lastRankInBox={}, nextRank={}",
-                          isSend,
-                          boxIter,
-                          firstRankInBox,
-                          lastRankInBox,
-                          nextRank);
-            // loop on all possible ranks in this box, and copy their entries in order to target list
-            for (HCL_Rank rankInThisBox = firstRankInBox; rankInThisBox <= lastRankInBox; rankInThisBox++)
+            // copy all the entires for the rank found
+            const SendRecvVector& entriesForRank = it->second;
+            for (auto entry : entriesForRank)
             {
-                auto ranksIter = orderedMap.find(rankInThisBox);
-                if (ranksIter != orderedMap.end())
-                {
-                    // copy all the entires for the rank found
-                    const SendRecvVector& entriesForRank = ranksIter->second;
-                    for (auto entry : entriesForRank)
-                    {
-                        m_orderedList.push_back(entry);
-                        LOG_HCL_TRACE(HCL,
-                                      "Adding isSend={}, entry.count={}, rankInThisBox={}, entriesForRank.size={}",
-                                      isSend,
-                                      entry.count,
-                                      rankInThisBox,
-                                      entriesForRank.size());
-                    }
-                    orderedMap.erase(
-                        ranksIter);  // all this rank entries were copied, remove it so we find next one in order
-                }
+                m_orderedList.push_back(entry);
+                LOG_HCL_TRACE(HCL,
+                              "Adding isSend={}, entry.count={}, rankInThisBox={}, entriesForRank.size={}",
+                              isSend,
+                              entry.count,
+                              it->first,
+                              entriesForRank.size());
             }
-            LOG_HCL_TRACE(HCL, "isSend={}, Updated m_orderedList.size={}", isSend, m_orderedList.size());
-        }
-        else
-        {
-            LOG_HCL_TRACE(HCL, "isSend={}, Nothing to process in this boxIter={}", isSend, boxIter);
+            it = orderedMap.erase(it);  // all this rank entries were copied
         }
+        LOG_HCL_TRACE(HCL, "isSend={}, Updated m_orderedList.size={}", isSend, m_orderedList.size());
     }
 
     // end of loop - verify all entries deleted
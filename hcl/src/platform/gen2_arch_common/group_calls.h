@@ -1,7 +1,7 @@
 #pragma once
 
+#include <array>    // for array
 #include <cstdint>  // for uint32_t
-#include <map>      // for map
 #include <vector>   // for vector
 #include <iosfwd>   // for ostream
 
@@ -13,8 +13,8 @@ struct SendRecvApiEntry;
 
 namespace hcl
 {
-typedef std::map<uint32_t, SendRecvVector> GroupCallsAggregation;  // key => hw_mod_id, Note: There are always at most
-                                                                   // number of devices in a box entries in map
+// index => hw_mod_id, modules without calls have an empty vector
+typedef std::array<SendRecvVector, MAX_MODULES_IDS_PER_SERVER> GroupCallsAggregation;
 
 typedef std::vector<SendRecvArray> SendRecvArraysVector;
 
@@ -23,17 +23,18 @@ class GroupCalls
 public:
     void addCall(const SendRecvApiEntry& sendRecvEntry);
 
-    unsigned getRemoteRanksCount();
+    unsigned getRemoteRanksCount() const;
 
     const GroupCallsAggregation& getGroupCalls() const { return m_groupCalls; };
 
     SendRecvVector        createScaleoutIterationEntries(const unsigned iter) const;
     const SendRecvVector& buildIterationsLayout(
-        const bool     isSend,
-        const HCL_Rank currRank,
-        const unsigned currBox,
-        const unsigned numOfBoxes,
-        const HCL_Rank numOfRanks);  // builds m_orderedList in ordered manner, returns ordered list size
+        const bool                   isSend,
+        const HCL_Rank               currRank,
+        const unsigned               currBox,
+        const unsigned               numOfBoxes,
+        const HCL_Rank               numOfRanks,
+        const std::vector<unsigned>& boxRing);  // builds m_orderedList in ordered manner, returns ordered list size
 
 private:
     GroupCallsAggregation m_groupCalls;
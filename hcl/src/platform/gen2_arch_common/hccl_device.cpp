@@ -1,14 +1,16 @@
 #include "platform/gen2_arch_common/hccl_device.h"
 
-#include <cstring>  // for memcpy
-#include <array>    // for array
-#include <memory>   // for __shared_p...
+#include <cstring>    // for memcpy
+#include <algorithm>  // for find_if
+#include <array>      // for array
+#include <memory>     // for __shared_p...
 
 #include "hccl_internal_defs.h"                           // for hcclHandle
 #include "hccl_types.h"                                   // for hcclSuccess
 #include "platform/gen2_arch_common/hcl_device_config.h"  // for HclDeviceConfig
 #include "hcl_dynamic_communicator.h"                     // for HclDynamic...
 #include "hcl_global_conf.h"                              // for GCFG_BOX_T...
+#include "hcl_math_utils.h"                               // for div, mod
 #include "hcl_public_streams.h"                           // for getStreamID
 #include "interfaces/hcl_remote_device.h"                 // for HclRemoteD...
 #include "hcl_types.h"                                    // for RankInfo
@@ -19,6 +21,7 @@
 #include "hcl_log_manager.h"                              // for LOG_TRACE, LOG_DEBUG, LOG_INFO
 
 #include "hcl_collective_params.h"  // for HclCollectiveParams
+#include "collective_utils.h"       // for getBoxTreePeers
 #include "hcl_device_control_factory.h"
 
 class uninitialized_device_t : public hccl_device_t
@@ -245,6 +248,163 @@ static hcclResult_t selfRankMemcpy(const HclCollectiveParams& params)
     }
 }
 
+static bool useBroadcastTree(const HclCollectiveParams& params, const bool inGroup)
+{
+    const BoxTreeType treeType = (BoxTreeType)GCFG_HCL_SCALEOUT_BCAST_TREE.value();
+    // Inside a user group all calls are concurrent, so a node can't forward what it didn't receive yet.
+    // An empty broadcast has nothing to chunk, it goes through the regular path.
+    return treeType != BoxTreeType::NONE && !inGroup && params.m_count > 0 &&
+           params.m_dynamicComm.isCommunicatorMultiScaleupGroup() &&
+           params.m_count * dataTypeSizeInBytes(params.m_dataType) <= GCFG_HCL_SCALEOUT_BCAST_TREE_MAX_SIZE.value();
+}
+
+/**
+ * @brief Broadcast over a tree of boxes using send/recv.
+ *
+ * In each box the rank that is a scaleout peer of the root receives from its parent box and forwards to its child boxes
+ * and to the other ranks of its box. Boxes and peers are taken from the communicator's box/rank mapping. The message
+ * is split into chunks, and in step i a rank receives chunk i and forwards chunk i-1, so a chain tree is pipelined.
+ * The binomial tree uses a single chunk.
+ *
+ * Reduce has no tree variant: send/recv only moves data, and an inner tree node would have to reduce what it received
+ * with its own data before forwarding it. Non-root ranks have no writable user buffer for that, and the primitive
+ * graph, the only reduction engine reachable from here, has no scaleup gather to bring the reduced chunks of the root
+ * box to the root. Reduce keeps using reduce-scatter + gather.
+ */
+static hcclResult_t treeBroadcast(const HclCollectiveParams& params)
+{
+    HclDynamicCommunicator& dynamicComm  = params.m_dynamicComm;
+    const HCL_Rank          myRank       = dynamicComm.getMyRank();
+    const HCL_Rank          root         = params.m_root;
+    const uint32_t          scaleupSize  = dynamicComm.getScaleupGroupSize();
+    const unsigned          numOfBoxes   = div(dynamicComm.getCommSize(), scaleupSize);
+    const unsigned          myBox        = dynamicComm.getMyScaleupGroup();
+    const unsigned          rootBox      = dynamicComm.getRankToScaleupGroupMap()[root];
+    const BoxTreeType       treeType     = (BoxTreeType)GCFG_HCL_SCALEOUT_BCAST_TREE.value();
+    const unsigned          dataTypeSize = dataTypeSizeInBytes(params.m_dataType);
+
+    const uint64_t chunkCount =
+        (treeType == BoxTreeType::CHAIN)
+            ? std::max<uint64_t>(GCFG_HCL_SCALEOUT_BCAST_CHAIN_CHUNK_SIZE.value() / dataTypeSize, 1)
+            : params.m_count;
+    VERIFY(chunkCount > 0, "tree broadcast of an empty buffer");
+    const unsigned numChunks = div((uint64_t)(params.m_count + chunkCount - 1), chunkCount);
+
+    SendRecvApiEntry entry {ApiType::Send,
+                            params.m_apiId,
+                            params.m_streamHandle,
+                            0,
+                            0,
+                            params.m_dataType,
+                            myRank,
+                            params.m_dynamicComm,
+                            0,
+                            false};
+
+    const auto post = [&](const ApiType apiType, const HCL_Rank peer, const uint64_t address, const unsigned chunk) {
+        const uint64_t offset          = chunk * chunkCount;
+        entry.apiType                  = apiType;
+        entry.remoteRank               = peer;
+        entry.hwModuleID               = dynamicComm.m_remoteDevices[peer]->header.hwModuleID;
+        entry.isRankInsideScaleupGroup = dynamicComm.isRankInsideScaleupGroup(peer);
+        entry.address                  = address + offset * dataTypeSize;
+        entry.count                    = std::min(chunkCount, params.m_count - offset);
+        return hccl_device().send_recv_call(myRank, entry);
+    };
+
+    const UniqueSortedVector& boxRanks  = dynamicComm.getInnerRanksInclusive();
+    const auto                boxRootIt = std::find_if(boxRanks.begin(), boxRanks.end(), [&](const HCL_Rank rank) {
+        return dynamicComm.arePeers(rank, root);
+    });
+    VERIFY(boxRootIt != boxRanks.end(), "tree broadcast, no scaleout peer of root {} in box {}", root, myBox);
+    const HCL_Rank myBoxRoot = *boxRootIt;
+
+    hcclResult_t res = hcclSuccess;
+
+    // Ranks other than the box root only receive from it
+    if (myRank != myBoxRoot)
+    {
+        LOG_HCL_DEBUG(HCL, "tree broadcast, rank {} receives {} chunks from {}", myRank, numChunks, myBoxRoot);
+        VERIFY(hccl_device().group(true) == hcclSuccess, "group start failed");
+        for (unsigned chunk = 0; chunk < numChunks && res == hcclSuccess; chunk++)
+        {
+            res = post(ApiType::Recv, myBoxRoot, params.m_recvBufferAddr, chunk);
+        }
+        const hcclResult_t endRes = hccl_device().group(false);
+        return (res != hcclSuccess) ? res : endRes;
+    }
+
+    // the tree is built over the scaleout box order, so neighbouring subtrees share a switch when reordering is on
+    const std::vector<unsigned>& boxRing      = dynamicComm.getBoxRing();
+    const unsigned               myPosition   = dynamicComm.getBoxRingPosition(myBox);
+    const unsigned               rootPosition = dynamicComm.getBoxRingPosition(rootBox);
+    BoxTreePeers                 peers        = getBoxTreePeers(treeType, myPosition, rootPosition, numOfBoxes);
+    if (peers.parent >= 0)
+    {
+        peers.parent = boxRing[peers.parent];
+    }
+    for (unsigned& child : peers.children)
+    {
+        child = boxRing[child];
+    }
+    // the box root is a scaleout peer of the root, so its peer in each box is the box root there
+    const std::vector<HCL_Rank>& boxToPeer = dynamicComm.getScaleupGroupToRankMap();
+    const uint64_t srcAddr = (myRank == root) ? params.m_sendBufferAddr : params.m_recvBufferAddr;
+    LOG_HCL_DEBUG(HCL,
+                  "tree broadcast, rank {} box {} root box {} parent box {} child boxes [{}] chunks {}",
+                  myRank,
+                  myBox,
+                  rootBox,
+                  peers.parent,
+                  fmt::join(peers.children.begin(), peers.children.end(), ", "),
+                  numChunks);
+
+    for (unsigned step = 0; step <= numChunks && res == hcclSuccess; step++)
+    {
+        VERIFY(hccl_device().group(true) == hcclSuccess, "group start failed");
+
+        if (peers.parent >= 0 && step < numChunks)
+        {
+            res = post(ApiType::Recv, boxToPeer[peers.parent], params.m_recvBufferAddr, step);
+        }
+
+        if (step > 0)
+        {
+            for (const unsigned childBox : peers.children)
+            {
+                if (res != hcclSuccess) break;
+                res = post(ApiType::Send, boxToPeer[childBox], srcAddr, step - 1);
+            }
+            for (const HCL_Rank rank : boxRanks)
+            {
+                if (res != hcclSuccess) break;
+                if (rank != myRank)
+                {
+                    res = post(ApiType::Send, rank, srcAddr, step - 1);
+                }
+            }
+            // the root's recv buffer gets the data as well
+            if (res == hcclSuccess && myRank == root && params.m_sendBufferAddr != params.m_recvBufferAddr)
+            {
+                res = post(ApiType::Send, myRank, params.m_sendBufferAddr, step - 1);
+                if (res == hcclSuccess)
+                {
+                    res = post(ApiType::Recv, myRank, params.m_recvBufferAddr, step - 1);
+                }
+            }
+        }
+
+        const hcclResult_t endRes = hccl_device().group(false);
+        res                       = (res != hcclSuccess) ? res : endRes;
+    }
+
+    if (res != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "tree broadcast failed, rank {}, root {}", myRank, root);
+    }
+    return res;
+}
+
 hcclResult_t hccl_device_t::collective_call(HclCollectiveParams& params)
 {
     uint32_t streamId = stream_id(params.m_streamHandle);
@@ -262,6 +422,11 @@ hcclResult_t hccl_device_t::collective_call(HclCollectiveParams& params)
         }
     }
 
+    if (params.m_collectiveOp == eHCLBroadcast && useBroadcastTree(params, aggregators_[streamId]->isInGroup()))
+    {
+        return treeBroadcast(params);
+    }
+
     return aggregators_[streamId]->addCollectiveApiCall(params);
 }
 
@@ -247,8 +247,9 @@ void HclCollectiveRoutinesGen2Arch::setGroupContext(bool value)
 hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&            groupCallsBuckets,
                                                      std::vector<SendRecvMemCopyEntry>& sendRecvMemCpyVec,
                                                      HCL_Comm                           comm,
-                                                     const std::set<HCL_Rank>&          remoteRanks,
-                                                     uint8_t                            apiId)
+                                                     const RanksVector&                 remoteRanks,
+                                                     uint8_t                            apiId,
+                                                     unsigned                           memcpysPerIter)
 {
     ScopedNullSubmit scopedNullSubmit(m_streamId, m_deviceController);
 
@@ -260,20 +261,25 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                   isHnicsRequired);
     std::lock_guard<std::mutex> lock(m_deviceController.getStreamLock(m_streamId));
 
-    std::set<HCL_Rank> remoteOuterRanks;
+    if (GCFG_HCL_PRIORITY_CLASSES.value())
+    {
+        m_scaleoutProvider->setHostStreamsPriority(m_streamId,
+                                                   m_device->getComm(comm).getPriority() == hcclPriorityHigh);
+    }
+
+    RanksVector remoteOuterRanks;
     for (const HCL_Rank remoteRank : remoteRanks)
     {
         if (!m_device->getComm(comm).isRankInsideScaleupGroup(remoteRank))
         {
-            remoteOuterRanks.insert(remoteRank);
+            remoteOuterRanks.push_back(remoteRank);
         }
     }
 
     if (unlikely(LOG_LEVEL_AT_LEAST_TRACE(HCL)))
     {
-        const ranks_vector remoteOuterRanksVec(remoteOuterRanks.begin(), remoteOuterRanks.end());
         UniqueSortedVector remoteOuterRanksVecSorted;
-        remoteOuterRanksVecSorted.insert_range_sorted(remoteOuterRanksVec.begin(), remoteOuterRanksVec.end());
+        remoteOuterRanksVecSorted.insert_range_sorted(remoteOuterRanks.begin(), remoteOuterRanks.end());
         LOG_HCL_TRACE(HCL, "comm={}, remoteOuterRanksVecSorted={}", comm, remoteOuterRanksVecSorted);
     }
     m_device->openAllRequiredNonPeerQPs(comm, remoteOuterRanks);
@@ -281,27 +287,24 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
     const auto& scaleupSendGroups = groupCallsBuckets[hcl::SchedulersIndex::sendScaleUp].getGroupCalls();
     const auto& scaleupRecvGroups = groupCallsBuckets[hcl::SchedulersIndex::recvScaleUp].getGroupCalls();
     LOG_HCL_TRACE(HCL,
-                  "scaleupSendGroups.size={}, scaleupRecvGroups.size={}",
-                  scaleupSendGroups.size(),
-                  scaleupRecvGroups.size());
+                  "scaleupSendGroups.count={}, scaleupRecvGroups.count={}",
+                  groupCallsBuckets[hcl::SchedulersIndex::sendScaleUp].getRemoteRanksCount(),
+                  groupCallsBuckets[hcl::SchedulersIndex::recvScaleUp].getRemoteRanksCount());
     LOG_HCL_TRACE(HCL, "scaleupSendGroups={}", scaleupSendGroups);
     LOG_HCL_TRACE(HCL, "scaleupRecvGroups={}", scaleupRecvGroups);
 
     auto pred    = [](const SendRecvEntry& entry) { return entry.isValid; };
     auto calcMax = [&pred](const hcl::GroupCallsAggregation& groupCalls) {
         unsigned maxNumber = 0;
-        for (auto vec : groupCalls)
+        for (size_t hwModId = 0; hwModId < groupCalls.size(); hwModId++)
         {
-            if (std::none_of(vec.second.begin(), vec.second.end(), pred))
+            const SendRecvVector& vec = groupCalls[hwModId];
+            if (std::none_of(vec.begin(), vec.end(), pred))
             {
                 continue;
             }
-            LOG_HCL_TRACE(HCL,
-                          "calcMax: maxNumber={}, vec.key={}, vec.size={}",
-                          maxNumber,
-                          vec.first,
-                          vec.second.size());
-            maxNumber = std::max(maxNumber, (unsigned)vec.second.size());
+            LOG_HCL_TRACE(HCL, "calcMax: maxNumber={}, vec.key={}, vec.size={}", maxNumber, hwModId, vec.size());
+            maxNumber = std::max(maxNumber, (unsigned)vec.size());
         }
         return maxNumber;
     };
@@ -315,9 +318,9 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
     const auto& scaleoutSendGroups = scaleoutSendBucket.getGroupCalls();
     const auto& scaleoutRecvGroups = scaleoutRecvBucket.getGroupCalls();
     LOG_HCL_TRACE(HCL,
-                  "scaleoutSendGroups.size={}, scaleoutRecvGroups.size={}",
-                  scaleoutSendGroups.size(),
-                  scaleoutRecvGroups.size());
+                  "scaleoutSendGroups.count={}, scaleoutRecvGroups.count={}",
+                  scaleoutSendBucket.getRemoteRanksCount(),
+                  scaleoutRecvBucket.getRemoteRanksCount());
     LOG_HCL_TRACE(HCL, "scaleoutSendGroups={}", scaleoutSendGroups);
     LOG_HCL_TRACE(HCL, "scaleoutRecvGroups={}", scaleoutRecvGroups);
     const HCL_Rank myRank           = m_device->getMyRank(comm);
@@ -326,6 +329,7 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
     const unsigned lastBox          = m_device->getComm(comm).getRankToScaleupGroupMap()[lastRank];
     const unsigned ScaleupGroupSize = m_device->getComm(comm).getScaleupGroupSize();
     const unsigned numOfCommRanks   = ScaleupGroupSize * (lastBox + 1);
+    const auto&    boxRing          = m_device->getComm(comm).getBoxRing();
     BoxNumInfo     myBoxNumInfo(myBox, BoxNumInfo::boxOrientation::MY_BOX);
     LOG_HCL_TRACE(HCL,
                   "myRank={}, myBox{}, lastRank={}, lastBox={}, ScaleupGroupSize={}, numOfCommRanks={}",
@@ -337,10 +341,10 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                   numOfCommRanks);
 
     const SendRecvVector& orderedSendList =
-        scaleoutSendBucket.buildIterationsLayout(true, myRank, myBox, lastBox + 1, numOfCommRanks);
+        scaleoutSendBucket.buildIterationsLayout(true, myRank, myBox, lastBox + 1, numOfCommRanks, boxRing);
     LOG_HCL_TRACE(HCL, "orderedSendList.size={}, orderedSendList={}", orderedSendList.size(), orderedSendList);
     const SendRecvVector& orderedRecvList =
-        scaleoutRecvBucket.buildIterationsLayout(false, myRank, myBox, lastBox + 1, numOfCommRanks);
+        scaleoutRecvBucket.buildIterationsLayout(false, myRank, myBox, lastBox + 1, numOfCommRanks, boxRing);
     LOG_HCL_TRACE(HCL, "orderedRecvList.size={}, orderedRecvList={}", orderedRecvList.size(), orderedRecvList);
 
     const unsigned maxNumberOfScaleoutSend = orderedSendList.size();
@@ -360,9 +364,10 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
     // The idea is to make sure that there are no more than one send nor more than one recv per QP per CG credit.
     // If the user asked that (between group start and group end) the below loop will split them to signal to
     // different credits.
-    const unsigned numIterations = std::max(std::max(std::max(maxNumberOfSend, maxNumberOfRecv),
-                                                     std::max(maxNumberOfScaleoutSend, maxNumberOfScaleoutRecv)),
-                                            (unsigned)sendRecvMemCpyVec.size());
+    const unsigned numMemcpyIterations = div_round_up(sendRecvMemCpyVec.size(), memcpysPerIter);
+    const unsigned numIterations       = std::max(std::max(std::max(maxNumberOfSend, maxNumberOfRecv),
+                                                           std::max(maxNumberOfScaleoutSend, maxNumberOfScaleoutRecv)),
+                                                  numMemcpyIterations);
     LOG_HCL_TRACE(HCL, "numIterations={}", numIterations);
 
     std::unordered_map<HCL_Rank, unsigned> qpSetIterPerSendPeerRank;
@@ -417,9 +422,9 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
 
         for (const HCL_HwModuleId hwModId : hwModules)
         {
-            if (scaleupSendGroups.count(hwModId) && (iter < scaleupSendGroups.at(hwModId).size()))
+            if (iter < scaleupSendGroups[hwModId].size())
             {
-                scaleupSendIter[hwModId] = scaleupSendGroups.at(hwModId)[iter];
+                scaleupSendIter[hwModId] = scaleupSendGroups[hwModId][iter];
                 sendCnt++;
 
                 if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
@@ -433,9 +438,9 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
                 }
             }
 
-            if (scaleupRecvGroups.count(hwModId) && (iter < scaleupRecvGroups.at(hwModId).size()))
+            if (iter < scaleupRecvGroups[hwModId].size())
             {
-                scaleupRecvIter[hwModId] = scaleupRecvGroups.at(hwModId)[iter];
+                scaleupRecvIter[hwModId] = scaleupRecvGroups[hwModId][iter];
 
                 if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
                 {
@@ -491,27 +496,26 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::sendRecv(hcl::GroupCallsBuckets&
 
         // Determine next self rank send/recv DMA
         std::vector<SendRecvMemCopyEntry> iterMemcpyVec;  // can be empty vector if no self s/r in current iter
-        if (iter < sendRecvMemCpyVec.size())
+        for (size_t memcpyIdx = (size_t)iter * memcpysPerIter;
+             memcpyIdx < std::min(sendRecvMemCpyVec.size(), (size_t)(iter + 1) * memcpysPerIter);
+             memcpyIdx++)
         {
-            iterMemcpyVec.push_back(sendRecvMemCpyVec.at(iter));
+            const SendRecvMemCopyEntry& memcpyEntry = sendRecvMemCpyVec.at(memcpyIdx);
+            iterMemcpyVec.push_back(memcpyEntry);
 
             if (!GCFG_WEAK_ORDER.value() && GCFG_ENABLE_DEPENDENCY_CHECKER.value())
             {
+                const uint64_t memcpySize = memcpyEntry.chunkCount * dataTypeSizeInBytes(memcpyEntry.dataType);
+
                 // Src Address
-                dependencyRunningTargetVal = checkSendRecvDependency(iterMemcpyVec[0].sendBaseAddress,
-                                                                     iterMemcpyVec[0].chunkCount *
-                                                                         dataTypeSizeInBytes(iterMemcpyVec[0].dataType),
-                                                                     m_longSo.targetValue,
-                                                                     true);
-                dependencyTargetVal        = std::max(dependencyTargetVal, dependencyRunningTargetVal);
+                dependencyRunningTargetVal =
+                    checkSendRecvDependency(memcpyEntry.sendBaseAddress, memcpySize, m_longSo.targetValue, true);
+                dependencyTargetVal = std::max(dependencyTargetVal, dependencyRunningTargetVal);
 
                 // Dest Address
-                dependencyRunningTargetVal = checkSendRecvDependency(iterMemcpyVec[0].recvBaseAddress,
-                                                                     iterMemcpyVec[0].chunkCount *
-                                                                         dataTypeSizeInBytes(iterMemcpyVec[0].dataType),
-                                                                     m_longSo.targetValue,
-                                                                     false);
-                dependencyTargetVal        = std::max(dependencyTargetVal, dependencyRunningTargetVal);
+                dependencyRunningTargetVal =
+                    checkSendRecvDependency(memcpyEntry.recvBaseAddress, memcpySize, m_longSo.targetValue, false);
+                dependencyTargetVal = std::max(dependencyTargetVal, dependencyRunningTargetVal);
             }
         }
 
@@ -693,11 +697,29 @@ void HclCollectiveRoutinesGen2Arch::finalizeExec(HcclGraph* graph, int exec)
     m_staticBuffersAllocator.reset();
 }
 
+bool HclCollectiveRoutinesGen2Arch::isHighPriority(const HclCollectiveParams& params) const
+{
+    if (params.m_dynamicComm.getPriority() == hcclPriorityHigh)
+    {
+        return true;
+    }
+
+    // small collectives are latency bound, let them pass bulk transfers of other streams
+    const uint64_t smallOpMaxSize = GCFG_HCL_PRIORITY_SMALL_OP_MAX_SIZE.value();
+    return smallOpMaxSize > 0 && params.m_collectiveOp != eHCLNoCollective &&
+           params.m_count * dataTypeSizeInBytes(params.m_dataType) <= smallOpMaxSize;
+}
+
 uint64_t HclCollectiveRoutinesGen2Arch::initGraph(HcclGraph* graph)
 {
     m_deviceController.getStreamLock(m_streamId).lock();
     HclCollectiveParams& params = *(graph->graphParams());
 
+    if (GCFG_HCL_PRIORITY_CLASSES.value())
+    {
+        m_scaleoutProvider->setHostStreamsPriority(m_streamId, isHighPriority(params));
+    }
+
     graph->context().m_state =
         std::make_shared<CommonState>(params,
                                       m_deviceSimbPoolManager,
@@ -1059,6 +1081,17 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::hclCollectiveCall(HclCollectiveParam
 
     std::lock_guard<std::mutex> lock(m_deviceController.getStreamLock(m_streamId));
 
+    if (GCFG_HCL_PRIORITY_CLASSES.value())
+    {
+        m_scaleoutProvider->setHostStreamsPriority(m_streamId, isHighPriority(params));
+    }
+
+    const ScaleoutProvider::PathScope scaleoutPath(*m_scaleoutProvider, params);
+    if (m_scaleoutProvider->isHybrid() && params.m_dynamicComm.isCommunicatorMultiScaleupGroup())
+    {
+        params.m_dynamicComm.getStats().addScaleoutPath(scaleoutPath.isDirect());
+    }
+
     CommonState commonState {params,
                              m_deviceSimbPoolManager,
                              m_scaleoutProvider->isHostNic(),
@@ -1106,9 +1139,10 @@ hcclResult_t HclCollectiveRoutinesGen2Arch::hclCollectiveCall(HclCollectiveParam
             if ((commonState.m_collectiveOp == eHCLReduce) && !commonState.isRootBox())
             {
                 // Determine the exact single iteration that non-root boxes do the scaleout send
-                scaleoutSendBoxIter = mod(commonState.m_boxIterations + commonState.rootBox() -
-                                              commonState.m_dynamicComm.getMyScaleupGroup(),
-                                          commonState.m_boxIterations);
+                scaleoutSendBoxIter =
+                    commonState.m_dynamicComm.getBoxRingDistance(commonState.m_dynamicComm.getMyScaleupGroup(),
+                                                                 commonState.rootBox(),
+                                                                 commonState.m_boxIterations);
                 gatherStartBoxIter  = scaleoutSendBoxIter;
                 gatherEndBoxIter    = scaleoutSendBoxIter + 1;  // exactly 1 iteration
             }
@@ -1206,20 +1240,20 @@ void HclCollectiveRoutinesGen2Arch::hclCollectiveCall(CommonState&     commonSta
           commonState.m_collectiveOp == eHCLSimpleBroadcast) &&
          commonState.m_dynamicComm.getScaleupGroupSize() != 1);
 
-    const unsigned nextBox = mod(commonState.m_dynamicComm.getMyScaleupGroup() + boxIter, commonState.m_boxIterations);
-
-    const unsigned prevBox =
-        mod(commonState.m_boxIterations + (int)commonState.m_dynamicComm.getMyScaleupGroup() - (int)boxIter,
-            commonState.m_boxIterations);
+    // boxes are visited in the scaleout box ring order, see HclDynamicCommunicator::getBoxRing
+    HclDynamicCommunicator& dynamicComm = commonState.m_dynamicComm;
+    const unsigned          myBox       = dynamicComm.getMyScaleupGroup();
+    const unsigned          numOfBoxes  = commonState.m_boxIterations;
+    const unsigned          nextBox     = dynamicComm.getBoxAtRingDistance(myBox, boxIter, numOfBoxes);
+    const unsigned          prevBox     = dynamicComm.getBoxAtRingDistance(myBox, -(int)boxIter, numOfBoxes);
     BoxNumInfo boxNumInfo =
         BoxNumInfo(scaleOutFirstOp ? prevBox : nextBox,
                    scaleOutFirstOp ? BoxNumInfo::boxOrientation::PREV_BOX : BoxNumInfo::boxOrientation::NEXT_BOX);
     BoxNumInfo nextBoxNumInfo(nextBox, BoxNumInfo::boxOrientation::NEXT_BOX);
     BoxNumInfo prevBoxNumInfo(prevBox, BoxNumInfo::boxOrientation::PREV_BOX);
 
-    const bool isFirstBox = (boxNumInfo.m_boxNum == commonState.m_dynamicComm.getMyScaleupGroup());
-    const bool isLastBox =
-        (mod(boxNumInfo.m_boxNum + 1, commonState.m_boxIterations) == commonState.m_dynamicComm.getMyScaleupGroup());
+    const bool isFirstBox = (boxNumInfo.m_boxNum == myBox);
+    const bool isLastBox  = (dynamicComm.getNextRingBox(boxNumInfo.m_boxNum, numOfBoxes) == myBox);
 
     uint64_t cuid = commonState.calculateCUID(isFirstBox, isLastBox);
     m_dfaLastCuid = cuid;
@@ -88,8 +88,9 @@ public:
     hcclResult_t sendRecv(hcl::GroupCallsBuckets&            groupCallsBuckets,
                           std::vector<SendRecvMemCopyEntry>& sendRecvMemCpyVec,
                           HCL_Comm                           comm,
-                          const std::set<HCL_Rank>&          remoteRanks,
-                          uint8_t                            apiId);
+                          const RanksVector&                 remoteRanks,
+                          uint8_t                            apiId,
+                          unsigned                           memcpysPerIter = 1);
 
     int getRemoteRankToRsi(CommonState& commonState, bool isSend, HCL_Rank remoteRank, bool isAllGatherQp);
 
@@ -141,6 +142,7 @@ public:
 
     void setGroupContext(const bool value);
     bool getGroupContext() const { return m_groupContext; }
+    void requestStrongOrder() { m_requestStrongOrderIter = true; }  // next op waits for all previous ops of the stream
 
     WqeWraparoundBits          getWraparoundBits(HCL_Comm commId, unsigned rank, QpType qpType);
     DeviceSimbPoolManagerBase& getDeviceSimbPoolManager() { return m_deviceSimbPoolManager; }
@@ -296,6 +298,9 @@ protected:
 
     void addScaleoutInternalSOB(SliceState& sliceState, WaitMethod method);
 
+    // Priority class of a collective on the host scheduler, see HCL_PRIORITY_CLASSES
+    bool isHighPriority(const HclCollectiveParams& params) const;
+
     // For DFA log
     void dfaLogAddress(uint64_t address, uint64_t size);
 
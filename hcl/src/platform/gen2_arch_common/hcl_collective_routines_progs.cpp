@@ -19,7 +19,6 @@
 #include "platform/gen2_arch_common/wqe_tracker.h"             // for QpType, WqeTracker
 #include "platform/gen2_arch_common/signals/manager.h"         // for SignalsManager
 #include "platform/gen2_arch_common/dependency_checker.h"      // for DependencyChecker
-#include "platform/gen2_arch_common/collective_utils.h"        // for getNextBox, getPrevBox
 #include "platform/gen2_arch_common/active_stream_manager.h"
 #include "platform/gen2_arch_common/hcl_lbw_write_aggregator.h"
 #include "hcl_math_utils.h"
@@ -764,7 +763,8 @@ void HclCollectiveRoutinesGen2Arch::calculateScaleupSignals(CommonState& commonS
                     }
                 }
                 else if (boxNumInfo.m_boxNum ==
-                             getPrevBox(commonState.m_dynamicComm.getMyScaleupGroup(), commonState.m_boxIterations) &&
+                             commonState.m_dynamicComm.getPrevRingBox(commonState.m_dynamicComm.getMyScaleupGroup(),
+                                                                      commonState.m_boxIterations) &&
                          commonState.m_dynamicComm.getMyScaleupGroup() != commonState.rootBox())
                 {
                     if (commonState.isRootOrRootPeer())
@@ -838,7 +838,8 @@ void HclCollectiveRoutinesGen2Arch::calculateScaleupSignals(CommonState& commonS
                     }
                 }
                 else if (boxNumInfo.m_boxNum ==
-                             getPrevBox(commonState.m_dynamicComm.getMyScaleupGroup(), commonState.m_boxIterations) &&
+                             commonState.m_dynamicComm.getPrevRingBox(commonState.m_dynamicComm.getMyScaleupGroup(),
+                                                                      commonState.m_boxIterations) &&
                          commonState.m_dynamicComm.getMyScaleupGroup() != commonState.rootBox())
                 {
                     if (!commonState.isRootOrRootPeer())
@@ -16,7 +16,6 @@
 #include "platform/gen2_arch_common/host_simb_pool_manager.h"  // for HostSimbPoolManager
 #include "platform/gen2_arch_common/hcl_graph_sync.h"          // for HclGraphSyncGen2Arch
 #include "platform/gen2_arch_common/signals/manager.h"         // for SignalsManager
-#include "platform/gen2_arch_common/collective_utils.h"        // for getNextBox, getPrevBox
 #include "platform/gen2_arch_common/dependency_checker.h"      // for DependencyChecker
 #include "platform/gen2_arch_common/active_stream_manager.h"
 #include "platform/gen2_arch_common/scaleout_provider.h"  // for ScaleoutProvider
@@ -97,7 +96,8 @@ void HclCollectiveRoutinesGen2Arch::determineCompletionSO(SliceState& sliceState
         else if (sliceState.m_collectiveOp == eHCLBroadcast)
         {
             bool isPeersOnly = sliceState.m_isMultiScaleupGroup && sliceState.m_dynamicComm.getScaleupGroupSize() == 1;
-            unsigned nextBox = getNextBox(sliceState.m_dynamicComm.getMyScaleupGroup(), sliceState.m_boxIterations);
+            unsigned nextBox = sliceState.m_dynamicComm.getNextRingBox(sliceState.m_dynamicComm.getMyScaleupGroup(),
+                                                                       sliceState.m_boxIterations);
 
             if (!isPeersOnly)  // in this case we have two events waiting for scaleout recv : scaleout send & AG
             {
@@ -216,7 +216,8 @@ void HclCollectiveRoutinesGen2Arch::provideScaleoutResources(SliceState& sliceSt
                     if (!isPeersOnly)
                     {
                         unsigned nextBox =
-                            getNextBox(sliceState.m_dynamicComm.getMyScaleupGroup(), sliceState.m_boxIterations);
+                            sliceState.m_dynamicComm.getNextRingBox(sliceState.m_dynamicComm.getMyScaleupGroup(),
+                                                                    sliceState.m_boxIterations);
                         unsigned int numFences = (nextBox == sliceState.rootBox()) ? 1 : 2;
                         m_signalsManager->enqueueWait(WaitEvent::COMPLEX_BCAST_SO_SEND_AND_AG_SU_WAIT_FOR_SO_RECV,
                                                       {SignalEvent::SIGNAL_TO_LONGTERM},
@@ -669,6 +670,11 @@ unsigned int HclCollectiveRoutinesGen2Arch::calcRequiredCreditAmount(CommonState
     }
 
     requiredExtraCredits = std::max((unsigned)1, requiredExtraCredits);
+    if (requiredExtraCredits > 1)
+    {
+        // the device holds this op until the older ops that still own its credits are done
+        commonState.m_dynamicComm.getStats().addCreditStall(requiredExtraCredits - 1);
+    }
 
     return m_deviceController.handleExtraCredits(m_streamId, requiredExtraCredits);
 }
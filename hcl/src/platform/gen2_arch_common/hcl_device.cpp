@@ -23,6 +23,7 @@
 #include "platform/gen2_arch_common/server_def.h"                 // for Gen2ArchServerDef
 #include "platform/gen2_arch_common/server_connectivity_types.h"  // for SCALEOUT_DEVICE_ID
 #include "coordinator_defs.h"
+#include "infra/hcl_comm_profiler.h"  // for CommPhaseTimer
 
 // DFA vars
 extern DfaPhase g_dfaPhase;
@@ -138,12 +139,18 @@ hcclResult_t HclDeviceGen2Arch::openQpsHLS(HCL_Comm comm)
     LOG_HCL_HEADER(HCL);
 
     LOG_HCL_INFO(HCL, "Open scale-up QPs");
-    openQpsHlsScaleUp(comm);
+    {
+        CommPhaseTimer timer(COMM_PHASE_INIT_SCALEUP_QPS);
+        openQpsHlsScaleUp(comm);
+    }
 
     LOG_HCL_INFO(HCL, "Open scale-out connections, QP Spray factor: {}", getComm(comm).getMaxScaleOutQpSetsNum());
     UniqueSortedVector outerRanks;
     getOuterRanks(comm, outerRanks);
-    m_scaleoutProvider->openConnectionsOuterRanks(comm, outerRanks);
+    {
+        CommPhaseTimer timer(COMM_PHASE_INIT_SCALEOUT_CONNECTIONS);
+        m_scaleoutProvider->openConnectionsOuterRanks(comm, outerRanks);
+    }
 
     return hcclSuccess;
 }
@@ -458,9 +465,9 @@ ScaleoutProvider* HclDeviceGen2Arch::getScaleOutProvider()
     return m_scaleoutProvider;
 }
 
-extern std::unordered_map<HCL_Comm, spHcclCoordinatorClient> g_hcclCordClient;
+spHcclCoordinatorClient getHcclCordClient(const HCL_Comm comm);
 
-void HclDeviceGen2Arch::openAllRequiredNonPeerQPs(const HCL_Comm comm, const std::set<HCL_Rank>& remoteRanks)
+void HclDeviceGen2Arch::openAllRequiredNonPeerQPs(const HCL_Comm comm, const RanksVector& remoteRanks)
 {
     LOG_HCL_TRACE(HCL, "comm={}, remoteRanks.size={}", comm, remoteRanks.size());
     if (((HclConfigType)GCFG_BOX_TYPE_ID.value() == LOOPBACK) || GCFG_HCL_NULL_SUBMIT.value()) return;
@@ -496,7 +503,7 @@ void HclDeviceGen2Arch::openAllRequiredNonPeerQPs(const HCL_Comm comm, const std
 
     LOG_HCL_TRACE(HCL, "Exchanging connections info from remote ranks - async recv");
 
-    VERIFY(g_hcclCordClient[comm].get());
+    VERIFY(getHcclCordClient(comm).get());
 
     for (const HCL_Rank remoteRank : nonPeerRemoteRanks)
     {
@@ -544,11 +551,11 @@ void HclDeviceGen2Arch::openAllRequiredNonPeerQPs(const HCL_Comm comm, const std
         sendBuffers.push_back(sendBuffer);
     }
 
-    g_hcclCordClient[comm]->sendRecvFromRanks(nonPeerRemoteRanks, recvBuffers, sendBuffers, sendRecvBufSize);
+    getHcclCordClient(comm)->sendRecvFromRanks(nonPeerRemoteRanks, recvBuffers, sendBuffers, sendRecvBufSize);
 
     LOG_HCL_TRACE(HCL, "Updating connections info with remote ranks");
     m_scaleoutProvider->updateConnectionsNonPeer(comm, nonPeerRemoteRanks, hnicsConnectionInfoBuffers);
-    VERIFY(g_hcclCordClient[comm]->rendezvous(nonPeerRemoteRanks), "Failed to synchronize remote ranks");
+    VERIFY(getHcclCordClient(comm)->rendezvous(nonPeerRemoteRanks), "Failed to synchronize remote ranks");
 }
 
 unsigned HclDeviceGen2Arch::getEdmaEngineWorkDistributionSize()
@@ -586,6 +593,12 @@ void HclDeviceGen2Arch::setGaudiDirect()
     {
         return;
     }
+    if (GCFG_HCL_HNIC_HYBRID_PATH.value())
+    {
+        // The hybrid path keeps the host buffers and reaches device memory through user buffer registrations
+        LOG_HCL_INFO(HCL, "Hybrid scaleout path requested, not enabling gaudi direct");
+        return;
+    }
     // Using hl_gcfg::setGcfgItemValue instead of setValue() to enable reading the value later with
     // synConfigurationGet()
     hl_gcfg::setGcfgItemValue("HCCL_GAUDI_DIRECT", "true");
@@ -80,7 +80,7 @@ public:
      * @param remoteRanks   [in] The list of remote rank ids
      * @return
      */
-    void openAllRequiredNonPeerQPs(const HCL_Comm comm, const std::set<HCL_Rank>& remoteRanks);
+    void openAllRequiredNonPeerQPs(const HCL_Comm comm, const RanksVector& remoteRanks);
 
     virtual uint32_t createQpnInLKD(HCL_Comm comm, const uint32_t port, const uint8_t qpId) override;
 
@@ -259,6 +259,48 @@ void HclDeviceConfig::initHostName()
     LOG_HCL_DEBUG(HCL, "Setting m_hostname={}", std::string(m_hostname));
 }
 
+/**
+ * @brief Scaleout switch of this host. HCL_TOPOLOGY_FILE maps hosts to switches, so one file shared by all the hosts
+ * can describe (or simulate) the scaleout topology:
+ * { "HOST_SWITCHES": [ { "HOST": "node-0", "SWITCH_ID": "leaf-0" }, ... ] }
+ * Only the entry of this host is used, the other ranks get it in the first handshake. Hosts that aren't listed use
+ * HCL_TOPOLOGY_SWITCH_ID.
+ */
+static std::string getTopologySwitchId(const std::string& hostname)
+{
+    const std::string& fileName = GCFG_HCL_TOPOLOGY_FILE.value();
+    if (fileName.empty())
+    {
+        return GCFG_HCL_TOPOLOGY_SWITCH_ID.value();
+    }
+
+    json          topology;
+    std::ifstream topologyFile(fileName);
+    if (!topologyFile.good())
+    {
+        LOG_HCL_ERR(HCL, "Failed to open topology file {}", fileName);
+        return GCFG_HCL_TOPOLOGY_SWITCH_ID.value();
+    }
+
+    try
+    {
+        topologyFile >> topology;
+        for (const json& hostConfig : topology.at("HOST_SWITCHES"))
+        {
+            if (hostConfig.at("HOST").get<std::string>() == hostname)
+            {
+                return hostConfig.at("SWITCH_ID").get<std::string>();
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_HCL_ERR(HCL, "Invalid json file {}, error {}", fileName, e.what());
+    }
+
+    return GCFG_HCL_TOPOLOGY_SWITCH_ID.value();
+}
+
 void HclDeviceConfig::fillDeviceInfo(RankInfoHeader& dest)
 {
     dest.hwModuleID = getHwModuleId();
@@ -270,6 +312,10 @@ void HclDeviceConfig::fillDeviceInfo(RankInfoHeader& dest)
         strcpy(dest.hostname, hostname.c_str());
         dest.hostnameLength          = hostname.size();
         dest.failedScaleOutPortsMask = hccl_device()->getFailedScaleOutPortsMask();
+        if (GCFG_HCL_TOPOLOGY_REORDER.value())
+        {
+            strncpy(dest.switchId, getTopologySwitchId(hostname).c_str(), SWITCH_ID_LENGTH - 1);
+        }
         LOG_HCL_DEBUG(HCL, "m_failedScaleOutPortsMask={:024b}", (uint64_t)hccl_device()->getFailedScaleOutPortsMask());
     }
 }
@@ -5,6 +5,7 @@
 #include "platform/gen2_arch_common/hcl_packets_utils.h"      // for SoBaseAndSize, getCompCfg
 #include "infra/scal/gen2_arch_common/scal_names.h"
 #include "infra/scal/gen2_arch_common/scal_utils.h"
+#include "platform/gen2_arch_common/hcl_lbw_write_aggregator.h"
 
 HclDeviceControllerGen2Arch::HclDeviceControllerGen2Arch(const unsigned numOfStreams) : m_numOfStreams(numOfStreams)
 {
@@ -80,6 +81,7 @@ void HclDeviceControllerGen2Arch::initDeviceForCollectiveRoutine(int
                                          cgInfo[(int)hcl::SchedulerType::internal],
                                          GCFG_HCL_LONGTERM_GPSO_COUNT.value(),
                                          deviceSimbPoolManager.getPoolBufferSize(SCALEUP_AND_ALL2ALL_POOL));
+    deviceSimbPoolManager.setCgSize(m_graphSync[archStreamId]->getCgData(false).size);
     longSo->long_so_index = cgInfo[(int)hcl::SchedulerType::external].longSoIndex;
     longSo->targetValue   = cgInfo[(int)hcl::SchedulerType::external].longSoInitialValue;
     longSo->cp_handle     = m_scalManager->getCgHandle(archStreamId, true);
@@ -180,13 +182,16 @@ void HclDeviceControllerGen2Arch::setupMonitors(int archStreamId)
         unsigned fenceBase = getFenceIdx(archStreamId, uarchStreamId, FENCE_MONITOR_IDX);
         scalStream.setTargetValue(m_streamSyncParams[archStreamId].m_longSo->targetValue);
 
+        // the configurations of all the monitors of the stream are emitted in as few bursts as possible
+        HclLbwWriteAggregator aggregator(&scalStream, schedIdx, *m_commands);
+
         // Setup regular monitors
         for (unsigned fenceIdx = 0; fenceIdx < FENCES_PER_STREAM; ++fenceIdx)
         {
             uint64_t monitorPayloadAddr =
                 m_scalManager->getMonitorPayloadAddr((hcl::SchedulersIndex)schedIdx, fenceBase + fenceIdx);
 
-            m_graphSync[archStreamId]->addSetupMonitors(scalStream,
+            m_graphSync[archStreamId]->addSetupMonitors(aggregator,
                                                         uarchStreamId,
                                                         schedResources.monitorBase,
                                                         m_streamSyncParams[archStreamId].m_smInfo.monitorSmIndex,
@@ -202,7 +207,7 @@ void HclDeviceControllerGen2Arch::setupMonitors(int archStreamId)
                 m_scalManager->getMonitorPayloadAddr((hcl::SchedulersIndex)schedIdx, fenceBase + fenceIdx);
 
             m_graphSync[archStreamId]->addSetupLongMonitors(
-                scalStream,
+                aggregator,
                 m_streamSyncParams[archStreamId].m_smInfo.longMonitorSmIndex,
                 monitorPayloadAddr,
                 getLongMonitorIdx(archStreamId, schedIdx, uarchStreamId),
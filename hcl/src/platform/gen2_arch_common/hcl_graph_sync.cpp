@@ -1,21 +1,84 @@
+#include <algorithm>                                          // for lower_bound
+#include <chrono>                                             // for steady_clock
 #include <utility>                                            // for pair
 #include "hcl_utils.h"                                        // for VERIFY
+#include "infra/hcl_debug_stats.h"                            // for g_dbgStats
 #include "infra/scal/gen2_arch_common/scal_stream.h"          // for ScalStream
 #include "platform/gen2_arch_common/commands/hcl_commands.h"  // for HclComm...
 #include "platform/gen2_arch_common/hcl_graph_sync.h"
 #include "platform/gen2_arch_common/hcl_lbw_write_aggregator.h"
 
-void HclGraphSyncGen2Arch::addSetupMonitors(hcl::ScalStream& scalStream,
-                                            unsigned         streamIdx,
-                                            unsigned         monBaseIdx,
-                                            unsigned         smIdx,
-                                            uint64_t         monitorPayloadAddr,
-                                            unsigned         fenceBase,
-                                            unsigned         fenceIdx)
+namespace
+{
+// Accumulates the host time of a monitor arm into the graph sync stats, when debug stats are collected
+class ArmTimer
+{
+public:
+    explicit ArmTimer(uint64_t& hostNs)
+    : m_hostNs(hostNs), m_enabled(GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW)
+    {
+        if (m_enabled)
+        {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ArmTimer()
+    {
+        if (m_enabled)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_hostNs += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }
+    }
+
+private:
+    uint64_t&                             m_hostNs;
+    const bool                            m_enabled;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+uint64_t burstBytes(const size_t numWrites)
+{
+    // a single dword header followed by the (addr, data) pairs
+    return sizeof(uint32_t) + numWrites * sizeof(LbwData);
+}
+}  // namespace
+
+HclGraphSyncGen2Arch::~HclGraphSyncGen2Arch()
+{
+    LOG_HCL_INFO(HCL,
+                 "Graph sync monitor arms: arms={}, lbwWrites={}, skippedWrites={}, bursts={}, burstBytes={}, "
+                 "hostNs={}",
+                 m_stats.monitorArms,
+                 m_stats.lbwWrites,
+                 m_stats.skippedWrites,
+                 m_stats.lbwBursts,
+                 m_stats.burstBytes,
+                 m_stats.hostNs);
+
+    if (GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW)
+    {
+        g_dbgStats.addCounter("graphSyncMonitorArms", m_stats.monitorArms);
+        g_dbgStats.addCounter("graphSyncLbwWrites", m_stats.lbwWrites);
+        g_dbgStats.addCounter("graphSyncSkippedWrites", m_stats.skippedWrites);
+        g_dbgStats.addCounter("graphSyncLbwBursts", m_stats.lbwBursts);
+        g_dbgStats.addCounter("graphSyncBurstBytes", m_stats.burstBytes);
+        g_dbgStats.addCounter("graphSyncArmHostNs", m_stats.hostNs);
+    }
+}
+
+void HclGraphSyncGen2Arch::addSetupMonitors(HclLbwWriteAggregator& aggregator,
+                                            unsigned               streamIdx,
+                                            unsigned               monBaseIdx,
+                                            unsigned               smIdx,
+                                            uint64_t               monitorPayloadAddr,
+                                            unsigned               fenceBase,
+                                            unsigned               fenceIdx)
 {
     for (unsigned monIdx = 0; monIdx < MONITORS_PER_FENCE; ++monIdx)
     {
-        createSetupMonMessages(scalStream,
+        createSetupMonMessages(aggregator,
                                monitorPayloadAddr,
                                fenceBase + fenceIdx,
                                getRegularMonIdx(fenceIdx, monIdx, streamIdx) + monBaseIdx,
@@ -30,15 +93,15 @@ void HclGraphSyncGen2Arch::addSetupHFCMonitors(hcl::ScalStream& scalStream,
                                                uint64_t         smBase,
                                                uint64_t         fenceAddr)
 {
-    unsigned schedIdx = scalStream.getSchedIdx();
+    // all the monitors are set up in as few bursts as possible
+    HclLbwWriteAggregator aggregator(&scalStream, scalStream.getSchedIdx(), m_commands);
     for (size_t i = 0; i < numMonitors; i++)
     {
-        LBWBurstData_t destData;
-        unsigned int   monitorIdx = i + monitorBase;
+        unsigned int monitorIdx = i + monitorBase;
         // set up MON_PAY_DATA to increment by 1
         uint32_t destination = getAddrMonPayData(smBase, monitorIdx);
         uint32_t value       = getSoConfigValue(1, true);
-        destData.push_back({destination, value});
+        aggregator.aggregate(destination, value);
         LOG_HCL_TRACE(HCL,
                       "Updating HFC monitor #{} payload data at address=0x{:x} with value=0x{:x}",
                       monitorIdx,
@@ -48,37 +111,32 @@ void HclGraphSyncGen2Arch::addSetupHFCMonitors(hcl::ScalStream& scalStream,
         // set up MON_PAY_ADDRH to the fence address MSB
         destination = getAddrMonPayAddrh(smBase, monitorIdx);
         value       = (uint32_t)((fenceAddr >> 32) & 0xffffffff);
-        destData.push_back({destination, value});
+        aggregator.aggregate(destination, value);
         LOG_HCL_TRACE(HCL,
                       "Updating HFC monitor #{} payload address high at address=0x{:x} with value=0x{:x}",
                       monitorIdx,
                       destination,
                       value);
-
-        m_commands.serializeLbwBurstWriteCommand(scalStream, schedIdx, destData);
     }
 }
 
-void HclGraphSyncGen2Arch::createSetupMonMessages(hcl::ScalStream& scalStream,
-                                                  uint64_t         address,
-                                                  unsigned         fenceIdx,
-                                                  unsigned         monitorIdx,
-                                                  uint64_t         smBase,
-                                                  bool             isLong)
+void HclGraphSyncGen2Arch::createSetupMonMessages(HclLbwWriteAggregator& aggregator,
+                                                  uint64_t               address,
+                                                  unsigned               fenceIdx,
+                                                  unsigned               monitorIdx,
+                                                  uint64_t               smBase,
+                                                  bool                   isLong)
 {
-    LBWBurstData_t destData;
-    unsigned       schedIdx = scalStream.getSchedIdx();
-
     // Setup to payload address (of the dccmQ of scheduler)
     uint32_t destination = getAddrMonPayAddrl(smBase, monitorIdx);
-    destData.push_back({destination, (uint32_t)address & 0xffffffff});
+    aggregator.aggregate(destination, (uint32_t)address & 0xffffffff);
 
     destination = getAddrMonPayAddrh(smBase, monitorIdx);
-    destData.push_back({destination, (uint32_t)((address >> 32) & 0xffffffff)});
+    aggregator.aggregate(destination, (uint32_t)((address >> 32) & 0xffffffff));
 
     uint32_t value = createSchedMonExpFence(fenceIdx);
     destination    = getAddrMonPayData(smBase, monitorIdx);
-    destData.push_back({destination, value});
+    aggregator.aggregate(destination, value);
     // we assume that the monitor of each soQuarter is located in a corresponding offset in the SM
     unsigned soQuarter = monitorIdx / (SO_TOTAL_COUNT / SO_QUARTERS);
     VERIFY(soQuarter >= 0 && soQuarter < SO_QUARTERS);
@@ -86,9 +144,7 @@ void HclGraphSyncGen2Arch::createSetupMonMessages(hcl::ScalStream& scalStream,
     value = createMonConfig(isLong, soQuarter);
 
     destination = getAddrMonConfig(smBase, monitorIdx);
-    destData.push_back({destination, value});
-
-    m_commands.serializeLbwBurstWriteCommand(scalStream, schedIdx, destData);
+    aggregator.aggregate(destination, value);
 }
 
 uint16_t HclGraphSyncGen2Arch::getFifteenBits(uint64_t val, unsigned index)
@@ -121,6 +177,8 @@ void HclGraphSyncGen2Arch::createArmMonMessages(hcl::ScalStream& scalStream,
     uint32_t addr  = smBase + baseAddrInSm;
     uint32_t value = createMonArm(soValue, false, mask, soIdxNoMask, 0, useEqual);
 
+    m_stats.monitorArms++;
+    m_stats.lbwWrites++;
     m_commands.serializeLbwWriteWithFenceDecCommand(scalStream, scalStream.getSchedIdx(), addr, value, fenceIdx);
 }
 
@@ -133,48 +191,73 @@ void HclGraphSyncGen2Arch::createArmHFCMonMessages(hcl::ScalStream& scalStream,
                                                    uint32_t         fenceAddr,
                                                    bool             useEqual)
 {
+    HclLbwWriteAggregator aggregator(&scalStream, scalStream.getSchedIdx(), m_commands);
+    createArmHFCMonMessages(aggregator, smIdx, soValue, soIdx, soQuarter, monitorIdx, fenceAddr, useEqual);
+    aggregator.flush();
+
+    m_stats.lbwBursts += aggregator.getNumBursts();
+    m_stats.burstBytes += aggregator.getNumBursts() * burstBytes(0);
+}
+
+void HclGraphSyncGen2Arch::createArmHFCMonMessages(HclLbwWriteAggregator& aggregator,
+                                                   unsigned               smIdx,
+                                                   uint64_t               soValue,
+                                                   unsigned               soIdx,
+                                                   unsigned               soQuarter,
+                                                   unsigned               monitorIdx,
+                                                   uint32_t               fenceAddr,
+                                                   bool                   useEqual)
+{
+    ArmTimer timer(m_stats.hostNs);
+
     const unsigned soIdxNoMask = soIdx >> 3;  // LSB are the mask, so unnecessary for long Sos
     /* Each monitor can track up to 8 SOBs. The mask indicates which SOBs are NOT tracked by this monitor, by:
      * 1. performing modulo 8 on the soIdx
      * 2. shifting "1" by the previous step's result - bounded by 7
      * 3. performing NOT on the result to indicate the SOBs we DON'T want to track */
-    const uint8_t  mask = static_cast<uint8_t>(~(1u << (soIdx & 7)));
-    LBWBurstData_t destData;
-    uint64_t       smBase   = getSyncManagerBase(smIdx);
-    unsigned       schedIdx = scalStream.getSchedIdx();
+    const uint8_t  mask   = static_cast<uint8_t>(~(1u << (soIdx & 7)));
+    const uint64_t smBase = getSyncManagerBase(smIdx);
+    VERIFY(monitorIdx < MON_TOTAL_COUNT, "HFC monitor #{} is out of range", monitorIdx);
+
     // things that are not likely to change between iterations
-    LBWBurstData_t cachedData;
-    // MON_CONFIG setup
-    uint32_t destination = getAddrMonConfig(smBase, monitorIdx);
-    uint32_t value       = createMonConfig(false, soQuarter);
-    cachedData.push_back({destination, value});
-    // MON_PAY_ADDRL setup
-    destination = getAddrMonPayAddrl(smBase, monitorIdx);
-    value       = (uint32_t)fenceAddr & 0xffffffff;
-    cachedData.push_back({destination, value});
-    for (size_t i = 0; i < cachedData.size(); i++)
+    const std::pair<MonitorRegCache&, LbwData> cachedData[] = {
+        // MON_CONFIG setup
+        {m_hfcMonConfigCache, {getAddrMonConfig(smBase, monitorIdx), createMonConfig(false, soQuarter)}},
+        // MON_PAY_ADDRL setup
+        {m_hfcMonPayAddrlCache, {getAddrMonPayAddrl(smBase, monitorIdx), (uint32_t)fenceAddr & 0xffffffff}}};
+    size_t writes = 0;
+    for (const auto& [cache, data] : cachedData)
     {
-        if (m_hfcMonitorStatus.find(cachedData[i].addr) != m_hfcMonitorStatus.end() ||
-            m_hfcMonitorStatus[cachedData[i].addr] != cachedData[i].data)
+        if (cache.isCached(smBase, monitorIdx, data.data))
+        {
+            m_stats.skippedWrites++;
+            continue;
+        }
+        LOG_HCL_TRACE(HCL,
+                      "Updating HFC monitor #{} with address=0x{:x}, data=0x{:x}",
+                      monitorIdx,
+                      data.addr,
+                      data.data);
+        aggregator.aggregate(data.addr, data.data);
+        writes++;
+        if (!m_nullSubmit)
         {
-            LOG_HCL_TRACE(HCL,
-                          "Updating HFC monitor #{} with address=0x{:x}, data=0x{:x}",
-                          monitorIdx,
-                          cachedData[i].addr,
-                          cachedData[i].data);
-            destData.push_back({destination, value});
+            cache.store(smBase, monitorIdx, data.data);
         }
     }
 
     // things that are likely to change
     const uint32_t baseAddrInSm = getOffsetMonArm(monitorIdx);
-    value                       = createMonArm(soValue, false, mask, soIdxNoMask, 0, useEqual);
-    destination                 = smBase + baseAddrInSm;
+    const uint32_t value        = createMonArm(soValue, false, mask, soIdxNoMask, 0, useEqual);
+    const uint32_t destination  = smBase + baseAddrInSm;
     // MON_ARM setup
-    destData.push_back({destination, value});
+    aggregator.aggregate(destination, value);
+    writes++;
     LOG_HCL_TRACE(HCL, "Arming HFC monitor #{} at address=0x{:x} with value=0x{:x}", monitorIdx, destination, value);
 
-    m_commands.serializeLbwBurstWriteCommand(scalStream, schedIdx, destData);
+    m_stats.monitorArms++;
+    m_stats.lbwWrites += writes;
+    m_stats.burstBytes += writes * sizeof(LbwData);
 }
 
 void HclGraphSyncGen2Arch::createArmLongMonMessages(hcl::ScalStream& scalStream,
@@ -189,6 +272,7 @@ void HclGraphSyncGen2Arch::createArmLongMonMessages(hcl::ScalStream& scalStream,
     const uint8_t  mask        = ~(1 << (soIdx % 8));
     VERIFY(soIdxNoMask <= 0x3ff);
     VERIFY((soIdxNoMask >> 8) == 0, "long monitors are set up to the first quarter of the SM");
+    VERIFY(monitorIdx + LONG_MON_DWORD_SIZE <= MON_TOTAL_COUNT, "long monitor #{} is out of range", monitorIdx);
     // Arm from last to first, as message to the first indicates that the Arm is complete.
     const uint32_t monArmSize   = getArmMonSize();
     const uint32_t baseAddrInSm = getOffsetMonArm(monitorIdx);
@@ -199,18 +283,27 @@ void HclGraphSyncGen2Arch::createArmLongMonMessages(hcl::ScalStream& scalStream,
         uint32_t addr  = smBase + baseAddrInSm + (i * monArmSize);
         uint32_t value = createMonArm(soValue, true, mask, soIdxNoMask, i, useEqual);
 
-        if (i == 0 ||
-            (m_longMonitorStatus.find(addr) == m_longMonitorStatus.end() || m_longMonitorStatus[addr] != value))
+        // the arm registers of a long monitor are those of the consecutive monitors
+        if (i == 0 || !m_longMonArmCache.isCached(smBase, monitorIdx + i, value))
         {
             destData.push_back({addr, value});
             if (!m_nullSubmit)
             {
-                m_longMonitorStatus[addr] = value;
+                m_longMonArmCache.store(smBase, monitorIdx + i, value);
             }
         }
+        else
+        {
+            m_stats.skippedWrites++;
+        }
     }
     m_commands.serializeLbwBurstWriteCommand(scalStream, scalStream.getSchedIdx(), destData);
     m_commands.serializeFenceDecCommand(scalStream, scalStream.getSchedIdx(), fenceIdx);
+
+    m_stats.monitorArms++;
+    m_stats.lbwWrites += destData.size();
+    m_stats.lbwBursts++;
+    m_stats.burstBytes += burstBytes(destData.size());
 }
 
 uint32_t HclGraphSyncGen2Arch::getCurrentCgSoAddr(CgType type)
@@ -422,7 +515,15 @@ void HclGraphSyncGen2Arch::createSoSignalMessage(hcl::ScalStream& scalStream,
 
 void HclGraphSyncGen2Arch::addPendingWait(uint32_t longSoIdx, uint64_t longSoVal)
 {
-    if (m_pendingWaits.find(longSoIdx) == m_pendingWaits.end() || m_pendingWaits[longSoIdx] < longSoVal)
+    VERIFY(longSoIdx < SO_TOTAL_COUNT, "long SO index {} is out of range", longSoIdx);
+    if (!m_pendingWaitValid[longSoIdx])
+    {
+        m_pendingWaitValid[longSoIdx] = true;
+        m_pendingWaitSos.insert(std::lower_bound(m_pendingWaitSos.begin(), m_pendingWaitSos.end(), longSoIdx),
+                                longSoIdx);
+        m_pendingWaits[longSoIdx] = longSoVal;
+    }
+    else if (m_pendingWaits[longSoIdx] < longSoVal)
     {
         m_pendingWaits[longSoIdx] = longSoVal;
     }
@@ -435,27 +536,31 @@ void HclGraphSyncGen2Arch::addStreamWaitOnLongSo(hcl::ScalStream&              s
                                                  std::map<uint32_t, uint64_t>& waitedValues,
                                                  unsigned                      fenceIdx)
 {
-    for (auto& waitSo : m_pendingWaits)
+    ArmTimer timer(m_stats.hostNs);
+
+    for (const uint32_t soIdx : m_pendingWaitSos)
     {
+        const uint64_t soValue = m_pendingWaits[soIdx];
         // Arm the mon, if there is only 1 target value for this LSO or the targetValue is higher thane the prev
         // targetValue we where waiting on
-        if (waitedValues.find(waitSo.first) == waitedValues.end() || waitedValues[waitSo.first] < waitSo.second)
+        auto waited = waitedValues.find(soIdx);
+        if (waited == waitedValues.end() || waited->second < soValue)
         {
             LOG_HCL_DEBUG(HCL,
                           "Adding stream wait on LSO: schedIdx={}, uarchStreamId={} LSO={}..{}, targetValue {}, "
                           "mon_arm_regs={}..{}, fenceIdx={}",
                           scalStream.getSchedIdx(),
                           scalStream.getUarchStreamIndex(),
-                          m_utils->printSOBInfo(m_utils->calculateSoAddressFromIdxAndSM(smIdx, waitSo.first)),
-                          waitSo.first + 3,
-                          waitSo.second,
+                          m_utils->printSOBInfo(m_utils->calculateSoAddressFromIdxAndSM(smIdx, soIdx)),
+                          soIdx + 3,
+                          soValue,
                           m_utils->printMonArmInfo(smIdx, monIdx),
                           monIdx + 3,
                           fenceIdx);
 
             createArmLongMonMessages(scalStream,
-                                     waitSo.second,
-                                     waitSo.first,
+                                     soValue,
+                                     soIdx,
                                      monIdx,
                                      getSyncManagerBase(smIdx),
                                      fenceIdx,
@@ -464,13 +569,13 @@ void HclGraphSyncGen2Arch::addStreamWaitOnLongSo(hcl::ScalStream&              s
             LOG_TRACE(HCL_CG,
                       SCAL_PROGRESS_HCL_FMT "addWait: (uArchStream:{})",
                       streamId,
-                      waitSo.first,
-                      waitSo.second,
+                      soIdx,
+                      soValue,
                       *scalStream.getSchedAndStreamName());
 
             if (!m_nullSubmit)
             {
-                waitedValues[waitSo.first] = waitSo.second;
+                waitedValues[soIdx] = soValue;
             }
         }
     }
@@ -483,6 +588,8 @@ void HclGraphSyncGen2Arch::addStreamWaitOnLongSo(hcl::ScalStream& scalStream,
                                                  unsigned         soIdx,
                                                  unsigned         fenceIdx)
 {
+    ArmTimer timer(m_stats.hostNs);
+
     LOG_HCL_DEBUG(HCL,
                   "Adding stream wait on LSO: schedIdx={}, uarchStreamId={} LSO={}..{}, targetValue {}, "
                   "mon_arm_regs={}..{}, fenceIdx={}",
@@ -498,14 +605,14 @@ void HclGraphSyncGen2Arch::addStreamWaitOnLongSo(hcl::ScalStream& scalStream,
     createArmLongMonMessages(scalStream, soValue, soIdx, monIdx, getSyncManagerBase(smIdx), fenceIdx, true);
 }
 
-void HclGraphSyncGen2Arch::addSetupLongMonitors(hcl::ScalStream& scalStream,
-                                                unsigned         smIdx,
-                                                uint64_t         monitorPayloadAddr,
-                                                unsigned         monBaseIdx,
-                                                unsigned         fenceBase,
-                                                unsigned         fenceIdx)
+void HclGraphSyncGen2Arch::addSetupLongMonitors(HclLbwWriteAggregator& aggregator,
+                                                unsigned               smIdx,
+                                                uint64_t               monitorPayloadAddr,
+                                                unsigned               monBaseIdx,
+                                                unsigned               fenceBase,
+                                                unsigned               fenceIdx)
 {
-    createSetupMonMessages(scalStream,
+    createSetupMonMessages(aggregator,
                            monitorPayloadAddr,
                            fenceIdx + fenceBase,
                            (fenceIdx * LONG_MONITOR_LENGTH) + monBaseIdx,
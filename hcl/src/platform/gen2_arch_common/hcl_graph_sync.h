@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>                                     // for array
+#include <bitset>                                    // for bitset
 #include <cstdint>                                   // for uint32_t, uint64_t
 #include <map>                                       // for map
 #include <vector>                                    // for map
@@ -23,6 +24,7 @@ static const unsigned FENCES_PER_STREAM        = 2;
 static const unsigned MONITORS_PER_FENCE       = 4;
 static const unsigned SO_QUARTERS              = 4;
 static const unsigned SO_TOTAL_COUNT           = 8192;
+static const unsigned MON_TOTAL_COUNT          = 2048;
 static const unsigned MONITORS_PER_STREAM      = FENCES_PER_STREAM * MONITORS_PER_FENCE;
 static const unsigned LONG_MONITORS_PER_STREAM = 1;
 static const unsigned LONG_MONITOR_LENGTH      = 4;
@@ -34,6 +36,45 @@ struct LtuInfo
     unsigned SOValue;
 };
 
+/**
+ * @brief Last value written to one register of every monitor of a sync manager, indexed by monitor. A set dirty bit
+ * means the register content is unknown and the next write to it must be emitted.
+ */
+struct MonitorRegCache
+{
+    MonitorRegCache() { dirty.set(); }
+
+    bool isCached(uint64_t base, unsigned monitorIdx, uint32_t value) const
+    {
+        return base == smBase && !dirty[monitorIdx] && values[monitorIdx] == value;
+    }
+
+    void store(uint64_t base, unsigned monitorIdx, uint32_t value)
+    {
+        if (base != smBase)
+        {
+            dirty.set();
+            smBase = base;
+        }
+        values[monitorIdx] = value;
+        dirty[monitorIdx]  = false;
+    }
+
+    std::array<uint32_t, MON_TOTAL_COUNT> values = {};
+    std::bitset<MON_TOTAL_COUNT>          dirty;
+    uint64_t                              smBase = 0;
+};
+
+struct HclGraphSyncStats
+{
+    uint64_t monitorArms   = 0;
+    uint64_t lbwWrites     = 0;  // LBW writes emitted by monitor arms
+    uint64_t skippedWrites = 0;  // LBW writes of unchanged monitor registers that were not emitted
+    uint64_t lbwBursts     = 0;
+    uint64_t burstBytes    = 0;  // size of the LBW burst commands emitted by monitor arms
+    uint64_t hostNs        = 0;  // host time spent arming monitors, collected with HCL_DEBUG_STATS_LEVEL only
+};
+
 class HclGraphSyncGen2Arch
 {
 public:
@@ -42,20 +83,24 @@ public:
     HclGraphSyncGen2Arch(const HclGraphSyncGen2Arch&)            = delete;
     HclGraphSyncGen2Arch& operator=(HclGraphSyncGen2Arch&&)      = delete;
     HclGraphSyncGen2Arch& operator=(const HclGraphSyncGen2Arch&) = delete;
-    virtual ~HclGraphSyncGen2Arch()                              = default;
+    virtual ~HclGraphSyncGen2Arch();
 
     void setCgInfo(hcl::CgInfo& externalCgInfo,
                    hcl::CgInfo& internalCgInfo,
                    unsigned     longtermGpsoPoolSize,
                    unsigned     ltuGpsoPoolSize);
 
-    void addSetupMonitors(hcl::ScalStream& scalStream,
-                          unsigned         streamIdx,
-                          unsigned         monBaseIdx,
-                          unsigned         smIdx,
-                          uint64_t         monitorPayloadAddr,
-                          unsigned         fenceBase,
-                          unsigned         fenceIdx);
+    /**
+     * @brief Setup the regular monitors of a fence. The monitor configurations are aggregated, so the setup of all the
+     * monitors of a stream can be emitted in as few LBW bursts as possible.
+     */
+    void addSetupMonitors(HclLbwWriteAggregator& aggregator,
+                          unsigned               streamIdx,
+                          unsigned               monBaseIdx,
+                          unsigned               smIdx,
+                          uint64_t               monitorPayloadAddr,
+                          unsigned               fenceBase,
+                          unsigned               fenceIdx);
 
     /**
      * @brief Setup host fence counter monitors with monitor payload data (value to signal) and payload address high (of
@@ -73,12 +118,12 @@ public:
                              uint64_t         smBase,
                              uint64_t         fenceAddr);
 
-    void addSetupLongMonitors(hcl::ScalStream& scalStream,
-                              unsigned         dcoreIdx,
-                              uint64_t         monitorPayloadAddr,
-                              unsigned         monBaseIdx,
-                              unsigned         fenceBase,
-                              unsigned         fenceIdx);
+    void addSetupLongMonitors(HclLbwWriteAggregator& aggregator,
+                              unsigned               dcoreIdx,
+                              uint64_t               monitorPayloadAddr,
+                              unsigned               monBaseIdx,
+                              unsigned               fenceBase,
+                              unsigned               fenceIdx);
 
     unsigned getRegularMonIdx(unsigned fenceIdxInStream, unsigned monIdxInFence, unsigned streamIdx);
 
@@ -110,6 +155,9 @@ public:
     void incLongtermSoIndex(unsigned credits);
     int  getLongtermAmount();
 
+    /**
+     * @brief Arm the long monitor on every pending wait whose value was not waited on yet by the stream.
+     */
     void addStreamWaitOnLongSo(hcl::ScalStream&              scalStream,
                                int                           streamId,
                                unsigned                      smIdx,
@@ -156,6 +204,19 @@ public:
                                  uint32_t         fenceAddr,
                                  bool             useEqual = false);
 
+    /**
+     * @brief Batched variant of createArmHFCMonMessages, the monitor configuration and arm are added to the aggregator
+     * so several monitors can be armed in a single LBW burst.
+     */
+    void createArmHFCMonMessages(HclLbwWriteAggregator& aggregator,
+                                 unsigned               smIdx,
+                                 uint64_t               soValue,
+                                 unsigned               soIdx,
+                                 unsigned               soQuarter,
+                                 unsigned               monitorIdx,
+                                 uint32_t               fenceAddr,
+                                 bool                   useEqual = false);
+
     void createResetSoMessages(HclLbwWriteAggregator&                                         aggregator,
                                uint32_t                                                       smIdx,
                                const std::array<bool, (unsigned)WaitMethod::WAIT_METHOD_MAX>& methodsToClean);
@@ -169,6 +230,7 @@ public:
 
     void                                       setNullSubmit(bool nullSubmit) { m_nullSubmit = nullSubmit; }
     inline std::vector<std::pair<bool, bool>>& getLtuData() { return m_ltuValid; }
+    const HclGraphSyncStats&                   getStats() const { return m_stats; }
 
 protected:
     virtual uint32_t     getAddrMonPayAddrl(uint64_t smBase, unsigned idx) = 0;
@@ -186,12 +248,12 @@ protected:
                                       int            i,
                                       bool           useEqual)                       = 0;
     virtual uint32_t     createSchedMonExpFence(unsigned fenceIdx)         = 0;
-    virtual void         createSetupMonMessages(hcl::ScalStream& scalStream,
-                                                uint64_t         address,
-                                                unsigned         fenceIdx,
-                                                unsigned         monitorIdx,
-                                                uint64_t         smBase,
-                                                bool             isLong);
+    virtual void         createSetupMonMessages(HclLbwWriteAggregator& aggregator,
+                                                uint64_t               address,
+                                                unsigned               fenceIdx,
+                                                unsigned               monitorIdx,
+                                                uint64_t               smBase,
+                                                bool                   isLong);
     uint16_t             getFifteenBits(uint64_t val, unsigned index);
     HclCommandsGen2Arch& m_commands;
     Gen2ArchScalUtils*   m_utils = NULL;
@@ -233,9 +295,16 @@ private:
     int64_t m_currentLongtermGpso   = -1;
     int     m_currentLongtermAmount = 1;
 
-    std::map<uint32_t, uint64_t> m_pendingWaits;
-    std::map<uint32_t, uint32_t> m_longMonitorStatus;
-    std::map<uint32_t, uint32_t> m_hfcMonitorStatus;
+    // pending wait values indexed by long SO index, m_pendingWaitSos holds the valid indices in ascending order
+    std::array<uint64_t, SO_TOTAL_COUNT> m_pendingWaits = {};
+    std::bitset<SO_TOTAL_COUNT>          m_pendingWaitValid;
+    std::vector<uint32_t>                m_pendingWaitSos;
+
+    MonitorRegCache m_longMonArmCache;
+    MonitorRegCache m_hfcMonConfigCache;
+    MonitorRegCache m_hfcMonPayAddrlCache;
+
+    HclGraphSyncStats m_stats;
 
     uint32_t m_syncObjectBase = (uint32_t)-1;
     unsigned m_soSize         = (unsigned)-1;
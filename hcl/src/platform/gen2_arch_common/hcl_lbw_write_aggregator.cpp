@@ -13,13 +13,27 @@ HclLbwWriteAggregator::HclLbwWriteAggregator(hcl::ScalStream*     scalStream,
 void HclLbwWriteAggregator::aggregate(uint32_t destination, uint32_t data)
 {
     m_burstContainer.push_back({destination, data});
+    if (m_submitOnDestroy && m_burstContainer.size() == MAX_BURST_WRITES)
+    {
+        flush();
+    }
 }
 
-HclLbwWriteAggregator::~HclLbwWriteAggregator()
+void HclLbwWriteAggregator::flush()
 {
-    if (m_submitOnDestroy && m_burstContainer.size() > 0)
+    if (m_burstContainer.size() > 0)
     {
         m_commands.serializeLbwBurstWriteCommand(*m_scalStream, m_schedIdx, m_burstContainer);
+        m_burstContainer.clear();
+        m_numBursts++;
+    }
+}
+
+HclLbwWriteAggregator::~HclLbwWriteAggregator()
+{
+    if (m_submitOnDestroy)
+    {
+        flush();
     }
 }
 
@@ -5,9 +5,17 @@
 
 class HclCommandsGen2Arch;
 
+/**
+ * @brief Collects LBW writes and serializes them as LBW burst write commands.
+ *
+ * A burst command holds at most MAX_BURST_WRITES writes. When the aggregator submits on destroy, a full burst is
+ * serialized as soon as the limit is reached, so any number of writes can be aggregated.
+ */
 class HclLbwWriteAggregator
 {
 public:
+    static constexpr unsigned MAX_BURST_WRITES = 31;  // width of the num_lbw_write field
+
     HclLbwWriteAggregator(hcl::ScalStream*     scalStream,
                           unsigned             schedIdx,
                           HclCommandsGen2Arch& commands,
@@ -17,7 +25,9 @@ public:
     HclLbwWriteAggregator& operator=(HclLbwWriteAggregator&&)      = delete;
     HclLbwWriteAggregator& operator=(const HclLbwWriteAggregator&) = delete;
     void                   aggregate(uint32_t destination, uint32_t data);
+    void                   flush();
     LBWBurstData_t*        getLbwBurstData();
+    unsigned               getNumBursts() const { return m_numBursts; }
     virtual ~HclLbwWriteAggregator();
 
 private:
@@ -25,6 +35,7 @@ private:
     hcl::ScalStream*     m_scalStream;
     unsigned             m_schedIdx;
     HclCommandsGen2Arch& m_commands;
+    unsigned             m_numBursts = 0;  // bursts serialized so far
 
     // We may want to submit the aggregated data via a different command,
     // this flag prevents the submission of the burst container once the aggregator is destroyed.
@@ -114,4 +114,14 @@ void HostSchedCommandsGen2Arch::serializeHostSignalSoCommand(spHostStreamFifo ho
     command->compParams.soIdx         = soIdx;
     command->compParams.value         = value;
     hostStream->submit();
-}
\ No newline at end of file
+}
+
+void HostSchedCommandsGen2Arch::serializeHostSetPriorityCommand(spHostStreamFifo hostStream, bool highPriority)
+{
+    static size_t                dwords = sizeof(host_sched_cmd_set_priority) >> 2;
+    host_sched_cmd_set_priority* command =
+        reinterpret_cast<host_sched_cmd_set_priority*>(hostStream->getNextPtr(dwords));
+    command->opcode       = HOST_SCHED_CMD_SET_PRIORITY;
+    command->highPriority = highPriority;
+    hostStream->submit();
+}
@@ -32,4 +32,6 @@ void serializeHostFenceCommand(spHostStreamFifo hostStream, unsigned fenceIdx, c
 
 void serializeHostSignalSoCommand(spHostStreamFifo hostStream, unsigned soDcore, unsigned soIdx, uint32_t value);
 
+void serializeHostSetPriorityCommand(spHostStreamFifo hostStream, bool highPriority);
+
 }  // namespace HostSchedCommandsGen2Arch
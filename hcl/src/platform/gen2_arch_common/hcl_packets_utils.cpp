@@ -57,6 +57,12 @@ reduction_datatype_e getReductionDataType(bool isCastUp, hcclDataType_t dataType
         case hcclFloat16:
             res = isCastUp ? REDUCTION_UPSCALING_FP16 : REDUCTION_FP16;
             break;
+        case hcclInt8:
+            res = REDUCTION_INT8;
+            break;
+        case hcclUint8:
+            res = REDUCTION_UINT8;
+            break;
         case hcclInt32:
             res = REDUCTION_INT32;
             break;
@@ -70,6 +76,16 @@ reduction_datatype_e getReductionDataType(bool isCastUp, hcclDataType_t dataType
     return res;
 }
 
+unsigned getEdmaDataSize(hcclDataType_t dataType, bool is16Bit)
+{
+    // 8-bit types are reduced natively, they are never cast
+    if (dataTypeSizeInBytes(dataType) == 1)
+    {
+        return 0;
+    }
+    return is16Bit ? 1 : 2;
+}
+
 uint8_t getEdmaStreamCtxtId(uint8_t apiId, unsigned streamIndex)
 {
     hcl::StreamContextEncoding streamCtxtID;
@@ -109,11 +125,11 @@ nic_edma_datatypes_t get_nic_edma_dtype(hcclDataType_t dataType, bool is16BitMem
     {
         nic_edma_dtype = NIC_EDMA_BF;
     }
-    if (dataType == hcclInt32)
+    if (dataType == hcclInt32 || dataType == hcclInt8)
     {
         nic_edma_dtype = NIC_EDMA_SIGNED;
     }
-    else if (dataType == hcclUint32)
+    else if (dataType == hcclUint32 || dataType == hcclUint8)
     {
         nic_edma_dtype = NIC_EDMA_UNSIGNED;
     }
@@ -47,6 +47,12 @@ SoBaseAndSize* getCompCfg();
 
 reduction_datatype_e getReductionDataType(bool isCastUp, hcclDataType_t dataType);
 
+/**
+ * @brief EDMA datasize field of dataType elements: 0 - 8bit, 1 - 16bit, 2 - 32bit.
+ * is16Bit selects between the 16-bit and 32-bit sizes of 16-bit types, which are accumulated in 32 bits when cast.
+ */
+unsigned getEdmaDataSize(hcclDataType_t dataType, bool is16Bit);
+
 uint8_t getEdmaStreamCtxtId(uint8_t apiId, unsigned streamIndex);
 
 uint8_t getEdmaDebugCtxtId(uint8_t apiId, uint8_t isScaleOut, uint8_t slice);
@@ -443,8 +443,10 @@ void HclPublicStreams::printStreamQueuesDFALog(unsigned              archStream,
         {handle_host_sched_cmd_scale_out_with_fence_nic_op, SIZE_IN_DWORDS(host_sched_cmd_scale_out_with_fence_nic_op)},
         {handle_host_sched_cmd_scale_out_nic_op, SIZE_IN_DWORDS(host_sched_cmd_scale_out_nic_op)},
         {handle_host_sched_cmd_signal_so, SIZE_IN_DWORDS(host_sched_cmd_signal_so)},
+        {handle_host_sched_cmd_set_priority, SIZE_IN_DWORDS(host_sched_cmd_set_priority)},
     };
     std::vector<CmdHandler> waiter_outer_queue_commands = {
+        {handle_host_sched_cmd_set_priority, SIZE_IN_DWORDS(host_sched_cmd_set_priority)},
         {handle_host_sched_cmd_wait_for_completion, SIZE_IN_DWORDS(host_sched_cmd_wait_for_completion)},
     };
 
@@ -686,6 +688,14 @@ std::string HclPublicStreams::handle_host_sched_cmd_signal_so(const void* addres
                        handleOfiCompCallbackParams((void*)&cmd->compParams));
 }
 
+std::string HclPublicStreams::handle_host_sched_cmd_set_priority(const void* address)
+{
+    const host_sched_cmd_set_priority* cmd = reinterpret_cast<const host_sched_cmd_set_priority*>(address);
+    if (cmd->opcode != HOST_SCHED_CMD_SET_PRIORITY) return {};
+
+    return fmt::format(FMT_COMPILE("opcode: {} highPriority: {}"), "HOST_SCHED_CMD_SET_PRIORITY", cmd->highPriority);
+}
+
 static void dumpQpWqes(IHclDevice* device, int nic, uint32_t qp, hl_logger::LoggerSPtr logger)
 {
     if (!GCFG_HCL_DFA_DUMP_WQE.value())
@@ -14,6 +14,8 @@
 #include "infra/scal/gen2_arch_common/scal_manager.h"  // for Gen2ArchScalManager
 #include "hcl_global_conf.h"                           // for GCFG_...
 #include "infra/hcl_debug_stats.h"                     // for DEBUG_STATS_...
+#include "hccl/ofi_plugin.h"                           // for OfiPlugin
+#include "libfabric/hl_ofi.h"                          // for ofi_t
 
 void HostScheduler::startThread(HclDeviceGen2Arch* device, unsigned index, std::vector<HostStream*>& hostStreams)
 {
@@ -23,6 +25,19 @@ void HostScheduler::startThread(HclDeviceGen2Arch* device, unsigned index, std::
     m_index          = index;
     m_sleepThreshold = GCFG_HOST_SCHEDULER_SLEEP_THRESHOLD.value();
     m_sleepDuration  = std::chrono::milliseconds(GCFG_HOST_SCHEDULER_SLEEP_DURATION.value());
+    m_priorityClasses = GCFG_HCL_PRIORITY_CLASSES.value();
+    m_bulkMaxSkip     = GCFG_HCL_PRIORITY_BULK_MAX_SKIP.value();
+    if (GCFG_HOST_SCHEDULER_BATCH_POSTS.value())
+    {
+        if (OfiPlugin::isMsgPostSupported())
+        {
+            m_postBatch = std::make_unique<ofi_post_batch_t>();
+        }
+        else
+        {
+            LOG_HCL_WARN(HCL, "[{}]: OFI wrapper doesn't support msg posts, scaleout posts won't be batched", m_index);
+        }
+    }
     m_thread.initialize(m_device->getDeviceConfig().getHwModuleId(),
                         m_device->getDeviceConfig().getHostName(),
                         eHCLProactorThread,
@@ -38,6 +53,23 @@ void HostScheduler::stopThread()
         m_stop = true;
         notifyThread();
         m_thread.join();
+
+        if (m_priorityClasses)
+        {
+            LOG_HCL_INFO(HCL,
+                         "Host scheduler ({}) priority rounds={}, bulk yield rounds={}",
+                         m_index,
+                         m_priorityRounds,
+                         m_bulkYieldRounds);
+        }
+        if (m_postBatch)
+        {
+            LOG_HCL_INFO(HCL,
+                         "Host scheduler ({}) batched posts={}, flushes={}",
+                         m_index,
+                         m_batchedPosts,
+                         m_postFlushes);
+        }
     }
 }
 
@@ -61,15 +93,46 @@ void HostScheduler::runHostScheduler()
         while (!m_stop)
         {
             bool allStreamsAreEmpty = true;
+            bool highPriorityWork   = false;
+            if (m_priorityClasses)
+            {
+                for (const auto& hostStream : m_hostStreams)
+                {
+                    if (hostStream->isHighPriority() && !hostStream->isEmpty())
+                    {
+                        processStream(hostStream);
+                        highPriorityWork = true;
+                    }
+                }
+            }
+
+            // bulk streams yield to high priority ones for at most m_bulkMaxSkip rounds in a row
+            const bool serveBulk = !highPriorityWork || m_bulkSkipped >= m_bulkMaxSkip;
+            m_bulkSkipped        = serveBulk ? 0 : m_bulkSkipped + 1;
+            if (highPriorityWork)
+            {
+                m_priorityRounds++;
+                m_bulkYieldRounds += serveBulk ? 0 : 1;
+            }
+
             for (const auto& hostStream : m_hostStreams)
             {
                 if (!hostStream->isEmpty())
                 {
-                    processStream(hostStream);
                     allStreamsAreEmpty  = false;
                     emptyStreamsCounter = 0;
+                    if (!m_priorityClasses || (!hostStream->isHighPriority() && serveBulk))
+                    {
+                        processStream(hostStream);
+                    }
                 }
             }
+            allStreamsAreEmpty &= !highPriorityWork;
+
+            if (m_postBatch && !m_postBatch->empty())
+            {
+                flushPosts();
+            }
 
             if (allStreamsAreEmpty)
             {
@@ -219,6 +282,14 @@ void HostScheduler::processStream(HostStream* hostStream)
                 break;
             }
 
+            case HOST_SCHED_CMD_SET_PRIORITY:
+            {
+                done        = processSetPriorityCommand(hostStream);
+                commandSize = sizeof(host_sched_cmd_set_priority);
+                streamDepthProc++;  // a marker doesn't take the place of a command
+                break;
+            }
+
             default:
                 VERIFY(false, "On stream {}, unknown host stream command opcode ({})", hostStream->getStreamName(), op);
         }
@@ -274,11 +345,16 @@ bool HostScheduler::processScaleoutWaitForCompCommand(HostStream* hostStream, ui
                       .m_hostNicBridge->waitForCompletionNb(&internalStreamInfo->handle, done);
     VERIFY(status == true, "waitForCompletion returned with an error");
     srCount = internalStreamInfo->srCount;
+    submitTime = internalStreamInfo->submitTime;
     if (done)
     {
+        // failed posts were not counted, so neither are their completions
+        if (internalStreamInfo->posted)
+        {
+            m_device->getComm(waitForCompCommand->comm).getStats().addScaleoutCompletion();
+        }
         hostStream->getInnerQueue()->free(sizeof(innerQueueMsg) >> 2);
     }
-    submitTime = internalStreamInfo->submitTime;
 
     return done;
 }
@@ -329,7 +405,8 @@ bool HostScheduler::processScaleOutWithFenceCommand(HostStream* hostStream)
                                                                     &handle,
                                                                     hostStream->getUarchStreamIdx(),
                                                                     scaleOutCommand->compParams,
-                                                                    scaleOutCommand->qpSetIndex);
+                                                                    scaleOutCommand->qpSetIndex,
+                                                                    m_postBatch.get());
     }
     else
     {
@@ -339,18 +416,24 @@ bool HostScheduler::processScaleOutWithFenceCommand(HostStream* hostStream)
                                                                     &handle,
                                                                     hostStream->getUarchStreamIdx(),
                                                                     scaleOutCommand->compParams,
-                                                                    scaleOutCommand->qpSetIndex);
+                                                                    scaleOutCommand->qpSetIndex,
+                                                                    m_postBatch.get());
     }
 
     if (status != hcclSuccess)
     {
         LOG_HCL_ERR(HCL, "[{}]: {} returned with an error", m_index, isSend ? "sendAsync" : "recvAsync");
     }
+    else
+    {
+        m_device->getComm(comm).getStats().addScaleoutPost(isSend, scaleOutCommand->qpSetIndex, size);
+    }
 
     innerQueueMsg innerMsg;
     innerMsg.handle     = handle.ofi;
     innerMsg.submitTime = hostStream->getCurrTimeMsec();
     innerMsg.srCount    = scaleOutCommand->srCount;
+    innerMsg.posted     = status == hcclSuccess;
 
     uint32_t* ptr = hostStream->getInnerQueue()->getNextPtr(sizeof(innerQueueMsg) >> 2);
     memcpy((void*)ptr, &innerMsg, sizeof(innerQueueMsg));
@@ -391,7 +474,8 @@ bool HostScheduler::processScaleOutCommand(HostStream* hostStream)
                                                                     &handle,
                                                                     hostStream->getUarchStreamIdx(),
                                                                     scaleOutCommand->compParams,
-                                                                    scaleOutCommand->qpSetIndex);
+                                                                    scaleOutCommand->qpSetIndex,
+                                                                    m_postBatch.get());
     }
     else
     {
@@ -401,18 +485,24 @@ bool HostScheduler::processScaleOutCommand(HostStream* hostStream)
                                                                     &handle,
                                                                     hostStream->getUarchStreamIdx(),
                                                                     scaleOutCommand->compParams,
-                                                                    scaleOutCommand->qpSetIndex);
+                                                                    scaleOutCommand->qpSetIndex,
+                                                                    m_postBatch.get());
     }
 
     if (status != hcclSuccess)
     {
         LOG_HCL_ERR(HCL, "[{}]: {} returned with an error", m_index, isSend ? "sendAsync" : "recvAsync");
     }
+    else
+    {
+        m_device->getComm(comm).getStats().addScaleoutPost(isSend, scaleOutCommand->qpSetIndex, size);
+    }
 
     innerQueueMsg innerMsg;
     innerMsg.handle     = handle.ofi;
     innerMsg.submitTime = hostStream->getCurrTimeMsec();
     innerMsg.srCount    = scaleOutCommand->srCount;
+    innerMsg.posted     = status == hcclSuccess;
 
     uint32_t* ptr = hostStream->getInnerQueue()->getNextPtr(sizeof(innerQueueMsg) >> 2);
     memcpy((void*)ptr, &innerMsg, sizeof(innerQueueMsg));
@@ -422,6 +512,16 @@ bool HostScheduler::processScaleOutCommand(HostStream* hostStream)
     return true;
 }
 
+void HostScheduler::flushPosts()
+{
+    m_batchedPosts += m_postBatch->entries.size();
+    m_postFlushes++;
+    if (m_device->getOfiHandle()->flush(*m_postBatch) != hcclSuccess)
+    {
+        LOG_HCL_ERR(HCL, "[{}]: posting the batched scaleout operations failed", m_index);
+    }
+}
+
 bool HostScheduler::processSignalSoCommand([[maybe_unused]] HostStream* hostStream)
 {
     host_sched_cmd_signal_so* signalSoCommand = (host_sched_cmd_signal_so*)m_hostStreamCmd;
@@ -433,6 +533,15 @@ bool HostScheduler::processSignalSoCommand([[maybe_unused]] HostStream* hostStre
     return true;
 }
 
+bool HostScheduler::processSetPriorityCommand(HostStream* hostStream)
+{
+    host_sched_cmd_set_priority* setPriorityCommand = (host_sched_cmd_set_priority*)m_hostStreamCmd;
+
+    hostStream->setHighPriority(setPriorityCommand->highPriority);
+
+    return true;
+}
+
 bool HostScheduler::processFenceWaitCommand(HostStream* hostStream)
 {
     host_sched_cmd_fence_wait* fenceWaitCommand = (host_sched_cmd_fence_wait*)m_hostStreamCmd;
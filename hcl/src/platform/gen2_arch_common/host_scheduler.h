@@ -2,6 +2,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include "infra/hcl_affinity_manager.h"  // for HclThread
 #include "hcl_utils.h"
 
@@ -18,6 +19,7 @@ enum sched_host_opcode
     HOST_SCHED_CMD_RECV_WITH_FENCE,
     HOST_SCHED_CMD_WAIT_FOR_COMP,
     HOST_SCHED_CMD_SIGNAL_SO,
+    HOST_SCHED_CMD_SET_PRIORITY,
     HOST_SCHED_CMD_NUM
 };
 
@@ -41,6 +43,7 @@ inline HostSchedCommandNames::HostSchedCommandNames()
         (HOST_SCHED_CMD_RECV_WITH_FENCE, "RecvWithFenceWait")
         (HOST_SCHED_CMD_WAIT_FOR_COMP, "WaitForComp")
         (HOST_SCHED_CMD_SIGNAL_SO, "SignalSo")
+        (HOST_SCHED_CMD_SET_PRIORITY, "SetPriority")
     ;
 }
 // clang-format on
@@ -127,6 +130,16 @@ struct host_sched_cmd_signal_so
     OfiCompCallbackParams compParams;
 } __attribute__((aligned(4), __packed__));
 
+// priority class of the stream's following commands, only emitted when it changes (HCL_PRIORITY_CLASSES)
+struct host_sched_cmd_set_priority
+{
+    uint32_t opcode : 4;
+    uint32_t highPriority : 1;
+    uint32_t reserved : 27;
+} __attribute__((aligned(4), __packed__));
+
+struct ofi_post_batch_t;
+
 class HostScheduler
 {
 public:
@@ -158,6 +171,16 @@ private:
     std::condition_variable   m_submittedWorkCondVar;
     uint64_t                  m_sleepThreshold;
     std::chrono::milliseconds m_sleepDuration;
+    bool                      m_priorityClasses = false;
+    uint64_t                  m_bulkMaxSkip     = 0;
+    uint64_t                  m_bulkSkipped     = 0;  // consecutive rounds in which bulk streams yielded
+    uint64_t                  m_priorityRounds  = 0;  // rounds with high priority work, for stats
+    uint64_t                  m_bulkYieldRounds = 0;  // rounds in which bulk streams yielded, for stats
+
+    // scaleout posts of the current round, flushed at its end (HOST_SCHEDULER_BATCH_POSTS), nullptr if disabled
+    std::unique_ptr<ofi_post_batch_t> m_postBatch;
+    uint64_t                          m_batchedPosts = 0;  // for stats
+    uint64_t                          m_postFlushes  = 0;  // for stats
 
     void     processStream(HostStream* hostStream);
     bool     processScaleOutCommand(HostStream* hostStream);
@@ -165,5 +188,7 @@ private:
     bool     processScaleoutWaitForCompCommand(HostStream* hostStream, uint64_t& srCount, uint64_t& submitTime);
     bool     processFenceWaitCommand(HostStream* hostStream);
     bool     processSignalSoCommand(HostStream* hostStream);
+    bool     processSetPriorityCommand(HostStream* hostStream);
+    void     flushPosts();
     uint32_t getStreamDepthProc(HostStream* hostStream);
 };
\ No newline at end of file
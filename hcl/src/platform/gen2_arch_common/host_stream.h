@@ -26,6 +26,7 @@ struct innerQueueMsg
         0;  // For debug, time when message was put into queue, used by consuming wait for completion stream
     uint64_t srCount =
         0;  // For debug, s/r ops counter when msg submitted, used by consuming wait for completion stream
+    bool posted = false;  // The send/recv was posted successfully, only those are counted in the comm stats
 };
 
 class HostStream
@@ -72,6 +73,10 @@ public:
     inline uint64_t getSrCount() const { return m_srCount; }  // used by s/r submit stream
     inline void     incSrCount() { m_srCount++; }             // used by s/r submit stream
 
+    // priority class of the command at the head of the outer queue, owned by the host scheduler thread
+    inline bool isHighPriority() const { return m_highPriority; }
+    inline void setHighPriority(bool highPriority) { m_highPriority = highPriority; }
+
 private:
     std::string          m_streamName;  // For Debug
     spHostStreamFifo     m_innerQueue;  // For passing info between 2 host streams (Example: ofi_req)
@@ -91,4 +96,6 @@ private:
     std::string m_funcName;
 
     uint64_t m_currentSrCountProcessing = 0;
+
+    bool m_highPriority = false;
 };
\ No newline at end of file
@@ -16,20 +16,37 @@
 #include "interfaces/hcl_unique_sorted_vector.h"
 #include "platform/gen2_arch_common/collective_states.h"
 #include "platform/gen2_arch_common/hcl_device.h"
+#include "platform/gen2_arch_common/hcl_packets.h"
 #include "platform/gen2_arch_common/host_scheduler.h"
 #include "platform/gen2_arch_common/host_stream.h"
 #include "platform/gen2_arch_common/simb_pool_container_allocator.h"
 #include "platform/gen2_arch_common/host_simb_pool_manager.h"
 #include "platform/gen2_arch_common/signals/manager.h"
 #include "platform/gen2_arch_common/signals/types.h"
-#include "platform/gen2_arch_common/collective_utils.h"  // for getNextBox, getPrevBox
 #include "hcl_log_manager.h"                             // for LOG_*
 #include "hcl_types.h"                                   // for HostNicConnectInfo
 #include "hcl_math_utils.h"
 #include "platform/gen2_arch_common/server_connectivity.h"  // for Gen2ArchServerConnectivity
+#include "libfabric/hl_topo.h"                              // for bindToNumaNode, getNumaNodes
+#include "hlthunk.h"                                         // for hlthunk_host_memory_map
+
+thread_local bool ScaleoutProvider::s_directPath = false;
 
 ScaleoutProvider::ScaleoutProvider(HclDeviceGen2Arch* device) : m_device(device) {}
 
+ScaleoutProvider::PathScope::PathScope(ScaleoutProvider& provider, const HclCollectiveParams& params)
+: m_prevDirect(s_directPath),
+  m_isDirect(provider.isHybrid() && params.m_dynamicComm.isCommunicatorMultiScaleupGroup() &&
+             provider.isDirectPathFor(params.m_count * dataTypeSizeInBytes(params.m_dataType)))
+{
+    s_directPath = m_isDirect;
+}
+
+ScaleoutProvider::PathScope::~PathScope()
+{
+    s_directPath = m_prevDirect;
+}
+
 ScaleoutProvider* ScaleoutProvider::createScaleOutProvider(HclDeviceGen2Arch* device)
 {
     ScaleoutProvider* provider = nullptr;
@@ -180,7 +197,8 @@ void Gen2ArchScaleoutProvider::calculateScaleoutRecvResources(SliceState& sliceS
         {
             if (sliceState.m_collectiveOp == eHCLBroadcast)
             {
-                unsigned nextBox = getNextBox(sliceState.m_dynamicComm.getMyScaleupGroup(), sliceState.m_boxIterations);
+                unsigned nextBox = sliceState.m_dynamicComm.getNextRingBox(sliceState.m_dynamicComm.getMyScaleupGroup(),
+                                                                           sliceState.m_boxIterations);
                 bool     isPeersOnly =
                     sliceState.m_isMultiScaleupGroup && sliceState.m_dynamicComm.getScaleupGroupSize() == 1;
                 unsigned int numFences = (nextBox == sliceState.rootBox() || isPeersOnly) ? 1 : 2;
@@ -294,6 +312,82 @@ unsigned Gen2ArchScaleoutProvider::getNumOfNicsPerDevice(const HCL_Comm comm) co
     return m_device->getComm(comm).getCommConnectivity().getNumScaleOutPorts();
 }
 
+/**
+ * @brief Allocate the host buffers of the host SIMB pools and map them to the device.
+ *
+ * The buffers are optionally backed by huge pages (falling back to regular pages if none are available) and bound to
+ * the NUMA node of the host NIC, so the NIC and the host scheduler don't stage scaleout traffic through remote-socket
+ * memory. size is rounded up to the page size actually used.
+ */
+static void* allocHostBuffers(HclDeviceGen2Arch* device, uint64_t& size, uint64_t& deviceHandle)
+{
+    const uint64_t hugePageSize = GCFG_HCL_HOST_BUFFERS_HUGE_PAGE_SIZE.value();
+    uint64_t       pageSize     = getpagesize();
+    void*          hostAddr     = MAP_FAILED;
+
+    if (hugePageSize != 0)
+    {
+        VERIFY(hugePageSize == 2 * 1024 * 1024 || hugePageSize == 1024 * 1024 * 1024,
+               "Unsupported huge page size {}",
+               hugePageSize);
+        const uint64_t hugeSize  = div(size + hugePageSize - 1, hugePageSize) * hugePageSize;
+        const int      hugeFlags = MAP_HUGETLB | (__builtin_ctzll(hugePageSize) << MAP_HUGE_SHIFT);
+
+        hostAddr = mmap(nullptr, hugeSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS | hugeFlags, -1, 0);
+        if (hostAddr == MAP_FAILED)
+        {
+            LOG_HCL_WARN(HCL,
+                         "Failed to allocate {:g}MB of {:g}MB huge pages ({}), using regular pages",
+                         B2MB(hugeSize),
+                         B2MB(hugePageSize),
+                         strerror(errno));
+        }
+        else
+        {
+            size     = hugeSize;
+            pageSize = hugePageSize;
+        }
+    }
+
+    if (hostAddr == MAP_FAILED)
+    {
+        hostAddr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        VERIFY(hostAddr != MAP_FAILED, "Failed to allocate {} bytes of host buffers, {}", size, strerror(errno));
+    }
+    VERIFY(madvise(hostAddr, size, MADV_DONTFORK) == 0,
+           "errno={}, hostAddr=0x{:x}, length={}",
+           strerror(errno),
+           (uint64_t)hostAddr,
+           size);
+
+    // bind before the pages are allocated, which happens when they are pinned by the device mapping below
+    const int numaNode = device->getOfiHandle()->get_nic_numa_node(device->getOfiDeviceId());
+    bool      bound    = false;
+    if (GCFG_HCL_HOST_BUFFERS_NUMA_BIND.value() && numaNode >= 0)
+    {
+        bound = hl_topo::bindToNumaNode(hostAddr, size, numaNode);
+    }
+
+    VERIFY(deviceHandle = hlthunk_host_memory_map(device->getDeviceConfig().getFd(), hostAddr, 0, size),
+           "hostAddr=0x{:x}, length={}",
+           (uint64_t)hostAddr,
+           size);
+
+    if (LOG_LEVEL_AT_LEAST_INFO(HCL))
+    {
+        LOG_HCL_INFO(HCL,
+                     "Host scaleout buffers: size {:g}MB, page size {:g}MB, NIC NUMA node {}, bound {}, pages on NUMA "
+                     "node(s) [{}]",
+                     B2MB(size),
+                     B2MB(pageSize),
+                     numaNode,
+                     bound,
+                     hl_topo::getNumaNodes(hostAddr, size));
+    }
+
+    return hostAddr;
+}
+
 LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
 : ScaleoutProvider(device), m_numArchStreams(device->getHal().getMaxArchStreams())
 {
@@ -301,6 +395,7 @@ LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
     VERIFY(mod(m_numArchStreams, GCFG_HOST_SCHEDULER_THREADS.value()) == 0, "Invalid Number of Host Scheduler threads");
 
     m_hostStreamVec.resize(m_numArchStreams);
+    m_hostStreamsHighPriority.resize(m_numArchStreams, false);
     uint64_t sizeOfHostBufferPool = 0;
     m_isGaudiDirect               = ofi_t::isGaudiDirect();
 
@@ -327,17 +422,11 @@ LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
     {
         sizeOfHostBufferPool = device->getSIBBufferSize() * (HostBuffersAmount::getBufferCount(HNIC_SEND_POOL) +
                                                              HostBuffersAmount::getBufferCount(HNIC_RECV_POOL));
-        uint64_t sizeOfAllHostBuffers = m_numArchStreams * sizeOfHostBufferPool;
-
-        m_hostAddress = alloc_and_map_to_device(sizeOfAllHostBuffers,
-                                                m_deviceHandle,
-                                                device->getDeviceConfig().getFd(),
-                                                nullptr,
-                                                PROT_READ | PROT_WRITE,
-                                                MAP_SHARED | MAP_ANONYMOUS);
+        m_hostBuffersSize = m_numArchStreams * sizeOfHostBufferPool;
+        m_hostAddress     = allocHostBuffers(device, m_hostBuffersSize, m_deviceHandle);
 
         mrParams.m_addr = reinterpret_cast<uint64_t>(m_hostAddress);
-        mrParams.m_size = sizeOfAllHostBuffers;
+        mrParams.m_size = m_hostBuffersSize;
     }
 
     if (ofi_t::isMRLocal())
@@ -346,9 +435,41 @@ LibfabricScaleoutProvider::LibfabricScaleoutProvider(HclDeviceGen2Arch* device)
         device->getOfiComponent()->initializeMemoryRegion(mrParams);
     }
 
+    m_isZeroCopy = ofi_t::isZeroCopy();
+    if (ofi_t::isUserHmem())
+    {
+        uint64_t scalBase, hbmPoolStart, allocatedSize;
+        device->getScalManager().getHBMInfoForExport(scalBase, hbmPoolStart, allocatedSize);
+
+        MRParams userMrParams;
+        userMrParams.m_fd     = device->getFd();
+        userMrParams.m_addr   = scalBase;
+        userMrParams.m_size   = allocatedSize;
+        userMrParams.m_offset = hbmPoolStart - scalBase;
+        device->getOfiComponent()->initializeUserMemoryRegistration(userMrParams);
+
+        // The host buffers stay the default path. Pinning the whole pool keeps every device buffer of the gaudi-direct
+        // flow registered, as with the gaudi-direct MR. Its receives are flushed like gaudi-direct ones.
+        if (GCFG_HCL_HNIC_HYBRID_PATH.value())
+        {
+            m_isHybrid = device->getOfiComponent()->pinUserMemoryRange(hbmPoolStart, allocatedSize);
+        }
+    }
+
+    if (m_isHybrid)
+    {
+        m_directMinSize = GCFG_HCL_HNIC_HYBRID_DIRECT_MIN_SIZE.value() ? GCFG_HCL_HNIC_HYBRID_DIRECT_MIN_SIZE.value()
+                                                                       : calibrateDirectMinSize();
+        LOG_HCL_INFO(HCL, "Hybrid scaleout path, gaudi-direct for collectives of {:g}MB and up", B2MB(m_directMinSize));
+    }
+    else if (GCFG_HCL_HNIC_HYBRID_PATH.value() && !m_isGaudiDirect)
+    {
+        LOG_HCL_WARN(HCL, "Hybrid scaleout path requires registration of device memory, using host buffers only");
+    }
+
     for (unsigned archStream = 0; archStream < m_numArchStreams; archStream++)
     {
-        if (!isGaudiDirect())
+        if (!m_isGaudiDirect)
         {
             m_hostSimbPoolManager.push_back(
                 new HostSimbPoolManager(m_deviceHandle + (archStream * sizeOfHostBufferPool),
@@ -441,14 +562,10 @@ void LibfabricScaleoutProvider::destroy()
     {
         m_hostScheduler[hostSchedId]->stopThread();
     }
-    if (!isGaudiDirect())
+    if (!m_isGaudiDirect)
     {
-        uint64_t sizeOfHostBufferPool =
-            m_device->getSIBBufferSize() *
-            (HostBuffersAmount::getBufferCount(HNIC_SEND_POOL) + HostBuffersAmount::getBufferCount(HNIC_RECV_POOL));
-        uint64_t sizeOfAllHostBuffers = m_numArchStreams * sizeOfHostBufferPool;
         free_mem_mapped_to_device(m_hostAddress,
-                                  sizeOfAllHostBuffers,
+                                  m_hostBuffersSize,
                                   m_deviceHandle,
                                   m_device->getDeviceConfig().getFd());
     }
@@ -481,7 +598,46 @@ bool LibfabricScaleoutProvider::isHostNic() const
 
 bool LibfabricScaleoutProvider::isGaudiDirect() const
 {
-    return m_isGaudiDirect;
+    return m_isGaudiDirect || s_directPath;
+}
+
+uint64_t LibfabricScaleoutProvider::calibrateDirectMinSize() const
+{
+    // A collective that fits in one host buffer costs a single PDMA on the bounce path, and the NIC reads host memory
+    // at a lower latency than device memory. Under the same PCIe switch, peer-to-peer reads run at link rate, so the
+    // direct path wins from there. Across the root complex they are the bottleneck, and the bounce path, which
+    // pipelines its PDMAs over the HNIC_SEND_POOL buffers, stays ahead until the collective overflows them.
+    const uint64_t bufferSize = m_device->getSIBBufferSize();
+    const bool     nearNic    = m_device->getOfiHandle()->is_nic_near_gaudi(m_device->getOfiDeviceId());
+    const uint64_t minSize    = nearNic ? bufferSize : bufferSize * HostBuffersAmount::getBufferCount(HNIC_SEND_POOL);
+
+    LOG_HCL_INFO(HCL,
+                 "Hybrid scaleout calibration: NIC is {} the gaudi's PCIe switch, host buffer size {:g}MB",
+                 nearNic ? "under" : "not under",
+                 B2MB(bufferSize));
+    return minSize;
+}
+
+void LibfabricScaleoutProvider::acquireDirectBuffer(const uint64_t deviceAddr, const uint64_t size, const uint8_t qpSet)
+{
+    if (!m_isHybrid)
+    {
+        return;
+    }
+    // the whole pool is pinned, so this only fails for a buffer outside of it
+    VERIFY(m_device->getOfiComponent()->acquireUserBuffer(deviceAddr, size, qpSet),
+           "Device buffer 0x{:x} size {} is not in the registered device memory",
+           deviceAddr,
+           size);
+}
+
+bool LibfabricScaleoutProvider::acquireUserBuffer(const uint64_t deviceAddr, const uint64_t size, const uint8_t qpSet)
+{
+    if (!m_isZeroCopy || size < GCFG_HCL_OFI_ZERO_COPY_MIN_SIZE.value())
+    {
+        return false;
+    }
+    return m_device->getOfiComponent()->acquireUserBuffer(deviceAddr, size, qpSet);
 }
 
 HostSimbPoolManager* LibfabricScaleoutProvider::getHostSimbPoolManager(unsigned streamIdx)
@@ -692,7 +848,8 @@ void LibfabricScaleoutProvider::requestScaleoutResources(SliceState& sliceState,
         else if (sliceState.m_collectiveOp == eHCLBroadcast && sliceState.m_currentOp == eHCLScatter)
         {
             bool isPeersOnly = sliceState.m_isMultiScaleupGroup && sliceState.m_dynamicComm.getScaleupGroupSize() == 1;
-            unsigned nextBox = getNextBox(sliceState.m_dynamicComm.getMyScaleupGroup(), sliceState.m_boxIterations);
+            unsigned nextBox = sliceState.m_dynamicComm.getNextRingBox(sliceState.m_dynamicComm.getMyScaleupGroup(),
+                                                                       sliceState.m_boxIterations);
 
             WaitPhase    waitPhase = isGaudiDirect() || (isPeersOnly && nextBox == sliceState.rootBox()) ? 0 : 1;
             unsigned int numFences = 1;
@@ -732,3 +889,25 @@ void LibfabricScaleoutProvider::notifyHostScheduler(int archStreamIdx)
     int hostSchedIndex = archStreamIdx / m_streamsPerHostSched;
     return m_hostScheduler[hostSchedIndex]->notifyThread();
 }
+
+void LibfabricScaleoutProvider::setHostStreamsPriority(unsigned archStreamIdx, bool highPriority)
+{
+    if (m_hostStreamsHighPriority[archStreamIdx] == highPriority)
+    {
+        return;
+    }
+    m_hostStreamsHighPriority[archStreamIdx] = highPriority;
+
+    LOG_HCL_TRACE(HCL, "archStream={}, highPriority={}", archStreamIdx, highPriority);
+    for (auto& uarchStreams : m_hostStreamVec[archStreamIdx])
+    {
+        for (HostStream* hostStream : uarchStreams)
+        {
+            if (hostStream != nullptr)
+            {
+                HostSchedCommandsGen2Arch::serializeHostSetPriorityCommand(hostStream->getOuterQueue(), highPriority);
+            }
+        }
+    }
+    notifyHostScheduler(archStreamIdx);
+}
@@ -13,6 +13,7 @@
 #include "simb_pool_manager_base.h"  // for e_hostPoolID
 
 struct SliceState;
+struct HclCollectiveParams;
 class NonCollectiveState;
 class HclDeviceGen2Arch;
 class HostScheduler;
@@ -60,6 +61,7 @@ public:
     virtual void                 requestScaleoutResources(NonCollectiveState& nonCollectiveState)                 = 0;
     virtual unsigned             getNumOfNicsPerDevice(const HCL_Comm comm) const                                 = 0;
     virtual HostSimbPoolManager* getHostSimbPoolManager(unsigned streamIdx);
+    virtual void setHostStreamsPriority([[maybe_unused]] unsigned archStreamIdx, [[maybe_unused]] bool highPriority) {}
 
     static ScaleoutProvider* createScaleOutProvider(HclDeviceGen2Arch* device);
 
@@ -70,8 +72,35 @@ public:
     setInternalScaleoutRecvWait(WaitMethod method, SignalsManager& signalsManager, bool doReduction = false) = 0;
     virtual void validateSize(uint64_t size)                                                                 = 0;
 
+    /**
+     * @brief Makes isGaudiDirect() of a hybrid provider report the path chosen by size for one collective, while the
+     *        calling thread builds it. Has no effect with other providers or without scaleout.
+     */
+    class PathScope
+    {
+    public:
+        PathScope(ScaleoutProvider& provider, const HclCollectiveParams& params);
+        ~PathScope();
+
+        PathScope(const PathScope&)            = delete;
+        PathScope& operator=(const PathScope&) = delete;
+
+        bool isDirect() const { return m_isDirect; }
+
+    private:
+        const bool m_prevDirect;
+        const bool m_isDirect;
+    };
+
+    // Hybrid mode (HCL_HNIC_HYBRID_PATH): both scaleout paths are set up and each collective picks one by its size
+    virtual bool isHybrid() const { return false; }
+    virtual bool isDirectPathFor([[maybe_unused]] uint64_t size) const { return false; }
+
     // protected:
     HclDeviceGen2Arch* m_device = nullptr;
+
+protected:
+    static thread_local bool s_directPath;  // set by the PathScope of the thread
 };
 
 class Gen2ArchScaleoutProvider : public ScaleoutProvider
@@ -126,6 +155,30 @@ public:
     virtual void     requestScaleoutResources(NonCollectiveState& nonCollectiveState) override;
     void             notifyHostScheduler(int archStreamIdx);
 
+    /**
+     * @brief Set the priority class of the next commands of an arch stream on the host scheduler.
+     *
+     * A marker is queued on every host stream of the arch stream only when the class changes, so the host scheduler
+     * picks up the new class in order with the commands.
+     */
+    virtual void setHostStreamsPriority(unsigned archStreamIdx, bool highPriority) override;
+
+    /**
+     * @brief Pin a user device buffer for a direct (zero-copy) host NIC transfer.
+     *
+     * @return false if zero-copy is disabled, the message is too small or the buffer can't be registered; the caller
+     *         must use the staged path in that case.
+     */
+    bool acquireUserBuffer(uint64_t deviceAddr, uint64_t size, uint8_t qpSet);
+
+    virtual bool isHybrid() const override { return m_isHybrid; }
+    virtual bool isDirectPathFor(uint64_t size) const override { return size >= m_directMinSize; }
+
+    /**
+     * @brief Pin a device buffer for a gaudi-direct transfer of a hybrid provider, does nothing otherwise.
+     */
+    void acquireDirectBuffer(uint64_t deviceAddr, uint64_t size, uint8_t qpSet);
+
     virtual HostSimbPoolManager* getHostSimbPoolManager(unsigned streamIdx) override;
 
     SignalEvent getScaleoutSendSignal() override;
@@ -139,12 +192,19 @@ public:
 
     uint64_t m_deviceHandle;
     void*    m_hostAddress;
+    uint64_t m_hostBuffersSize = 0;
     unsigned m_streamsPerHostSched;
     uint64_t m_numArchStreams;
 
     std::vector<HostSimbPoolManager*> m_hostSimbPoolManager;
 
 private:
+    uint64_t calibrateDirectMinSize() const;
+
     bool                                        m_isGaudiDirect = false;
+    bool                                        m_isZeroCopy    = false;
+    bool                                        m_isHybrid      = false;
+    uint64_t                                    m_directMinSize = 0;  // hybrid mode, smaller collectives are staged
     std::vector<std::unique_ptr<HostScheduler>> m_hostScheduler;
+    std::vector<bool>                           m_hostStreamsHighPriority;  // last class queued, per arch stream
 };
@@ -7,6 +7,7 @@
 #include "platform/gen2_arch_common/hccl_device.h"
 #include "infra/scal/gen2_arch_common/scal_stream.h"
 #include "hcl_math_utils.h"
+#include "infra/hcl_debug_stats.h"  // for g_dbgStats, DEBUG_STATS_...
 #include <algorithm>
 
 #define MIN_SIZE_OF_FW_CMD 4
@@ -122,6 +123,24 @@ SignalsManager::SignalsManager(HclGraphSyncGen2Arch& graphSync, Gen2ArchScalUtil
 {
     m_completionTracker.resize(hcl::ScalStream::getCcbSize() / MIN_SIZE_OF_FW_CMD);  // sizeofCCB/MinimumSizeOfCommand
     m_allowGraphCaching = GCFG_HCL_ALLOW_GRAPH_CACHING.value();
+    m_cacheMaxEntries   = GCFG_HCL_GRAPH_CACHE_MAX_ENTRIES.value();
+}
+
+SignalsManager::~SignalsManager()
+{
+    LOG_HCL_INFO(HCL,
+                 "Graph cache: hits={}, misses={}, evictions={}, entries={}",
+                 m_cacheStats.hits,
+                 m_cacheStats.misses,
+                 m_cacheStats.evictions,
+                 m_cacheLru.size());
+
+    if (GCFG_HCL_DEBUG_STATS_LEVEL.value() >= DEBUG_STATS_LOW)
+    {
+        g_dbgStats.addCounter("graphCacheHits", m_cacheStats.hits);
+        g_dbgStats.addCounter("graphCacheMisses", m_cacheStats.misses);
+        g_dbgStats.addCounter("graphCacheEvictions", m_cacheStats.evictions);
+    }
 }
 
 SignalsManager::Graph::Graph()
@@ -172,6 +191,41 @@ void SignalsManager::initialize(CommonState* commonState, uint64_t cuid)
     m_prevIteration = m_commonState->m_boxIter;
 
     if (likely(old) && m_usingCache) handleLongtermOnGraphSwitch(created, old);
+
+    // the old graph is no longer needed, so it's safe to trim the cache now
+    if (m_usingCache) evictCache();
+}
+
+void SignalsManager::resizeCache(const HCL_Comm comm)
+{
+    if (comm >= m_cache.size())
+    {
+        const uint32_t newCommsCountInCache =
+            std::min(std::max((uint32_t)(comm + 1), (uint32_t)(m_cache.size() * 2)), (uint32_t)(2 << 16));
+        LOG_HCL_DEBUG(HCL, "resizing m_cache for comm {}, new size {}", comm, newCommsCountInCache);
+        m_cache.resize(newCommsCountInCache);
+    }
+}
+
+void SignalsManager::evictCache()
+{
+    if (m_cacheMaxEntries == 0) return;
+
+    while (m_cacheLru.size() > m_cacheMaxEntries)
+    {
+        const auto [comm, cuid] = m_cacheLru.back();
+        CommCache& commCache    = m_cache[comm];
+        auto       it           = commCache.find(cuid);
+
+        // the graph in use is the most recently used one, it's never evicted
+        if (&it->second.graph == m_graph) break;
+
+        m_cacheLru.pop_back();
+        commCache.erase(it);
+        m_cacheStats.evictions++;
+
+        LOG_HCL_DEBUG(HCL, "Evicted cached Graph for comm {} cuid 0x{:x}", comm, cuid);
+    }
 }
 
 bool SignalsManager::updateGraph(uint64_t cuid, CommonState* commonState)
@@ -181,27 +235,36 @@ bool SignalsManager::updateGraph(uint64_t cuid, CommonState* commonState)
     m_usingCache             = isCachingRequired(*commonState) && cuid != 0;
     if (m_usingCache)
     {
-        if (comm >= m_cache.size())
+        resizeCache(comm);
+        CommCache& commCache = m_cache[comm];
+        auto       it        = commCache.find(cuid);
+        if (unlikely(it == commCache.end()))
         {
-            const uint32_t newCommsCountInCache =
-                std::min(std::max((uint32_t)(comm + 1), (uint32_t)(m_cache.size() * 2)), (uint32_t)(2 << 16));
-            LOG_HCL_DEBUG(HCL, "resizing m_cache for comm {}, new size {}", comm, newCommsCountInCache);
-            m_cache.resize(newCommsCountInCache);
-        }
-        if (unlikely(m_cache[comm].count(cuid) == 0))
-        {
-            m_cache[comm][cuid];  // allocate a new graph, without invoking a copy constructor.
-            const uint64_t cache_size = m_cache[comm].size();
+            it = commCache.try_emplace(cuid).first;  // allocate a new graph, without invoking a copy constructor.
+            m_cacheLru.push_front({comm, cuid});
+            it->second.lruIt = m_cacheLru.begin();
+            m_cacheStats.misses++;
+            commonState->m_dynamicComm.getStats().addGraphCacheLookup(false);
+
             LOG_HCL_DEBUG(HCL,
                           "Can't find cached Graph for comm {} cuid 0x{:x}. Allocating new one. cache size {} elements",
                           comm,
                           cuid,
-                          cache_size);
+                          commCache.size());
             isCreated = true;
         }
+        else
+        {
+            m_cacheLru.splice(m_cacheLru.begin(), m_cacheLru, it->second.lruIt);
+            m_cacheStats.hits++;
+            commonState->m_dynamicComm.getStats().addGraphCacheLookup(true);
+        }
+        m_graph = &it->second.graph;
+    }
+    else
+    {
+        m_graph = &m_nonCachedGraph;
     }
-
-    m_graph = m_usingCache ? &m_cache[comm].at(cuid) : &m_nonCachedGraph;
 
     LOG_HCL_DEBUG(HCL,
                   "Using a cached graph for comm {} cuid 0x{:x} is {} (graph addr = 0x{:x}). Current cache size: {}",
@@ -209,7 +272,7 @@ bool SignalsManager::updateGraph(uint64_t cuid, CommonState* commonState)
                   cuid,
                   m_usingCache ? "allowed" : "not allowed",
                   (uint64_t)m_graph,
-                  m_cache.size());
+                  m_cacheLru.size());
 
     return isCreated;
 }
@@ -656,6 +719,10 @@ void SignalsManager::invalidateCommCache(const HCL_Comm comm)
     if (comm < m_cache.size())
     {
         LOG_HCL_INFO(HCL, "deleting comm {} cache, size {}", comm, m_cache[comm].size());
+        for (auto& [cuid, cached] : m_cache[comm])
+        {
+            m_cacheLru.erase(cached.lruIt);
+        }
         m_cache[comm].clear();
     }
     else
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <list>
+#include <unordered_map>
 
 #include "platform/gen2_arch_common/hcl_graph_sync.h"
 #include "platform/gen2_arch_common/signals/calculator.h"
@@ -81,8 +83,15 @@ private:
     };
 
 public:
+    struct GraphCacheStats
+    {
+        uint64_t hits      = 0;
+        uint64_t misses    = 0;
+        uint64_t evictions = 0;
+    };
+
     SignalsManager(HclGraphSyncGen2Arch& graphSync, Gen2ArchScalUtils* utils, unsigned cgSize);
-    virtual ~SignalsManager() = default;
+    virtual ~SignalsManager();
 
     void initialize(CommonState* commonState, uint64_t cuid);
     void finalize(bool entireCollective = false);
@@ -108,6 +117,8 @@ public:
     void invalidateCommCache(const HCL_Comm comm);
     void newCollective(const HCL_Comm comm);
 
+    const GraphCacheStats& getCacheStats() const { return m_cacheStats; }
+
     unsigned getNumSignalsForCompletion() const;
     unsigned getNumSignalsForInternal() const;
 
@@ -155,11 +166,27 @@ private:
     void handleLongtermOnGraphSwitch(bool created, Graph* oldGraph);
     void updateEventsOnLongterm(Graph* oldGraph);
     void resetGraph();
+    void resizeCache(const HCL_Comm comm);
+    void evictCache();
+
+    using CacheLru = std::list<std::pair<HCL_Comm, uint64_t /*cuid*/>>;
+
+    struct CachedGraph
+    {
+        Graph              graph;
+        CacheLru::iterator lruIt;  // position in m_cacheLru
+    };
+
+    using CommCache = std::unordered_map<uint64_t /*cuid*/, CachedGraph>;
+
+    std::vector<CommCache> m_cache;  // every vector entry is for a specific comm
+    Graph*                 m_graph = nullptr;
+    Graph                  m_nonCachedGraph;
+    bool                   m_usingCache = false;
 
-    std::vector<std::unordered_map<uint64_t, Graph>> m_cache;  // every vector entry is for a specific comm
-    Graph*                                           m_graph = nullptr;
-    Graph                                            m_nonCachedGraph;
-    bool                                             m_usingCache = false;
+    CacheLru        m_cacheLru;  // all cached graphs across comms, front = most recently used
+    uint64_t        m_cacheMaxEntries = 0;
+    GraphCacheStats m_cacheStats;
 
     struct CompletionTracker
     {
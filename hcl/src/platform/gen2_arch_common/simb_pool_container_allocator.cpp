@@ -21,6 +21,33 @@ void SimbPoolContainerAllocator::destroy()
     {
         freeDeviceMemory(m_fwBaseAddr);
     }
+
+    if (m_fusionBaseAddr)
+    {
+        freeDeviceMemory(m_fusionBaseAddr);
+    }
+}
+
+void SimbPoolContainerAllocator::allocateFusionBuffers()
+{
+    if (!GCFG_HCL_GROUP_FUSION.value())
+    {
+        return;
+    }
+
+    m_fusionBufferSize = GCFG_HCL_GROUP_FUSION_BUFFER_SIZE.value();
+    VERIFY(allocateDeviceMemory(m_fusionBufferSize * m_numberOfStreams, &m_fusionBaseAddr),
+           "Failed to allocate device memory for group fusion. Size: {:g}MB",
+           B2MB(m_fusionBufferSize * m_numberOfStreams));
+    LOG_HCL_INFO(HCL,
+                 "Allocated group fusion device memory. Address: 0x{:x}, Size: {:g}MB",
+                 m_fusionBaseAddr,
+                 B2MB(m_fusionBufferSize * m_numberOfStreams));
+}
+
+uint64_t SimbPoolContainerAllocator::getFusionBufferAddr(uint32_t streamIndex) const
+{
+    return m_fusionBaseAddr == 0 ? 0 : m_fusionBaseAddr + streamIndex * m_fusionBufferSize;
 }
 
 void SimbPoolContainerAllocator::generateContainerParams(unsigned                           simbSize,
@@ -106,6 +106,11 @@ public:
     virtual void freeDeviceMemory(uint64_t buffer)                           = 0;
     virtual void allocateFwIntermediateBuffer()                              = 0;
 
+    /**
+     * @brief Allocate a staging buffer per stream for fused group AllReduce calls, if HCL_GROUP_FUSION is set
+     */
+    void allocateFusionBuffers();
+
     uint64_t                   getBufferSize() const;
     DeviceSimbPoolManagerBase& getDeviceSimbPoolManager(uint32_t streamIndex);
     uint64_t                   getPoolContainerBaseAddr(unsigned poolContainerIndex);
@@ -113,6 +118,8 @@ public:
     static unsigned            getTotalSimbCount(const std::vector<e_devicePoolID>& pools);
     uint64_t                   getFwBaseAddr();
     unsigned                   getFwSliceSize();
+    uint64_t                   getFusionBufferAddr(uint32_t streamIndex) const;
+    uint64_t                   getFusionBufferSize() const { return m_fusionBufferSize; }
 
     std::map<e_devicePoolID, unsigned>
     getSIBMap(std::array<std::vector<e_devicePoolID>, MAX_POOL_CONTAINER_IDX>& poolTypes);
@@ -135,8 +142,10 @@ public:
     };
 
 protected:
-    uint64_t                                                m_fwBaseAddr = 0;
-    uint64_t                                                m_fwImbSize  = 0;
+    uint64_t                                                m_fwBaseAddr       = 0;
+    uint64_t                                                m_fwImbSize        = 0;
+    uint64_t                                                m_fusionBaseAddr   = 0;
+    uint64_t                                                m_fusionBufferSize = 0;
     std::vector<std::shared_ptr<DeviceSimbPoolManagerBase>> m_deviceSimbPoolManagers;
     uint64_t                                                m_numberOfStreams = 0;
     std::array<PoolContainerParams, MAX_POOL_CONTAINER_IDX> m_poolContainerParams;
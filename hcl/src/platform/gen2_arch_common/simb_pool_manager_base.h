@@ -86,7 +86,7 @@ public:
 
 protected:
     std::array<SimbPoolContainerParamsPerStream, SIZE> m_spcParamsPerStream;
-    const std::map<T, unsigned>                        m_poolSizes;
+    std::map<T, unsigned>                              m_poolSizes;
     std::map<T, CreditManager>                         m_creditManagers;
     std::map<T, unsigned>                              m_poolBases;
 };